@@ -38,8 +38,14 @@
  *
  */
 #include <bluetooth-sil-api/errors.h>
+#include <bluetooth-sil-api/span.h>
+#include <bluetooth-sil-api/address.h>
 #include <bluetooth-sil-api/pairing.h>
 #include <bluetooth-sil-api/properties.h>
+#include <bluetooth-sil-api/devicestate.h>
+#include <bluetooth-sil-api/scanresult.h>
+#include <bluetooth-sil-api/scandedup.h>
+#include <bluetooth-sil-api/proximity.h>
 #include <bluetooth-sil-api/profile.h>
 #include <bluetooth-sil-api/ftp.h>
 #include <bluetooth-sil-api/opp.h>
@@ -47,7 +53,19 @@
 #include <bluetooth-sil-api/observer.h>
 #include <bluetooth-sil-api/adapter.h>
 #include <bluetooth-sil-api/uuid.h>
+#include <bluetooth-sil-api/siguuid.h>
+#include <bluetooth-sil-api/advertisingdata.h>
+#include <bluetooth-sil-api/advertisingencoder.h>
+#include <bluetooth-sil-api/advertisingscheduler.h>
+#include <bluetooth-sil-api/lefilter.h>
+#include <bluetooth-sil-api/devicetable.h>
+#include <bluetooth-sil-api/deviceupdates.h>
 #include <bluetooth-sil-api/gatt.h>
+#include <bluetooth-sil-api/gattdb.h>
+#include <bluetooth-sil-api/gattcache.h>
+#include <bluetooth-sil-api/gattrequest.h>
+#include <bluetooth-sil-api/gattnotify.h>
+#include <bluetooth-sil-api/gattprepare.h>
 #include <bluetooth-sil-api/pbap.h>
 #include <bluetooth-sil-api/map.h>
 #include <bluetooth-sil-api/avrcp.h>
@@ -128,16 +128,10 @@ public:
 	 * @brief Copy c'tor
 	 * @param other Other SBC Configuration object to copy from
 	 */
-	BluetoothSbcConfiguration(const BluetoothSbcConfiguration &other) :
-		sampleFrequency(other.getSampleFrequency()),
-		channelMode(other.getChannelMode()),
-		blockLength(other.getBlockLength()),
-		subbands(other.getSubbands()),
-		allocationMethod(other.getAllocationMethod()),
-		minBitpool(other.getMinBitpool()),
-		maxBitpool(other.getMaxBitpool())
-	{
-	}
+	BluetoothSbcConfiguration(const BluetoothSbcConfiguration &other) = default;
+	BluetoothSbcConfiguration(BluetoothSbcConfiguration &&other) = default;
+	BluetoothSbcConfiguration& operator =(const BluetoothSbcConfiguration &other) = default;
+	BluetoothSbcConfiguration& operator =(BluetoothSbcConfiguration &&other) = default;
 
 	/**
 	 * @brief Retrieve the sample frequency of the SBC configuration
@@ -276,11 +270,10 @@ public:
 	 * @brief Copy c'tor
 	 * @param other Other aptX Configuration object to copy from
 	 */
-	BluetoothAptxConfiguration(const BluetoothAptxConfiguration &other) :
-		sampleFrequency(other.getSampleFrequency()),
-		channelMode(other.getChannelMode())
-	{
-	}
+	BluetoothAptxConfiguration(const BluetoothAptxConfiguration &other) = default;
+	BluetoothAptxConfiguration(BluetoothAptxConfiguration &&other) = default;
+	BluetoothAptxConfiguration& operator =(const BluetoothAptxConfiguration &other) = default;
+	BluetoothAptxConfiguration& operator =(BluetoothAptxConfiguration &&other) = default;
 
 	/**
 	 * @brief Retrieve the sample frequency of the aptX configuration
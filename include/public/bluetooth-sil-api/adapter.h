@@ -189,37 +189,40 @@ public:
 	 * @brief Copy c'tor
 	 * @param other Other LE service UUID object to copy from
 	 */
-	BluetoothLeServiceUuid(const BluetoothLeServiceUuid &other) :
-		uuid(other.getUuid()),
-		mask(other.getMask())
-	{
-	}
+	BluetoothLeServiceUuid(const BluetoothLeServiceUuid &other) = default;
+	BluetoothLeServiceUuid(BluetoothLeServiceUuid &&other) = default;
+	BluetoothLeServiceUuid& operator =(const BluetoothLeServiceUuid &other) = default;
+	BluetoothLeServiceUuid& operator =(BluetoothLeServiceUuid &&other) = default;
 
 	/**
 	 * @brief Retrieve the UUID of the service
 	 * @return uuid UUID of the service
 	 */
-	std::string getUuid() const { return uuid; }
+	const std::string& getUuid() const & { return uuid; }
+	std::string getUuid() && { return std::move(uuid); }
 
 	/**
 	 * @brief Retrieve the mask of the service
 	 * @return mask Mask of the service
 	 */
-	std::string getMask() const { return mask; }
+	const std::string& getMask() const & { return mask; }
+	std::string getMask() && { return std::move(mask); }
 
 	/**
 	 * @brief Set the UUID of the service
 	 *
 	 * @param uuid UUID of the service
 	 */
-	void setUuid(std::string uuid) { this->uuid = uuid; }
+	void setUuid(const std::string &uuid) { this->uuid = uuid; }
+	void setUuid(std::string &&uuid) { this->uuid = std::move(uuid); }
 
 	/**
 	 * @brief Set the mask of the service
 	 *
 	 * @param mask mask of the service
 	 */
-	void setMask(std::string mask) { this->mask = mask; }
+	void setMask(const std::string &mask) { this->mask = mask; }
+	void setMask(std::string &&mask) { this->mask = std::move(mask); }
 
 private:
 	std::string uuid;
@@ -246,51 +249,55 @@ public:
 	 * @brief Copy c'tor
 	 * @param other Other LE service UUID object to copy from
 	 */
-	BluetoothLeServiceData(const BluetoothLeServiceData &other) :
-		uuid(other.getUuid()),
-		data(other.getData()),
-		mask(other.getMask())
-	{
-	}
+	BluetoothLeServiceData(const BluetoothLeServiceData &other) = default;
+	BluetoothLeServiceData(BluetoothLeServiceData &&other) = default;
+	BluetoothLeServiceData& operator =(const BluetoothLeServiceData &other) = default;
+	BluetoothLeServiceData& operator =(BluetoothLeServiceData &&other) = default;
 
 	/**
 	 * @brief Retrieve the UUID of the service data
 	 * @return uuid UUID of the service
 	 */
-	std::string getUuid() const { return uuid; }
+	const std::string& getUuid() const & { return uuid; }
+	std::string getUuid() && { return std::move(uuid); }
 
 	/**
 	 * @brief Retrieve the data of the service data
 	 * @return data Data of the service
 	 */
-	BluetoothLowEnergyData getData() const { return data; }
+	const BluetoothLowEnergyData& getData() const & { return data; }
+	BluetoothLowEnergyData getData() && { return std::move(data); }
 
 	/**
 	 * @brief Retrieve the mask of the service data
 	 * @return mask mask of the service data
 	 */
-	BluetoothLowEnergyMask getMask() const { return mask; }
+	const BluetoothLowEnergyMask& getMask() const & { return mask; }
+	BluetoothLowEnergyMask getMask() && { return std::move(mask); }
 
 	/**
 	 * @brief Set the UUID of the service
 	 *
 	 * @param uuid UUID of the service
 	 */
-	void setUuid(std::string uuid) { this->uuid = uuid; }
+	void setUuid(const std::string &uuid) { this->uuid = uuid; }
+	void setUuid(std::string &&uuid) { this->uuid = std::move(uuid); }
 
 	/**
 	 * @brief Set the data of the service
 	 *
 	 * @param data data of the service
 	 */
-	void setData(BluetoothLowEnergyData data) { this->data = data; }
+	void setData(const BluetoothLowEnergyData &data) { this->data = data; }
+	void setData(BluetoothLowEnergyData &&data) { this->data = std::move(data); }
 
 	/**
 	 * @brief Set the mask of the service
 	 *
 	 * @param mask mask of the service
 	 */
-	void setMask(BluetoothLowEnergyMask mask) { this->mask = mask; }
+	void setMask(const BluetoothLowEnergyMask &mask) { this->mask = mask; }
+	void setMask(BluetoothLowEnergyMask &&mask) { this->mask = std::move(mask); }
 
 private:
 	std::string uuid;
@@ -318,12 +325,10 @@ public:
 	 * @brief Copy c'tor
 	 * @param other Other LE service UUID object to copy from
 	 */
-	BluetoothManufacturerData(const BluetoothManufacturerData &other) :
-		id(other.getId()),
-		data(other.getData()),
-		mask(other.getMask())
-	{
-	}
+	BluetoothManufacturerData(const BluetoothManufacturerData &other) = default;
+	BluetoothManufacturerData(BluetoothManufacturerData &&other) = default;
+	BluetoothManufacturerData& operator =(const BluetoothManufacturerData &other) = default;
+	BluetoothManufacturerData& operator =(BluetoothManufacturerData &&other) = default;
 
 	/**
 	 * @brief Retrieve the ID of the manufacturer data
@@ -335,13 +340,15 @@ public:
 	 * @brief Retrieve the data of the manufacture
 	 * @return data Data of the manufacturer
 	 */
-	BluetoothLowEnergyData getData() const { return data; }
+	const BluetoothLowEnergyData& getData() const & { return data; }
+	BluetoothLowEnergyData getData() && { return std::move(data); }
 
 	/**
 	 * @brief Retrieve the mask of the manufacturer data
 	 * @return mask mask of the manufacturer data
 	 */
-	BluetoothLowEnergyMask getMask() const { return mask; }
+	const BluetoothLowEnergyMask& getMask() const & { return mask; }
+	BluetoothLowEnergyMask getMask() && { return std::move(mask); }
 
 	/**
 	 * @brief Set the ID of the manufacturer data
@@ -355,14 +362,16 @@ public:
 	 *
 	 * @param data data of the manufacturer data
 	 */
-	void setData(BluetoothLowEnergyData data) { this->data = data; }
+	void setData(const BluetoothLowEnergyData &data) { this->data = data; }
+	void setData(BluetoothLowEnergyData &&data) { this->data = std::move(data); }
 
 	/**
 	 * @brief Set the mask of the manufacturer data
 	 *
 	 * @param mask mask of the manufacturer data
 	 */
-	void setMask(BluetoothLowEnergyMask mask) { this->mask = mask; }
+	void setMask(const BluetoothLowEnergyMask &mask) { this->mask = mask; }
+	void setMask(BluetoothLowEnergyMask &&mask) { this->mask = std::move(mask); }
 
 private:
 	int32_t id;
@@ -390,45 +399,45 @@ public:
 	 * @brief Copy c'tor
 	 * @param other Other LE service UUID object to copy from
 	 */
-	BluetoothLeDiscoveryFilter(const BluetoothLeDiscoveryFilter &other) :
-		address(other.getAddress()),
-		name(other.getName()),
-		serviceUuid(other.getServiceUuid()),
-		serviceData(other.getServiceData()),
-		manufacturerData(other.getManufacturerData()),
-		advertisingType(other.getAdvType())
-	{
-	}
+	BluetoothLeDiscoveryFilter(const BluetoothLeDiscoveryFilter &other) = default;
+	BluetoothLeDiscoveryFilter(BluetoothLeDiscoveryFilter &&other) = default;
+	BluetoothLeDiscoveryFilter& operator =(const BluetoothLeDiscoveryFilter &other) = default;
+	BluetoothLeDiscoveryFilter& operator =(BluetoothLeDiscoveryFilter &&other) = default;
 
 	/**
 	 * @brief Retrieve the device address
 	 * @return address the device address
 	 */
-	std::string getAddress() const { return address; }
+	const std::string& getAddress() const & { return address; }
+	std::string getAddress() && { return std::move(address); }
 
 	/**
 	 * @brief Retrieve the device name
 	 * @return name the device name
 	 */
-	std::string getName() const { return name; }
+	const std::string& getName() const & { return name; }
+	std::string getName() && { return std::move(name); }
 
 	/**
 	 * @brief Retrieve the service uuid object
 	 * @return serviceUuid the service uuid object
 	 */
-	BluetoothLeServiceUuid getServiceUuid() const { return serviceUuid; }
+	const BluetoothLeServiceUuid& getServiceUuid() const & { return serviceUuid; }
+	BluetoothLeServiceUuid getServiceUuid() && { return std::move(serviceUuid); }
 
 	/**
 	 * @brief Retrieve the service data object
 	 * @return serviceData the service data object
 	 */
-	BluetoothLeServiceData getServiceData() const { return serviceData; }
+	const BluetoothLeServiceData& getServiceData() const & { return serviceData; }
+	BluetoothLeServiceData getServiceData() && { return std::move(serviceData); }
 
 	/**
 	 * @brief Retrieve the manufacturer Data
 	 * @return manufacturerData the manufacturer Data
 	 */
-	BluetoothManufacturerData getManufacturerData() const { return manufacturerData; }
+	const BluetoothManufacturerData& getManufacturerData() const & { return manufacturerData; }
+	BluetoothManufacturerData getManufacturerData() && { return std::move(manufacturerData); }
 
 	/**
 	 * @brief Retrieve the manufacturer Data
@@ -455,35 +464,40 @@ public:
 	 *
 	 * @param address the device address
 	 */
-	void setAddress(std::string address) { this->address = address; }
+	void setAddress(const std::string &address) { this->address = address; }
+	void setAddress(std::string &&address) { this->address = std::move(address); }
 
 	/**
 	 * @brief Set the device name
 	 *
 	 * @param name the device name
 	 */
-	void setName(std::string name) { this->name = name; }
+	void setName(const std::string &name) { this->name = name; }
+	void setName(std::string &&name) { this->name = std::move(name); }
 
 	/**
 	 * @brief Set the service uuid object
 	 *
 	 * @param serviceUuid the service uuid object
 	 */
-	void setServiceUuid(BluetoothLeServiceUuid serviceUuid) { this->serviceUuid = serviceUuid; }
+	void setServiceUuid(const BluetoothLeServiceUuid &serviceUuid) { this->serviceUuid = serviceUuid; }
+	void setServiceUuid(BluetoothLeServiceUuid &&serviceUuid) { this->serviceUuid = std::move(serviceUuid); }
 
 	/**
 	 * @brief Set the service data object
 	 *
 	 * @param serviceData the service data object
 	 */
-	void setServiceData(BluetoothLeServiceData serviceData) { this->serviceData = serviceData; }
+	void setServiceData(const BluetoothLeServiceData &serviceData) { this->serviceData = serviceData; }
+	void setServiceData(BluetoothLeServiceData &&serviceData) { this->serviceData = std::move(serviceData); }
 
 	/**
 	 * @brief Set the manufacturer Data
 	 *
 	 * @param manufacturerData the manufacturer Data
 	 */
-	void setManufacturerData(BluetoothManufacturerData manufacturerData) { this->manufacturerData = manufacturerData; }
+	void setManufacturerData(const BluetoothManufacturerData &manufacturerData) { this->manufacturerData = manufacturerData; }
+	void setManufacturerData(BluetoothManufacturerData &&manufacturerData) { this->manufacturerData = std::move(manufacturerData); }
 
 	/**
 	 * @brief Set the manufacturer Data
@@ -1290,7 +1304,97 @@ protected:
 		return observer;
 	}
 
+	/**
+	 * @brief Notify the observer about a newly found device
+	 *
+	 *        The properties seed the device state cache so later updates through
+	 *        notifyDevicePropertiesChanged only deliver what actually changed.
+	 *
+	 * @param address Address of the device
+	 * @param properties Properties reported by the stack
+	 */
+	void notifyDeviceFound(const std::string &address, const BluetoothPropertiesList &properties)
+	{
+		deviceStates.update(address, properties, propertiesDelta);
+		getObserver()->deviceFound(address, properties);
+	}
+
+	/**
+	 * @brief Notify the observer about a newly found LE device
+	 *
+	 *        Same as notifyDeviceFound but delivered through leDeviceFound.
+	 *
+	 * @param address Address of the device
+	 * @param properties Properties reported by the stack
+	 */
+	void notifyLeDeviceFound(const std::string &address, const BluetoothPropertiesList &properties)
+	{
+		deviceStates.update(address, properties, propertiesDelta);
+		getObserver()->leDeviceFound(address, properties);
+	}
+
+	/**
+	 * @brief Notify the observer about a property update of a device
+	 *
+	 *        The update is merged into the device state cache and only the
+	 *        properties which actually changed are delivered through
+	 *        devicePropertiesDelta. Nothing is delivered if no value changed.
+	 *
+	 * @param address Address of the device
+	 * @param properties Properties reported by the stack
+	 */
+	void notifyDevicePropertiesChanged(const std::string &address, const BluetoothPropertiesList &properties)
+	{
+		if (deviceStates.update(address, properties, propertiesDelta))
+			getObserver()->devicePropertiesDelta(address, propertiesDelta);
+	}
+
+	/**
+	 * @brief Notify the observer about a property update of a LE device
+	 *
+	 *        Same as notifyDevicePropertiesChanged but delivered through
+	 *        leDevicePropertiesDelta.
+	 *
+	 * @param address Address of the device
+	 * @param properties Properties reported by the stack
+	 */
+	void notifyLeDevicePropertiesChanged(const std::string &address, const BluetoothPropertiesList &properties)
+	{
+		if (deviceStates.update(address, properties, propertiesDelta))
+			getObserver()->leDevicePropertiesDelta(address, propertiesDelta);
+	}
+
+	/**
+	 * @brief Notify the observer about a removed device and drop its cached state
+	 * @param address Address of the device
+	 */
+	void notifyDeviceRemoved(const std::string &address)
+	{
+		deviceStates.remove(address);
+		getObserver()->deviceRemoved(address);
+	}
+
+	/**
+	 * @brief Notify the observer about a removed LE device and drop its cached state
+	 * @param address Address of the device
+	 */
+	void notifyLeDeviceRemoved(const std::string &address)
+	{
+		deviceStates.remove(address);
+		getObserver()->leDeviceRemoved(address);
+	}
+
 	BluetoothAdapterStatusObserver *observer;
+
+	/**
+	 * @brief Last known properties of all remote devices reported through
+	 *        the notify*DeviceFound and notify*PropertiesChanged methods.
+	 */
+	BluetoothDeviceStateCache deviceStates;
+
+private:
+	// Reused for every update to keep its storage around
+	BluetoothPropertiesDelta propertiesDelta;
 };
 
 /**
@@ -0,0 +1,206 @@
+// Copyright (c) 2026 LG Electronics, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef BLUETOOTH_SIL_ADDRESS_H_
+#define BLUETOOTH_SIL_ADDRESS_H_
+
+#ifndef BLUETOOTH_SIL_H_
+	#error This header file should only be included by bluetooth-sil-api.h
+#endif
+
+#include <stdint.h>
+#include <string>
+#include <functional>
+
+/**
+ * @brief Bluetooth device address packed into a 64 bit integer.
+ *
+ *        The six bytes of the address are stored in the lower 48 bits with the
+ *        first byte of the printed form "AA:BB:CC:DD:EE:FF" in bits 40 to 47.
+ *        The type is trivially copyable, compares and hashes as an integer and
+ *        can be used as key of ordered and unordered containers, so device
+ *        tables don't need to store and compare address strings.
+ *
+ *        A default constructed address is invalid.
+ */
+class BluetoothAddress
+{
+public:
+	/**
+	 * @brief Create an invalid address
+	 */
+	constexpr BluetoothAddress() : value(invalidValue()) { }
+
+	/**
+	 * @brief Create an address from its packed form
+	 * @param value Address in the lower 48 bits. Upper bits are ignored.
+	 */
+	constexpr explicit BluetoothAddress(uint64_t value) : value(value & 0xffffffffffffULL) { }
+
+	/**
+	 * @brief Parse an address in the form 00:11:22:33:44:55
+	 *
+	 *        Upper and lower case hex digits are accepted. The address is invalid
+	 *        if the string isn't a well formed address.
+	 *
+	 * @param address Address to parse
+	 */
+	explicit BluetoothAddress(const std::string &address) : value(invalidValue())
+	{
+		parse(address.data(), address.size(), *this);
+	}
+
+	/**
+	 * @brief Parse an address in the form 00:11:22:33:44:55
+	 * @param address Pointer to the characters of the address
+	 * @param length Number of characters
+	 * @param result Receives the address if it is valid. Untouched otherwise.
+	 * @return True if the address is valid. False otherwise.
+	 */
+	static bool parse(const char *address, size_t length, BluetoothAddress &result)
+	{
+		if (length != 17)
+			return false;
+
+		uint64_t packed = 0;
+
+		for (size_t n = 0; n < 17; n += 3)
+		{
+			int high = hexValue(address[n]);
+			int low = hexValue(address[n + 1]);
+
+			if ((high | low) < 0 || (n < 15 && address[n + 2] != ':'))
+				return false;
+
+			packed = (packed << 8) | (high << 4) | low;
+		}
+
+		result.value = packed;
+		return true;
+	}
+
+	/**
+	 * @brief Parse an address in the form 00:11:22:33:44:55
+	 * @param address Address to parse
+	 * @param result Receives the address if it is valid. Untouched otherwise.
+	 * @return True if the address is valid. False otherwise.
+	 */
+	static bool parse(const std::string &address, BluetoothAddress &result)
+	{
+		return parse(address.data(), address.size(), result);
+	}
+
+	/**
+	 * @brief Create an address from the little endian byte order used by HCI
+	 * @param bytes Six bytes of the address with the last printed byte first
+	 * @return Address
+	 */
+	static BluetoothAddress fromLittleEndian(const uint8_t *bytes)
+	{
+		uint64_t packed = 0;
+		for (int n = 5; n >= 0; n--)
+			packed = (packed << 8) | bytes[n];
+
+		return BluetoothAddress(packed);
+	}
+
+	/**
+	 * @brief Check if the address is valid
+	 * @return True if the address is valid
+	 */
+	constexpr bool isValid() const { return value != invalidValue(); }
+
+	/**
+	 * @brief Retrieve the packed form of the address
+	 * @return Address in the lower 48 bits or ~0 if the address is invalid
+	 */
+	constexpr uint64_t toUInt64() const { return value; }
+
+	/**
+	 * @brief Format the address into a buffer
+	 * @param buffer Buffer of at least 18 characters which receives the zero
+	 *        terminated address in lower case
+	 */
+	void format(char *buffer) const
+	{
+		static const char digits[] = "0123456789abcdef";
+
+		for (int n = 0; n < 6; n++)
+		{
+			unsigned byte = (value >> (40 - n * 8)) & 0xff;
+			buffer[n * 3] = digits[byte >> 4];
+			buffer[n * 3 + 1] = digits[byte & 0xf];
+			buffer[n * 3 + 2] = ':';
+		}
+
+		buffer[17] = '\0';
+	}
+
+	/**
+	 * @brief Format the address
+	 * @return Address in the form 00:11:22:33:44:55 in lower case or an empty
+	 *         string if the address is invalid
+	 */
+	std::string toString() const
+	{
+		if (!isValid())
+			return std::string();
+
+		char buffer[18];
+		format(buffer);
+		return std::string(buffer, 17);
+	}
+
+	constexpr bool operator ==(const BluetoothAddress &other) const { return value == other.value; }
+	constexpr bool operator !=(const BluetoothAddress &other) const { return value != other.value; }
+	constexpr bool operator <(const BluetoothAddress &other) const { return value < other.value; }
+	constexpr bool operator >(const BluetoothAddress &other) const { return value > other.value; }
+	constexpr bool operator <=(const BluetoothAddress &other) const { return value <= other.value; }
+	constexpr bool operator >=(const BluetoothAddress &other) const { return value >= other.value; }
+
+private:
+	static constexpr uint64_t invalidValue() { return ~0ULL; }
+
+	static int hexValue(char c)
+	{
+		if (c >= '0' && c <= '9')
+			return c - '0';
+		if (c >= 'a' && c <= 'f')
+			return c - 'a' + 10;
+		if (c >= 'A' && c <= 'F')
+			return c - 'A' + 10;
+
+		return -1;
+	}
+
+	uint64_t value;
+};
+
+namespace std
+{
+	template <>
+	struct hash<BluetoothAddress>
+	{
+		std::size_t operator()(const BluetoothAddress &address) const
+		{
+			// Spread addresses of the same vendor which only differ in the lower bytes
+			uint64_t value = address.toUInt64() * 0x9e3779b97f4a7c15ULL;
+			return hash<uint64_t>()(value ^ (value >> 32));
+		}
+	};
+}
+
+#endif
@@ -0,0 +1,528 @@
+// Copyright (c) 2026 LG Electronics, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef BLUETOOTH_SIL_ADVERTISINGDATA_H_
+#define BLUETOOTH_SIL_ADVERTISINGDATA_H_
+
+#ifndef BLUETOOTH_SIL_H_
+	#error This header file should only be included by bluetooth-sil-api.h
+#endif
+
+#include <iterator>
+
+/**
+ * @brief Non-owning parser for advertising data and scan responses.
+ *
+ *        Advertising data (e.g. the value of the SCAN_RECORD property) is a
+ *        sequence of AD structures, each consisting of a length byte, an AD type
+ *        byte and length - 1 bytes of data. See Bluetooth Core Specification
+ *        Supplement Part A.
+ *
+ *        The view only borrows the buffer it was created for and never
+ *        allocates. Parsing stops at the first structure with a length of zero
+ *        (the remainder is padding) or at the first structure which exceeds the
+ *        buffer.
+ */
+class AdvertisingDataView
+{
+public:
+	/**
+	 * @brief AD types with typed accessors in this class.
+	 */
+	enum Type : uint8_t
+	{
+		FLAGS = 0x01,
+		INCOMPLETE_UUID16_LIST = 0x02,
+		COMPLETE_UUID16_LIST = 0x03,
+		INCOMPLETE_UUID32_LIST = 0x04,
+		COMPLETE_UUID32_LIST = 0x05,
+		INCOMPLETE_UUID128_LIST = 0x06,
+		COMPLETE_UUID128_LIST = 0x07,
+		SHORTENED_LOCAL_NAME = 0x08,
+		COMPLETE_LOCAL_NAME = 0x09,
+		TX_POWER_LEVEL = 0x0a,
+		SERVICE_DATA_UUID16 = 0x16,
+		SERVICE_DATA_UUID32 = 0x20,
+		SERVICE_DATA_UUID128 = 0x21,
+		MANUFACTURER_SPECIFIC_DATA = 0xff
+	};
+
+	/**
+	 * @brief A single AD structure
+	 */
+	struct Structure
+	{
+		/** @brief AD type */
+		uint8_t type;
+		/** @brief Data of the structure without length and type byte */
+		BluetoothByteSpan data;
+	};
+
+	/**
+	 * @brief Forward iterator over the AD structures
+	 */
+	class Iterator
+	{
+	public:
+		typedef std::forward_iterator_tag iterator_category;
+		typedef Structure value_type;
+		typedef std::ptrdiff_t difference_type;
+		typedef const Structure* pointer;
+		typedef const Structure& reference;
+
+		Iterator() : position(nullptr), end(nullptr) { }
+
+		Iterator(const uint8_t *position, const uint8_t *end) :
+			position(position),
+			end(end)
+		{
+			load();
+		}
+
+		const Structure& operator*() const { return current; }
+		const Structure* operator->() const { return &current; }
+
+		Iterator& operator++()
+		{
+			position += current.data.size() + 2;
+			load();
+			return *this;
+		}
+
+		Iterator operator++(int)
+		{
+			Iterator previous(*this);
+			++(*this);
+			return previous;
+		}
+
+		bool operator==(const Iterator &other) const { return position == other.position; }
+		bool operator!=(const Iterator &other) const { return position != other.position; }
+
+	private:
+		void load()
+		{
+			// Padding and truncated structures end the iteration
+			size_t available = end - position;
+			if (available < 2 || position[0] == 0 || position[0] >= available)
+			{
+				position = end;
+				return;
+			}
+
+			current.type = position[1];
+			current.data = BluetoothByteSpan(position + 2, position[0] - 1);
+		}
+
+		const uint8_t *position;
+		const uint8_t *end;
+		Structure current;
+	};
+
+	/**
+	 * @brief List of service UUIDs of a single width stored in an AD structure
+	 */
+	class UuidList
+	{
+	public:
+		UuidList() : width(2), complete(false) { }
+
+		UuidList(BluetoothByteSpan data, size_t width, bool complete) :
+			data(data),
+			width(width),
+			complete(complete)
+		{
+		}
+
+		/**
+		 * @brief Retrieve the number of UUIDs in the list
+		 * @return Number of UUIDs
+		 */
+		size_t size() const { return data.size() / width; }
+
+		/**
+		 * @brief Check if the list is empty
+		 * @return True if the list is empty. False otherwise.
+		 */
+		bool empty() const { return size() == 0; }
+
+		/**
+		 * @brief Check if the advertiser claims that the list is complete
+		 * @return True if the list is complete. False otherwise.
+		 */
+		bool isComplete() const { return complete; }
+
+		/**
+		 * @brief Retrieve a UUID from the list
+		 * @param index Index of the UUID. Must be less than size().
+		 * @return UUID at the index
+		 */
+		BluetoothUuid operator[](size_t index) const
+		{
+			return readUuid(data.data() + index * width, width);
+		}
+
+		/**
+		 * @brief Check if the list contains a UUID
+		 * @param uuid UUID to look for
+		 * @return True if the UUID is part of the list. False otherwise.
+		 */
+		bool contains(const BluetoothUuid &uuid) const
+		{
+			for (size_t n = 0; n < size(); n++)
+			{
+				if ((*this)[n] == uuid)
+					return true;
+			}
+
+			return false;
+		}
+
+	private:
+		BluetoothByteSpan data;
+		size_t width;
+		bool complete;
+	};
+
+	/**
+	 * @brief Service data of a single service
+	 */
+	struct ServiceData
+	{
+		/** @brief UUID of the service */
+		BluetoothUuid uuid;
+		/** @brief Data of the service without the UUID */
+		BluetoothByteSpan data;
+	};
+
+	/**
+	 * @brief Manufacturer specific data
+	 */
+	struct ManufacturerData
+	{
+		/** @brief Company identifier assigned by the Bluetooth SIG */
+		uint16_t companyId;
+		/** @brief Data following the company identifier */
+		BluetoothByteSpan data;
+	};
+
+	/**
+	 * @brief Create a view on advertising data
+	 * @param data Advertising data. The buffer must stay valid as long as the
+	 *        view and any data retrieved from it is in use.
+	 */
+	AdvertisingDataView(BluetoothByteSpan data) : buffer(data) { }
+
+	Iterator begin() const { return Iterator(buffer.begin(), buffer.end()); }
+	Iterator end() const { return Iterator(buffer.end(), buffer.end()); }
+
+	/**
+	 * @brief Check if the whole buffer consists of well-formed AD structures
+	 *
+	 *        Zero bytes after the last structure are accepted as padding.
+	 *
+	 * @return True if the data is well-formed. False otherwise.
+	 */
+	bool isValid() const
+	{
+		size_t offset = 0;
+
+		while (offset < buffer.size())
+		{
+			uint8_t length = buffer[offset];
+			if (length == 0)
+				break;
+
+			if (length >= buffer.size() - offset)
+				return false;
+
+			offset += length + 1;
+		}
+
+		for (; offset < buffer.size(); offset++)
+		{
+			if (buffer[offset] != 0)
+				return false;
+		}
+
+		return true;
+	}
+
+	/**
+	 * @brief Find the first AD structure of a type
+	 * @param type AD type to look for
+	 * @param structure Receives the structure if found
+	 * @return True if a structure of the type was found. False otherwise.
+	 */
+	bool find(uint8_t type, Structure &structure) const
+	{
+		for (auto &current : *this)
+		{
+			if (current.type == type)
+			{
+				structure = current;
+				return true;
+			}
+		}
+
+		return false;
+	}
+
+	/**
+	 * @brief Retrieve the flags
+	 * @param flags Receives the flags
+	 * @return True if the flags are available. False otherwise.
+	 */
+	bool getFlags(uint8_t &flags) const
+	{
+		Structure structure;
+		if (!find(FLAGS, structure) || structure.data.empty())
+			return false;
+
+		flags = structure.data[0];
+		return true;
+	}
+
+	/**
+	 * @brief Retrieve the advertised TX power level
+	 * @param txPower Receives the TX power level in dBm
+	 * @return True if the TX power level is available. False otherwise.
+	 */
+	bool getTxPower(int8_t &txPower) const
+	{
+		Structure structure;
+		if (!find(TX_POWER_LEVEL, structure) || structure.data.empty())
+			return false;
+
+		txPower = static_cast<int8_t>(structure.data[0]);
+		return true;
+	}
+
+	/**
+	 * @brief Retrieve the local name
+	 *
+	 *        The complete local name is preferred over the shortened one.
+	 *
+	 * @param name Receives the UTF-8 encoded name which isn't zero terminated
+	 * @param complete Receives whether the name is complete. Can be nullptr.
+	 * @return True if a name is available. False otherwise.
+	 */
+	bool getLocalName(BluetoothByteSpan &name, bool *complete = nullptr) const
+	{
+		Structure structure;
+		bool isComplete = find(COMPLETE_LOCAL_NAME, structure);
+
+		if (!isComplete && !find(SHORTENED_LOCAL_NAME, structure))
+			return false;
+
+		name = structure.data;
+		if (complete)
+			*complete = isComplete;
+
+		return true;
+	}
+
+	/**
+	 * @brief Retrieve the list of service UUIDs of a width
+	 *
+	 *        Only the first list of the requested width is returned. The complete
+	 *        list is preferred over the incomplete one.
+	 *
+	 * @param width Width of the UUIDs in bytes (2, 4 or 16)
+	 * @return List of UUIDs. Empty if not available.
+	 */
+	UuidList getServiceUuids(size_t width) const
+	{
+		uint8_t completeType;
+
+		switch (width)
+		{
+		case 2:
+			completeType = COMPLETE_UUID16_LIST;
+			break;
+		case 4:
+			completeType = COMPLETE_UUID32_LIST;
+			break;
+		case 16:
+			completeType = COMPLETE_UUID128_LIST;
+			break;
+		default:
+			return UuidList();
+		}
+
+		Structure structure;
+		if (find(completeType, structure))
+			return UuidList(structure.data, width, true);
+
+		if (find(completeType - 1, structure))
+			return UuidList(structure.data, width, false);
+
+		return UuidList();
+	}
+
+	/**
+	 * @brief Check if a service UUID is advertised in any of the UUID lists
+	 * @param uuid UUID to look for
+	 * @return True if the UUID is advertised. False otherwise.
+	 */
+	bool hasServiceUuid(const BluetoothUuid &uuid) const
+	{
+		for (auto &structure : *this)
+		{
+			size_t width = getUuidListWidth(structure.type);
+			if (width && UuidList(structure.data, width, false).contains(uuid))
+				return true;
+		}
+
+		return false;
+	}
+
+	/**
+	 * @brief Parse a service data AD structure
+	 * @param structure Structure to parse
+	 * @param serviceData Receives the service UUID and its data
+	 * @return True if the structure contains service data. False otherwise.
+	 */
+	static bool parseServiceData(const Structure &structure, ServiceData &serviceData)
+	{
+		size_t width;
+
+		switch (structure.type)
+		{
+		case SERVICE_DATA_UUID16:
+			width = 2;
+			break;
+		case SERVICE_DATA_UUID32:
+			width = 4;
+			break;
+		case SERVICE_DATA_UUID128:
+			width = 16;
+			break;
+		default:
+			return false;
+		}
+
+		if (structure.data.size() < width)
+			return false;
+
+		serviceData.uuid = readUuid(structure.data.data(), width);
+		serviceData.data = structure.data.subspan(width);
+
+		return true;
+	}
+
+	/**
+	 * @brief Find the service data of a service
+	 * @param uuid UUID of the service
+	 * @param data Receives the service data
+	 * @return True if service data for the service is available. False otherwise.
+	 */
+	bool findServiceData(const BluetoothUuid &uuid, BluetoothByteSpan &data) const
+	{
+		ServiceData serviceData;
+
+		for (auto &structure : *this)
+		{
+			if (parseServiceData(structure, serviceData) && serviceData.uuid == uuid)
+			{
+				data = serviceData.data;
+				return true;
+			}
+		}
+
+		return false;
+	}
+
+	/**
+	 * @brief Parse a manufacturer specific data AD structure
+	 * @param structure Structure to parse
+	 * @param manufacturerData Receives the company identifier and its data
+	 * @return True if the structure contains manufacturer data. False otherwise.
+	 */
+	static bool parseManufacturerData(const Structure &structure, ManufacturerData &manufacturerData)
+	{
+		if (structure.type != MANUFACTURER_SPECIFIC_DATA || structure.data.size() < 2)
+			return false;
+
+		manufacturerData.companyId = structure.data[0] | (structure.data[1] << 8);
+		manufacturerData.data = structure.data.subspan(2);
+
+		return true;
+	}
+
+	/**
+	 * @brief Retrieve the first manufacturer specific data
+	 * @param manufacturerData Receives the company identifier and its data
+	 * @return True if manufacturer data is available. False otherwise.
+	 */
+	bool getManufacturerData(ManufacturerData &manufacturerData) const
+	{
+		for (auto &structure : *this)
+		{
+			if (parseManufacturerData(structure, manufacturerData))
+				return true;
+		}
+
+		return false;
+	}
+
+	/**
+	 * @brief Retrieve the width of the UUIDs in a service UUID list AD structure
+	 * @param type AD type of the structure
+	 * @return Width of the UUIDs in bytes or 0 if the type isn't a UUID list
+	 */
+	static size_t getUuidListWidth(uint8_t type)
+	{
+		switch (type)
+		{
+		case INCOMPLETE_UUID16_LIST:
+		case COMPLETE_UUID16_LIST:
+			return 2;
+		case INCOMPLETE_UUID32_LIST:
+		case COMPLETE_UUID32_LIST:
+			return 4;
+		case INCOMPLETE_UUID128_LIST:
+		case COMPLETE_UUID128_LIST:
+			return 16;
+		default:
+			return 0;
+		}
+	}
+
+private:
+	// UUIDs are transmitted in little endian byte order
+	static BluetoothUuid readUuid(const uint8_t *data, size_t width)
+	{
+		if (width == 2)
+			return BluetoothUuid::fromUInt16(data[0] | (data[1] << 8));
+
+		if (width == 4)
+			return BluetoothUuid::fromUInt32(data[0] | (data[1] << 8) | (data[2] << 16) | ((uint32_t) data[3] << 24));
+
+		uint64_t msb = 0, lsb = 0;
+		for (int n = 15; n >= 8; n--)
+			msb = (msb << 8) | data[n];
+		for (int n = 7; n >= 0; n--)
+			lsb = (lsb << 8) | data[n];
+
+		return BluetoothUuid(msb, lsb);
+	}
+
+private:
+	BluetoothByteSpan buffer;
+};
+
+#endif
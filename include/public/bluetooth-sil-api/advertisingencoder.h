@@ -0,0 +1,415 @@
+// Copyright (c) 2026 LG Electronics, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef BLUETOOTH_SIL_ADVERTISINGENCODER_H_
+#define BLUETOOTH_SIL_ADVERTISINGENCODER_H_
+
+#ifndef BLUETOOTH_SIL_H_
+	#error This header file should only be included by bluetooth-sil-api.h
+#endif
+
+#include <algorithm>
+
+/**
+ * @brief Encoded advertising or scan response payload shared between the
+ *        encoder cache and its users.
+ */
+typedef std::shared_ptr<const std::vector<uint8_t>> AdvertisingPduPtr;
+
+/**
+ * @brief Encodes AdvertiseData into the raw AD structures of an advertising
+ *        or scan response payload.
+ *
+ *        The payload is built in this order:
+ *        - flags (if not 0)
+ *        - TX power level (if includeTxPower is set)
+ *        - complete lists of 16, 32 and 128 bit service UUIDs of all services
+ *          without service data
+ *        - service data of all services with data
+ *        - manufacturer specific data (if not empty, starting with the company
+ *          identifier)
+ *        - proprietary data in the given order
+ *        - local name (if includeName is set). If the complete name doesn't fit
+ *          into the remaining space it's shortened.
+ *        Services are sorted by UUID so equal content always produces the same
+ *        payload. UUIDs are written in their shortest form.
+ *
+ *        Encoding all SIL calls through getPdu keeps a small cache of recently
+ *        encoded payloads keyed by a hash of the content, so rotating between
+ *        a few advertising payloads doesn't serialize them again.
+ *
+ *        The encoder isn't thread-safe.
+ */
+class AdvertisingDataEncoder
+{
+public:
+	/// Maximum payload length of legacy advertising PDUs
+	static const size_t LEGACY_MAX_LENGTH = 31;
+	/// Maximum payload length of extended advertising
+	static const size_t EXTENDED_MAX_LENGTH = 1650;
+
+	/**
+	 * @brief Values not part of AdvertiseData which end up in the payload
+	 */
+	struct Parameters
+	{
+		Parameters() : txPower(0), flags(0), maxLength(LEGACY_MAX_LENGTH) { }
+
+		/// Name used if includeName is set
+		std::string localName;
+		/// TX power level used if includeTxPower is set
+		int8_t txPower;
+		/// Flags AD structure. Not included if 0, e.g. for scan responses.
+		uint8_t flags;
+		/// Maximum length of the payload
+		size_t maxLength;
+
+		bool operator ==(const Parameters &other) const
+		{
+			return localName == other.localName && txPower == other.txPower &&
+			       flags == other.flags && maxLength == other.maxLength;
+		}
+	};
+
+	/**
+	 * @brief Create an encoder
+	 * @param cacheSize Number of encoded payloads kept by getPdu
+	 */
+	AdvertisingDataEncoder(size_t cacheSize = 8) :
+		cacheSize(cacheSize),
+		useCounter(0),
+		hits(0),
+		misses(0)
+	{
+	}
+
+	/**
+	 * @brief Encode advertise data without using the cache
+	 *
+	 * @param data Data to encode
+	 * @param parameters Additional values of the payload
+	 * @param pdu Receives the payload. Existing content is replaced.
+	 * @return BLUETOOTH_ERROR_NONE on success. BLUETOOTH_ERROR_PARAM_INVALID if a
+	 *         service UUID or proprietary data is invalid or if the payload
+	 *         exceeds the maximum length.
+	 */
+	static BluetoothError encode(const AdvertiseData &data, const Parameters &parameters, std::vector<uint8_t> &pdu)
+	{
+		pdu.clear();
+
+		if (parameters.flags)
+			appendStructure(pdu, AdvertisingDataView::FLAGS, &parameters.flags, 1);
+
+		if (data.includeTxPower)
+			appendStructure(pdu, AdvertisingDataView::TX_POWER_LEVEL, reinterpret_cast<const uint8_t*>(&parameters.txPower), 1);
+
+		std::vector<std::pair<BluetoothUuid, const BluetoothLowEnergyData*>> services;
+		services.reserve(data.services.size());
+		for (auto &service : data.services)
+		{
+			BluetoothUuid uuid(service.first);
+			if (!uuid.isValid())
+				return BLUETOOTH_ERROR_PARAM_INVALID;
+
+			services.push_back(std::make_pair(uuid, &service.second));
+		}
+
+		std::sort(services.begin(), services.end(),
+		          [](const std::pair<BluetoothUuid, const BluetoothLowEnergyData*> &a,
+		             const std::pair<BluetoothUuid, const BluetoothLowEnergyData*> &b) { return a.first < b.first; });
+
+		static const uint8_t uuidListTypes[] = {
+			AdvertisingDataView::COMPLETE_UUID16_LIST,
+			AdvertisingDataView::COMPLETE_UUID32_LIST,
+			AdvertisingDataView::COMPLETE_UUID128_LIST
+		};
+
+		for (uint8_t type : uuidListTypes)
+		{
+			size_t width = AdvertisingDataView::getUuidListWidth(type);
+			size_t start = pdu.size();
+
+			for (auto &service : services)
+			{
+				if (!service.second->empty() || uuidWidth(service.first) != width)
+					continue;
+
+				// A list which exceeds the length of a single AD structure
+				// continues in another structure of the same type
+				if (pdu.size() == start || pdu[start] + width > 255)
+				{
+					start = pdu.size();
+					pdu.push_back(1);
+					pdu.push_back(type);
+				}
+
+				appendUuid(pdu, service.first, width);
+				pdu[start] += width;
+			}
+		}
+
+		for (auto &service : services)
+		{
+			if (service.second->empty())
+				continue;
+
+			size_t width = uuidWidth(service.first);
+			uint8_t type = width == 2 ? AdvertisingDataView::SERVICE_DATA_UUID16 :
+			               width == 4 ? AdvertisingDataView::SERVICE_DATA_UUID32 : AdvertisingDataView::SERVICE_DATA_UUID128;
+
+			if (width + service.second->size() > 254)
+				return BLUETOOTH_ERROR_PARAM_INVALID;
+
+			pdu.push_back(1 + width + service.second->size());
+			pdu.push_back(type);
+			appendUuid(pdu, service.first, width);
+			pdu.insert(pdu.end(), service.second->begin(), service.second->end());
+		}
+
+		if (!data.manufacturerData.empty())
+		{
+			if (data.manufacturerData.size() > 254)
+				return BLUETOOTH_ERROR_PARAM_INVALID;
+
+			appendStructure(pdu, AdvertisingDataView::MANUFACTURER_SPECIFIC_DATA,
+			                data.manufacturerData.data(), data.manufacturerData.size());
+		}
+
+		for (auto &proprietary : data.proprietaryData)
+		{
+			if (proprietary.data.size() > 254)
+				return BLUETOOTH_ERROR_PARAM_INVALID;
+
+			appendStructure(pdu, proprietary.type, proprietary.data.data(), proprietary.data.size());
+		}
+
+		if (pdu.size() > parameters.maxLength)
+			return BLUETOOTH_ERROR_PARAM_INVALID;
+
+		if (data.includeName && !parameters.localName.empty())
+		{
+			size_t available = parameters.maxLength - pdu.size();
+			size_t length = std::min<size_t>(parameters.localName.size(), 254);
+
+			if (available < 3)
+				return BLUETOOTH_ERROR_PARAM_INVALID;
+
+			uint8_t type = AdvertisingDataView::COMPLETE_LOCAL_NAME;
+			if (length + 2 > available)
+			{
+				length = available - 2;
+				type = AdvertisingDataView::SHORTENED_LOCAL_NAME;
+			}
+
+			appendStructure(pdu, type, reinterpret_cast<const uint8_t*>(parameters.localName.data()), length);
+		}
+
+		return BLUETOOTH_ERROR_NONE;
+	}
+
+	/**
+	 * @brief Retrieve the encoded payload of advertise data
+	 *
+	 *        Returns a cached payload if the same data was encoded recently.
+	 *
+	 * @param data Data to encode
+	 * @param parameters Additional values of the payload
+	 * @param pdu Receives the payload
+	 * @return Result of encode()
+	 */
+	BluetoothError getPdu(const AdvertiseData &data, const Parameters &parameters, AdvertisingPduPtr &pdu)
+	{
+		uint64_t key = hash(data, parameters);
+
+		for (auto &entry : cache)
+		{
+			if (entry.hash == key && entry.parameters == parameters && equals(entry.data, data))
+			{
+				entry.lastUsed = ++useCounter;
+				hits++;
+				pdu = entry.pdu;
+				return BLUETOOTH_ERROR_NONE;
+			}
+		}
+
+		misses++;
+
+		std::shared_ptr<std::vector<uint8_t>> encoded = std::make_shared<std::vector<uint8_t>>();
+		BluetoothError error = encode(data, parameters, *encoded);
+		if (error != BLUETOOTH_ERROR_NONE)
+			return error;
+
+		pdu = encoded;
+
+		if (cacheSize == 0)
+			return BLUETOOTH_ERROR_NONE;
+
+		CacheEntry *slot;
+		if (cache.size() < cacheSize)
+		{
+			cache.push_back(CacheEntry());
+			slot = &cache.back();
+		}
+		else
+		{
+			slot = &*std::min_element(cache.begin(), cache.end(), [](const CacheEntry &a, const CacheEntry &b) {
+				return a.lastUsed < b.lastUsed;
+			});
+		}
+
+		slot->hash = key;
+		slot->data = data;
+		slot->parameters = parameters;
+		slot->pdu = pdu;
+		slot->lastUsed = ++useCounter;
+
+		return BLUETOOTH_ERROR_NONE;
+	}
+
+	/**
+	 * @brief Drop all cached payloads and reset the counters
+	 */
+	void clear()
+	{
+		cache.clear();
+		hits = 0;
+		misses = 0;
+	}
+
+	uint64_t getCacheHits() const { return hits; }
+	uint64_t getCacheMisses() const { return misses; }
+
+	/**
+	 * @brief Compute the content hash used as cache key
+	 *
+	 *        The hash doesn't depend on the iteration order of the services.
+	 *
+	 * @param data Advertise data
+	 * @param parameters Additional values of the payload
+	 * @return Hash of the content
+	 */
+	static uint64_t hash(const AdvertiseData &data, const Parameters &parameters)
+	{
+		uint64_t value = FNV_OFFSET;
+		uint8_t options[] = {
+			data.includeTxPower, data.includeName, static_cast<uint8_t>(parameters.txPower), parameters.flags
+		};
+
+		value = hashBytes(value, options, sizeof(options));
+		value = hashBytes(value, &parameters.maxLength, sizeof(parameters.maxLength));
+		value = hashBytes(value, parameters.localName.data(), parameters.localName.size());
+		value = hashBytes(value, data.manufacturerData.data(), data.manufacturerData.size());
+
+		for (auto &proprietary : data.proprietaryData)
+		{
+			value = hashBytes(value, &proprietary.type, 1);
+			value = hashBytes(value, proprietary.data.data(), proprietary.data.size());
+		}
+
+		uint64_t services = 0;
+		for (auto &service : data.services)
+		{
+			uint64_t serviceHash = hashBytes(FNV_OFFSET, service.first.data(), service.first.size());
+			services += hashBytes(serviceHash, service.second.data(), service.second.size());
+		}
+
+		return hashBytes(value, &services, sizeof(services));
+	}
+
+private:
+	static const uint64_t FNV_OFFSET = 0xcbf29ce484222325ULL;
+
+	struct CacheEntry
+	{
+		CacheEntry() : hash(0), data(), lastUsed(0) { }
+
+		uint64_t hash;
+		AdvertiseData data;
+		Parameters parameters;
+		AdvertisingPduPtr pdu;
+		uint64_t lastUsed;
+	};
+
+	static size_t uuidWidth(const BluetoothUuid &uuid)
+	{
+		uint32_t shortUuid = uuid.toShortUuid();
+		if (shortUuid == 0)
+			return 16;
+
+		return shortUuid <= 0xffff ? 2 : 4;
+	}
+
+	static void appendUuid(std::vector<uint8_t> &pdu, const BluetoothUuid &uuid, size_t width)
+	{
+		if (width != 16)
+		{
+			uint32_t value = uuid.toShortUuid();
+			for (size_t n = 0; n < width; n++)
+				pdu.push_back(static_cast<uint8_t>(value >> (8 * n)));
+
+			return;
+		}
+
+		// Little endian: least significant byte first
+		for (int n = 0; n < 8; n++)
+			pdu.push_back(static_cast<uint8_t>(uuid.getLeastSignificantBits() >> (8 * n)));
+		for (int n = 0; n < 8; n++)
+			pdu.push_back(static_cast<uint8_t>(uuid.getMostSignificantBits() >> (8 * n)));
+	}
+
+	static void appendStructure(std::vector<uint8_t> &pdu, uint8_t type, const uint8_t *data, size_t size)
+	{
+		pdu.push_back(static_cast<uint8_t>(size + 1));
+		pdu.push_back(type);
+		pdu.insert(pdu.end(), data, data + size);
+	}
+
+	static bool equals(const AdvertiseData &a, const AdvertiseData &b)
+	{
+		if (a.includeTxPower != b.includeTxPower || a.includeName != b.includeName ||
+		    a.manufacturerData != b.manufacturerData || a.services != b.services ||
+		    a.proprietaryData.size() != b.proprietaryData.size())
+			return false;
+
+		for (size_t n = 0; n < a.proprietaryData.size(); n++)
+		{
+			if (a.proprietaryData[n].type != b.proprietaryData[n].type ||
+			    a.proprietaryData[n].data != b.proprietaryData[n].data)
+				return false;
+		}
+
+		return true;
+	}
+
+	// FNV-1a
+	static uint64_t hashBytes(uint64_t hash, const void *data, size_t size)
+	{
+		const uint8_t *bytes = static_cast<const uint8_t*>(data);
+
+		for (size_t n = 0; n < size; n++)
+			hash = (hash ^ bytes[n]) * 0x100000001b3ULL;
+
+		return hash;
+	}
+
+	size_t cacheSize;
+	uint64_t useCounter;
+	uint64_t hits;
+	uint64_t misses;
+	std::vector<CacheEntry> cache;
+};
+
+#endif
@@ -0,0 +1,568 @@
+// Copyright (c) 2026 LG Electronics, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef BLUETOOTH_SIL_ADVERTISINGSCHEDULER_H_
+#define BLUETOOTH_SIL_ADVERTISINGSCHEDULER_H_
+
+#ifndef BLUETOOTH_SIL_H_
+	#error This header file should only be included by bluetooth-sil-api.h
+#endif
+
+#include <limits>
+
+/**
+ * @brief Single advertising set of a controller driven by
+ *        BluetoothAdvertisingScheduler.
+ *
+ *        SIL implementations map the calls to the legacy HCI advertising
+ *        commands. The scheduler only calls setParameters while advertising is
+ *        disabled.
+ */
+class BluetoothAdvertisingController
+{
+public:
+	virtual ~BluetoothAdvertisingController() { }
+
+	/**
+	 * @brief Set the advertising parameters
+	 * @param settings Parameters. minInterval and maxInterval are equal and
+	 *        timeout is always 0.
+	 */
+	virtual void setParameters(const AdvertiseSettings &settings) = 0;
+
+	/**
+	 * @brief Set the advertising or scan response payload
+	 * @param isScanResponse True for the scan response payload
+	 * @param pdu Encoded payload
+	 */
+	virtual void setData(bool isScanResponse, const AdvertisingPduPtr &pdu) = 0;
+
+	/**
+	 * @brief Enable or disable advertising
+	 * @param enabled True to enable advertising
+	 */
+	virtual void setEnabled(bool enabled) = 0;
+};
+
+/**
+ * @brief Time-shares a single controller advertising set between several
+ *        logical advertisers.
+ *
+ *        SIL implementations for controllers without multi advertising support
+ *        implement registerAdvertiser, setAdvertiserParameters,
+ *        setAdvertiserData, enableAdvertiser and disableAdvertiser of
+ *        BluetoothAdapter by forwarding to the scheduler.
+ *
+ *        While a single advertiser is enabled it's programmed with its own
+ *        parameters and stays on air. With several enabled advertisers the
+ *        controller advertises with an interval of one slot and the scheduler
+ *        loads another advertiser every slot. Advertisers are picked by smooth
+ *        weighted round-robin with a weight inversely proportional to their
+ *        requested minimum interval, so each one gets the share of slots it
+ *        asked for and its slots are spread evenly. The achieved interval of an
+ *        advertiser is
+ *
+ *            slotInterval * sum(weight of all enabled advertisers) / weight
+ *
+ *        which meets the requested interval as long as the sum of
+ *        slotInterval / interval over all enabled advertisers is at most 1.
+ *
+ *        The controller state is tracked, so switching only sends parameters or
+ *        payloads which differ from the ones already loaded.
+ *
+ *        Intervals use the unit of AdvertiseSettings, the slot interval should
+ *        be the shortest interval the controller accepts. The scheduler doesn't
+ *        depend on a main loop: every change and every expired delay returned
+ *        by run() requires a call to run(), which the SIL does from a timer in
+ *        its GMainLoop. The scheduler isn't thread-safe.
+ */
+class BluetoothAdvertisingScheduler
+{
+public:
+	/// Interval used for advertisers which don't request one
+	static const uint16_t DEFAULT_INTERVAL = 100;
+
+	typedef std::function<void(uint8_t advertiserId)> TimeoutCallback;
+
+	/**
+	 * @brief Number of operations since the creation of the scheduler
+	 */
+	struct Statistics
+	{
+		Statistics() : slots(0), parameterUpdates(0), dataUpdates(0), enableUpdates(0) { }
+
+		/// Number of slots an advertiser was loaded for
+		uint64_t slots;
+		/// Number of calls to BluetoothAdvertisingController::setParameters
+		uint64_t parameterUpdates;
+		/// Number of calls to BluetoothAdvertisingController::setData
+		uint64_t dataUpdates;
+		/// Number of calls to BluetoothAdvertisingController::setEnabled
+		uint64_t enableUpdates;
+	};
+
+	/**
+	 * @brief Create a scheduler
+	 * @param controller Controller advertising set to share
+	 * @param slotInterval Controller interval used while advertisers are rotated
+	 * @param maxAdvertisers Maximum number of registered advertisers (up to 255)
+	 */
+	BluetoothAdvertisingScheduler(BluetoothAdvertisingController *controller, uint16_t slotInterval = 20,
+	                              size_t maxAdvertisers = 16) :
+		controller(controller),
+		slotInterval(slotInterval ? slotInterval : 1),
+		advertisers(std::min<size_t>(maxAdvertisers, 255)),
+		current(nullptr),
+		nextSwitch(0),
+		rotating(false),
+		reprogram(false),
+		loadedParameters(false),
+		loadedSettings(),
+		enabled(false)
+	{
+		scanResponseParameters.flags = 0;
+	}
+
+	/**
+	 * @brief Set the values used to encode payloads, e.g. the local name
+	 *
+	 *        Only affects payloads set afterwards. The flags are only used for
+	 *        advertising payloads.
+	 *
+	 * @param parameters Encoder parameters
+	 */
+	void setEncoderParameters(const AdvertisingDataEncoder::Parameters &parameters)
+	{
+		advertisingParameters = parameters;
+		scanResponseParameters = parameters;
+		scanResponseParameters.flags = 0;
+	}
+
+	/**
+	 * @brief Set the callback which is called when an advertiser was disabled
+	 *        because its timeout has expired
+	 * @param callback Callback
+	 */
+	void setTimeoutCallback(TimeoutCallback callback) { timeoutCallback = std::move(callback); }
+
+	/**
+	 * @brief Register an advertiser
+	 * @param advertiserId Receives the identifier of the advertiser (1 or above)
+	 * @return BLUETOOTH_ERROR_NONE on success. BLUETOOTH_ERROR_BUSY if the
+	 *         maximum number of advertisers is registered.
+	 */
+	BluetoothError registerAdvertiser(uint8_t &advertiserId)
+	{
+		for (size_t n = 0; n < advertisers.size(); n++)
+		{
+			if (advertisers[n].registered)
+				continue;
+
+			advertisers[n] = Advertiser();
+			advertisers[n].registered = true;
+			advertiserId = static_cast<uint8_t>(n + 1);
+			return BLUETOOTH_ERROR_NONE;
+		}
+
+		return BLUETOOTH_ERROR_BUSY;
+	}
+
+	/**
+	 * @brief Unregister an advertiser and disable it if necessary
+	 * @param advertiserId Identifier of the advertiser
+	 * @return BLUETOOTH_ERROR_NONE on success. BLUETOOTH_ERROR_PARAM_INVALID if
+	 *         the advertiser isn't registered.
+	 */
+	BluetoothError unregisterAdvertiser(uint8_t advertiserId)
+	{
+		Advertiser *advertiser = find(advertiserId);
+		if (!advertiser)
+			return BLUETOOTH_ERROR_PARAM_INVALID;
+
+		deactivate(*advertiser);
+		advertiser->registered = false;
+		return BLUETOOTH_ERROR_NONE;
+	}
+
+	/**
+	 * @brief Set the parameters of an advertiser
+	 * @param advertiserId Identifier of the advertiser
+	 * @param settings Parameters. The timeout is ignored, use the timeout of enable().
+	 * @return BLUETOOTH_ERROR_NONE on success. BLUETOOTH_ERROR_PARAM_INVALID if
+	 *         the advertiser isn't registered.
+	 */
+	BluetoothError setParameters(uint8_t advertiserId, const AdvertiseSettings &settings)
+	{
+		Advertiser *advertiser = find(advertiserId);
+		if (!advertiser)
+			return BLUETOOTH_ERROR_PARAM_INVALID;
+
+		advertiser->settings = settings;
+		advertiser->weight = weightOf(settings);
+		reprogram = reprogram || advertiser == current;
+		return BLUETOOTH_ERROR_NONE;
+	}
+
+	/**
+	 * @brief Set the advertising or scan response data of an advertiser
+	 * @param advertiserId Identifier of the advertiser
+	 * @param isScanResponse True to set the scan response data
+	 * @param data Data
+	 * @return BLUETOOTH_ERROR_NONE on success. BLUETOOTH_ERROR_PARAM_INVALID if
+	 *         the advertiser isn't registered or the data can't be encoded.
+	 */
+	BluetoothError setData(uint8_t advertiserId, bool isScanResponse, const AdvertiseData &data)
+	{
+		Advertiser *advertiser = find(advertiserId);
+		if (!advertiser)
+			return BLUETOOTH_ERROR_PARAM_INVALID;
+
+		AdvertisingPduPtr pdu;
+		BluetoothError error = encoder.getPdu(data, isScanResponse ? scanResponseParameters : advertisingParameters, pdu);
+		if (error != BLUETOOTH_ERROR_NONE)
+			return error;
+
+		(isScanResponse ? advertiser->scanResponse : advertiser->data) = pdu;
+		reprogram = reprogram || advertiser == current;
+		return BLUETOOTH_ERROR_NONE;
+	}
+
+	/**
+	 * @brief Enable an advertiser
+	 * @param advertiserId Identifier of the advertiser
+	 * @param timeoutSeconds Time after which the advertiser is disabled again.
+	 *        0 to advertise until disabled.
+	 * @param now Current time in milliseconds
+	 * @return BLUETOOTH_ERROR_NONE on success. BLUETOOTH_ERROR_PARAM_INVALID if
+	 *         the advertiser isn't registered.
+	 */
+	BluetoothError enable(uint8_t advertiserId, int timeoutSeconds, uint64_t now)
+	{
+		Advertiser *advertiser = find(advertiserId);
+		if (!advertiser)
+			return BLUETOOTH_ERROR_PARAM_INVALID;
+
+		advertiser->deadline = timeoutSeconds > 0 ? now + static_cast<uint64_t>(timeoutSeconds) * 1000 : 0;
+
+		if (!advertiser->enabled)
+		{
+			advertiser->enabled = true;
+			advertiser->currentWeight = 0;
+			active.push_back(advertiser);
+		}
+
+		return BLUETOOTH_ERROR_NONE;
+	}
+
+	/**
+	 * @brief Disable an advertiser
+	 * @param advertiserId Identifier of the advertiser
+	 * @return BLUETOOTH_ERROR_NONE on success. BLUETOOTH_ERROR_PARAM_INVALID if
+	 *         the advertiser isn't registered.
+	 */
+	BluetoothError disable(uint8_t advertiserId)
+	{
+		Advertiser *advertiser = find(advertiserId);
+		if (!advertiser)
+			return BLUETOOTH_ERROR_PARAM_INVALID;
+
+		deactivate(*advertiser);
+		return BLUETOOTH_ERROR_NONE;
+	}
+
+	/**
+	 * @brief Update the controller
+	 *
+	 *        Disables expired advertisers, loads the next advertiser if its slot
+	 *        is due and applies changes of the loaded advertiser.
+	 *
+	 * @param now Current time in milliseconds
+	 * @param delay Receives the time in milliseconds after which run() has to
+	 *        be called again
+	 * @return True if run() has to be called again after the delay. False if
+	 *         nothing is scheduled until the next change.
+	 */
+	bool run(uint64_t now, uint32_t &delay)
+	{
+		for (size_t n = 0; n < active.size(); )
+		{
+			Advertiser *advertiser = active[n];
+			if (!advertiser->deadline || advertiser->deadline > now)
+			{
+				n++;
+				continue;
+			}
+
+			deactivate(*advertiser);
+			if (timeoutCallback)
+				timeoutCallback(idOf(*advertiser));
+		}
+
+		if (active.empty())
+		{
+			setEnabled(false);
+			current = nullptr;
+			reprogram = false;
+			return false;
+		}
+
+		bool shouldRotate = active.size() > 1;
+
+		if (!current || shouldRotate != rotating || (shouldRotate && now >= nextSwitch))
+		{
+			rotating = shouldRotate;
+			current = next();
+			nextSwitch = now + slotInterval;
+			statistics.slots++;
+			load(*current);
+		}
+		else if (reprogram)
+		{
+			load(*current);
+		}
+
+		reprogram = false;
+
+		uint64_t wakeup = rotating ? nextSwitch : std::numeric_limits<uint64_t>::max();
+		for (auto advertiser : active)
+		{
+			if (advertiser->deadline && advertiser->deadline < wakeup)
+				wakeup = advertiser->deadline;
+		}
+
+		if (wakeup == std::numeric_limits<uint64_t>::max())
+			return false;
+
+		delay = static_cast<uint32_t>(std::min<uint64_t>(wakeup - now, std::numeric_limits<uint32_t>::max()));
+		return true;
+	}
+
+	/**
+	 * @brief Check if an advertiser is enabled
+	 * @param advertiserId Identifier of the advertiser
+	 * @return True if the advertiser is registered and enabled
+	 */
+	bool isEnabled(uint8_t advertiserId) const
+	{
+		const Advertiser *advertiser = find(advertiserId);
+		return advertiser && advertiser->enabled;
+	}
+
+	/**
+	 * @brief Retrieve the interval an enabled advertiser achieves with the
+	 *        currently enabled advertisers
+	 * @param advertiserId Identifier of the advertiser
+	 * @return Interval or 0 if the advertiser isn't enabled
+	 */
+	double getExpectedInterval(uint8_t advertiserId) const
+	{
+		const Advertiser *advertiser = find(advertiserId);
+		if (!advertiser || !advertiser->enabled)
+			return 0;
+
+		if (active.size() == 1)
+			return targetInterval(advertiser->settings);
+
+		uint64_t total = 0;
+		for (auto other : active)
+			total += other->weight;
+
+		return static_cast<double>(slotInterval) * total / advertiser->weight;
+	}
+
+	/**
+	 * @brief Retrieve the number of enabled advertisers
+	 * @return Number of advertisers
+	 */
+	size_t getEnabledCount() const { return active.size(); }
+
+	const Statistics& getStatistics() const { return statistics; }
+
+private:
+	struct Advertiser
+	{
+		Advertiser() :
+			registered(false),
+			enabled(false),
+			settings(),
+			weight(weightOf(settings)),
+			currentWeight(0),
+			deadline(0)
+		{
+		}
+
+		bool registered;
+		bool enabled;
+		AdvertiseSettings settings;
+		AdvertisingPduPtr data;
+		AdvertisingPduPtr scanResponse;
+		uint32_t weight;
+		int64_t currentWeight;
+		uint64_t deadline;
+	};
+
+	static uint16_t targetInterval(const AdvertiseSettings &settings)
+	{
+		if (settings.minInterval)
+			return settings.minInterval;
+
+		return settings.maxInterval ? settings.maxInterval : DEFAULT_INTERVAL;
+	}
+
+	static uint32_t weightOf(const AdvertiseSettings &settings)
+	{
+		// Scaled so intervals up to the maximum of uint16_t keep a distinct weight
+		return std::max<uint32_t>(1, 0x1000000 / targetInterval(settings));
+	}
+
+	Advertiser* find(uint8_t advertiserId)
+	{
+		if (advertiserId == 0 || advertiserId > advertisers.size() || !advertisers[advertiserId - 1].registered)
+			return nullptr;
+
+		return &advertisers[advertiserId - 1];
+	}
+
+	const Advertiser* find(uint8_t advertiserId) const
+	{
+		return const_cast<BluetoothAdvertisingScheduler*>(this)->find(advertiserId);
+	}
+
+	uint8_t idOf(const Advertiser &advertiser) const
+	{
+		return static_cast<uint8_t>(&advertiser - advertisers.data() + 1);
+	}
+
+	void deactivate(Advertiser &advertiser)
+	{
+		if (!advertiser.enabled)
+			return;
+
+		advertiser.enabled = false;
+		active.erase(std::find(active.begin(), active.end(), &advertiser));
+
+		if (current == &advertiser)
+			current = nullptr;
+	}
+
+	// Smooth weighted round-robin
+	Advertiser* next()
+	{
+		if (active.size() == 1)
+			return active.front();
+
+		int64_t total = 0;
+		Advertiser *best = nullptr;
+
+		for (auto advertiser : active)
+		{
+			advertiser->currentWeight += advertiser->weight;
+			total += advertiser->weight;
+
+			if (!best || advertiser->currentWeight > best->currentWeight)
+				best = advertiser;
+		}
+
+		best->currentWeight -= total;
+		return best;
+	}
+
+	void load(const Advertiser &advertiser)
+	{
+		AdvertiseSettings settings = advertiser.settings;
+		settings.timeout = 0;
+
+		if (rotating)
+			settings.minInterval = settings.maxInterval = slotInterval;
+		else
+			settings.minInterval = settings.maxInterval = targetInterval(advertiser.settings);
+
+		if (!loadedParameters || !sameSettings(settings, loadedSettings))
+		{
+			// Parameters can't be changed while advertising
+			setEnabled(false);
+
+			controller->setParameters(settings);
+			statistics.parameterUpdates++;
+			loadedSettings = settings;
+			loadedParameters = true;
+		}
+
+		loadData(false, advertiser.data, loadedData);
+		loadData(true, advertiser.scanResponse, loadedScanResponse);
+
+		setEnabled(true);
+	}
+
+	void loadData(bool isScanResponse, AdvertisingPduPtr pdu, AdvertisingPduPtr &loaded)
+	{
+		if (!pdu)
+			pdu = emptyPdu();
+
+		if (loaded && (pdu == loaded || *pdu == *loaded))
+			return;
+
+		controller->setData(isScanResponse, pdu);
+		statistics.dataUpdates++;
+		loaded = pdu;
+	}
+
+	void setEnabled(bool value)
+	{
+		if (enabled == value)
+			return;
+
+		controller->setEnabled(value);
+		statistics.enableUpdates++;
+		enabled = value;
+	}
+
+	static bool sameSettings(const AdvertiseSettings &a, const AdvertiseSettings &b)
+	{
+		return a.connectable == b.connectable && a.txPower == b.txPower &&
+		       a.minInterval == b.minInterval && a.maxInterval == b.maxInterval;
+	}
+
+	static const AdvertisingPduPtr& emptyPdu()
+	{
+		static const AdvertisingPduPtr pdu = std::make_shared<std::vector<uint8_t>>();
+		return pdu;
+	}
+
+	BluetoothAdvertisingController *controller;
+	uint16_t slotInterval;
+	std::vector<Advertiser> advertisers;
+	// Enabled advertisers in the order they were enabled
+	std::vector<Advertiser*> active;
+	Advertiser *current;
+	uint64_t nextSwitch;
+	bool rotating;
+	bool reprogram;
+	AdvertisingDataEncoder encoder;
+	AdvertisingDataEncoder::Parameters advertisingParameters;
+	AdvertisingDataEncoder::Parameters scanResponseParameters;
+	TimeoutCallback timeoutCallback;
+	Statistics statistics;
+
+	// State of the controller
+	bool loadedParameters;
+	AdvertiseSettings loadedSettings;
+	AdvertisingPduPtr loadedData;
+	AdvertisingPduPtr loadedScanResponse;
+	bool enabled;
+};
+
+#endif
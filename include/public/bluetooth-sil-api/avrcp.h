@@ -165,31 +165,30 @@ public:
 	/**
 	 * @brief Copy constructor
 	 */
-	BluetoothPlayerInfo(const BluetoothPlayerInfo &other) :
-	playerPath(other.getPath()),
-	name(other.getName()),
-	playerType(other.getType()),
-	addressed(other.getAddressed()),
-	browsable(other.getBrowsable()),
-	searchable(other.getSearchable()),
-	playListPath(other.getPlayListPath()) {}
+	BluetoothPlayerInfo(const BluetoothPlayerInfo &other) = default;
+	BluetoothPlayerInfo(BluetoothPlayerInfo &&other) = default;
+	BluetoothPlayerInfo& operator =(const BluetoothPlayerInfo &other) = default;
+	BluetoothPlayerInfo& operator =(BluetoothPlayerInfo &&other) = default;
 
 	/* Get functions for the member functions */
 	/**
 	 * @brief Retrieve media player path
 	 * @return Returns player path
 	 */
-	std::string getPath() const { return playerPath; }
+	const std::string& getPath() const & { return playerPath; }
+	std::string getPath() && { return std::move(playerPath); }
 	/**
 	 * @brief Retrieve player name
 	 * @return Returns player name
 	 */
-	std::string getName() const { return name; }
+	const std::string& getName() const & { return name; }
+	std::string getName() && { return std::move(name); }
 	/**
 	 * @brief Retrieve play list path of the media player
 	 * @return Returns play list path
 	 */
-	std::string getPlayListPath() const { return playListPath; }
+	const std::string& getPlayListPath() const & { return playListPath; }
+	std::string getPlayListPath() && { return std::move(playListPath); }
 	/**
 	 * @brief Retrieve player type
 	 * @return Returns player type
@@ -223,16 +222,19 @@ public:
 	 * @param playerPath Player path
 	 */
 	void setPath(const std::string &playerPath) { this->playerPath = playerPath; }
+	void setPath(std::string &&playerPath) { this->playerPath = std::move(playerPath); }
 	/**
 	 * @brief Set player name
 	 * @param name Player name
 	 */
 	void setName(const std::string &name) { this->name = name; }
+	void setName(std::string &&name) { this->name = std::move(name); }
 	/**
 	 * @brief Set play list path of the media player
 	 * @param playListPath Play list path
 	 */
 	void setPlayListPath(const std::string &playListPath) { this->playListPath = playListPath; }
+	void setPlayListPath(std::string &&playListPath) { this->playListPath = std::move(playListPath); }
 	/**
 	 * @brief Set player type
 	 * @param playerType Player type
@@ -296,40 +298,38 @@ public:
 	 * @brief Copy c'tor
 	 * @param other Other media meta data object to copy from
 	 */
-	BluetoothMediaMetaData(const BluetoothMediaMetaData &other) :
-		title(other.getTitle()),
-		artist(other.getArtist()),
-		album(other.getAlbum()),
-		genre(other.getGenre()),
-		trackNumber(other.getTrackNumber()),
-		trackCount(other.getTrackCount()),
-		duration(other.getDuration())
-	{
-	}
+	BluetoothMediaMetaData(const BluetoothMediaMetaData &other) = default;
+	BluetoothMediaMetaData(BluetoothMediaMetaData &&other) = default;
+	BluetoothMediaMetaData& operator =(const BluetoothMediaMetaData &other) = default;
+	BluetoothMediaMetaData& operator =(BluetoothMediaMetaData &&other) = default;
 
 	/**
 	 * @brief Retrieve the title of the media meta data
 	 * @return Title of the media meta data
 	 */
-	std::string getTitle() const { return title; }
+	const std::string& getTitle() const & { return title; }
+	std::string getTitle() && { return std::move(title); }
 
 	/**
 	 * @brief Retrieve the artist of the media meta data
 	 * @return Artist of the media meta data
 	 */
-	std::string getArtist() const { return artist; }
+	const std::string& getArtist() const & { return artist; }
+	std::string getArtist() && { return std::move(artist); }
 
 	/**
 	 * @brief Retrieve the album of the media meta data
 	 * @return Album of the media meta data
 	 */
-	std::string getAlbum() const { return album; }
+	const std::string& getAlbum() const & { return album; }
+	std::string getAlbum() && { return std::move(album); }
 
 	/**
 	 * @brief Retrieve the genre of the media meta data
 	 * @return Genre of the media meta data
 	 */
-	std::string getGenre() const { return genre; }
+	const std::string& getGenre() const & { return genre; }
+	std::string getGenre() && { return std::move(genre); }
 
 	/**
 	 * @brief Retrieve the track number of the media meta data
@@ -354,24 +354,28 @@ public:
 	 * @param title Title of the media meta data
 	 */
 	void setTitle(const std::string &title) { this->title = title; }
+	void setTitle(std::string &&title) { this->title = std::move(title); }
 
 	/**
 	 * @brief Set the artist for media meta data
 	 * @param artist Artist of the media meta data
 	 */
 	void setArtist(const std::string &artist) { this->artist = artist; }
+	void setArtist(std::string &&artist) { this->artist = std::move(artist); }
 
 	/**
 	 * @brief Set the album for media meta data
 	 * @param album Album of the media meta data
 	 */
 	void setAlbum(const std::string &album) { this->album = album; }
+	void setAlbum(std::string &&album) { this->album = std::move(album); }
 
 	/**
 	 * @brief Set the genre for media meta data
 	 * @param genre Genre of the media meta data
 	 */
 	void setGenre(const std::string &genre) { this->genre = genre; }
+	void setGenre(std::string &&genre) { this->genre = std::move(genre); }
 
 	/**
 	 * @brief Set the track number for media meta data
@@ -417,24 +421,23 @@ public:
 	/**
 	 * @brief Copy constructor
 	 */
-	BluetoothFolderItem(const BluetoothFolderItem &other) :
-	name(other.getName()),
-	itemPath(other.getPath()),
-	type(other.getType()),
-	playable(other.getPlayable()),
-	metadata(other.getMetadata())
-	{}
+	BluetoothFolderItem(const BluetoothFolderItem &other) = default;
+	BluetoothFolderItem(BluetoothFolderItem &&other) = default;
+	BluetoothFolderItem& operator =(const BluetoothFolderItem &other) = default;
+	BluetoothFolderItem& operator =(BluetoothFolderItem &&other) = default;
 	/* Get functions for the member variables */
 	/**
 	 * @brief Retrieve the item name
 	 * @return Item name
 	 */
-	std::string getName() const { return name; }
+	const std::string& getName() const & { return name; }
+	std::string getName() && { return std::move(name); }
 	/**
 	 * @brief Retrieve item path
 	 * @return Item path
 	 */
-	std::string getPath() const { return itemPath; }
+	const std::string& getPath() const & { return itemPath; }
+	std::string getPath() && { return std::move(itemPath); }
 	/**
 	 * @brief Retrieve item type
 	 * @returns Item type
@@ -445,7 +448,8 @@ public:
 	 * type is Audio or Video.
 	 * @return Metadata of the item
 	 */
-	BluetoothMediaMetaData getMetadata() const { return metadata; }
+	const BluetoothMediaMetaData& getMetadata() const & { return metadata; }
+	BluetoothMediaMetaData getMetadata() && { return std::move(metadata); }
 	/**
 	 * @brief Retrieve if the item is playable
 	 * @return true: Item is playable
@@ -459,11 +463,13 @@ public:
 	 * @param name  Name of the item
 	 */
 	void setName(const std::string &name) { this->name = name; }
+	void setName(std::string &&name) { this->name = std::move(name); }
 	/**
 	 * @brief Set item path
 	 * @param itemPath Item path
 	 */
 	void setPath(const std::string &itemPath) { this->itemPath = itemPath; }
+	void setPath(std::string &&itemPath) { this->itemPath = std::move(itemPath); }
 	/**
 	 * @brief Set item type
 	 * @param type Item type
@@ -474,6 +480,7 @@ public:
 	 * @param metadata Metadata of the item
 	 */
 	void setMetadata(const BluetoothMediaMetaData &metadata) { this->metadata = metadata; }
+	void setMetadata(BluetoothMediaMetaData &&metadata) { this->metadata = std::move(metadata); }
 	/**
 	 * @brief Set if the item is playable
 	 * @param playable true: Item is playable
@@ -529,12 +536,10 @@ public:
 	 * @brief Copy c'tor
 	 * @param other Other media play status object to copy from
 	 */
-	BluetoothMediaPlayStatus(const BluetoothMediaPlayStatus &other) :
-		duration(other.getDuration()),
-		position(other.getPosition()),
-		status(other.getStatus())
-	{
-	}
+	BluetoothMediaPlayStatus(const BluetoothMediaPlayStatus &other) = default;
+	BluetoothMediaPlayStatus(BluetoothMediaPlayStatus &&other) = default;
+	BluetoothMediaPlayStatus& operator =(const BluetoothMediaPlayStatus &other) = default;
+	BluetoothMediaPlayStatus& operator =(BluetoothMediaPlayStatus &&other) = default;
 
 	/**
 	 * @brief Retrieve the duration of the media play status
@@ -638,12 +643,10 @@ public:
 	 * @brief Copy constructor
 	 * @param other Other property to create a copy from
 	 */
-	BluetoothPlayerApplicationSettingsProperty(const BluetoothPlayerApplicationSettingsProperty &other) :
-		type(other.type),
-		impl(other.impl),
-		typeName(other.typeName)
-	{
-	}
+	BluetoothPlayerApplicationSettingsProperty(const BluetoothPlayerApplicationSettingsProperty &other) = default;
+	BluetoothPlayerApplicationSettingsProperty(BluetoothPlayerApplicationSettingsProperty &&other) = default;
+	BluetoothPlayerApplicationSettingsProperty& operator =(const BluetoothPlayerApplicationSettingsProperty &other) = default;
+	BluetoothPlayerApplicationSettingsProperty& operator =(BluetoothPlayerApplicationSettingsProperty &&other) = default;
 
 	/**
 	 * @brief Initialize the property with a type and a value
@@ -653,7 +656,7 @@ public:
 	template<class T>
 	BluetoothPlayerApplicationSettingsProperty(Type type, T value) :
 		type(type),
-		impl(new PropertyImpl<T>(value)),
+		impl(new PropertyImpl<T>(std::move(value))),
 		typeName(typeid(T).name()) { }
 
 	/**
@@ -689,7 +692,7 @@ public:
 	template<class T>
 	void setValue(T value)
 	{
-		impl.reset(new PropertyImpl<T>(value));
+		impl.reset(new PropertyImpl<T>(std::move(value)));
 		typeName = typeid(T).name();
 	}
 
@@ -702,7 +705,7 @@ private:
 	template<class T>
 	struct PropertyImpl : public BasePropertyImpl
 	{
-		PropertyImpl(T value) : value(value) { }
+		PropertyImpl(T value) : value(std::move(value)) { }
 		~PropertyImpl() { }
 
 		T getValue() const
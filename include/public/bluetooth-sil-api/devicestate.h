@@ -0,0 +1,212 @@
+// Copyright (c) 2026 LG Electronics, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef BLUETOOTH_SIL_DEVICESTATE_H_
+#define BLUETOOTH_SIL_DEVICESTATE_H_
+
+#ifndef BLUETOOTH_SIL_H_
+	#error This header file should only be included by bluetooth-sil-api.h
+#endif
+
+#include <unordered_map>
+
+/**
+ * @brief Set of device properties which changed with a single update.
+ *
+ *        Only properties whose value differs from the previously known state of
+ *        the device are part of the delta.
+ */
+class BluetoothPropertiesDelta
+{
+public:
+	/**
+	 * @brief Retrieve the bitmask of changed property types
+	 * @return Bitmask with bit (1 << type) set for every changed type
+	 */
+	uint64_t getChangedMask() const { return changed.getMask(); }
+
+	/**
+	 * @brief Check if the property of the specified type has changed
+	 * @param type Type of the property
+	 * @return True if the property has changed. False otherwise.
+	 */
+	bool hasChanged(BluetoothProperty::Type type) const { return changed.has(type); }
+
+	/**
+	 * @brief Find the new value of a changed property
+	 * @param type Type of the property
+	 * @return Pointer to the changed property or nullptr if it didn't change
+	 */
+	const BluetoothProperty* find(BluetoothProperty::Type type) const { return changed.find(type); }
+
+	/**
+	 * @brief Retrieve the new value of a changed property
+	 * @param type Type of the property
+	 * @param defaultValue Value to return when the property didn't change
+	 * @return New value of the property or defaultValue
+	 */
+	template<class T>
+	const T& getValue(BluetoothProperty::Type type, const T &defaultValue) const
+	{
+		return changed.getValue<T>(type, defaultValue);
+	}
+
+	/**
+	 * @brief Check if nothing has changed
+	 * @return True if the delta is empty. False otherwise.
+	 */
+	bool empty() const { return changed.empty(); }
+
+	/**
+	 * @brief Retrieve the changed properties
+	 * @return Changed properties indexed by their type
+	 */
+	const BluetoothPropertyBag& getChanged() const { return changed; }
+
+	/**
+	 * @brief Retrieve the changed properties as list
+	 * @return List of changed properties
+	 */
+	const BluetoothPropertiesList& toList() const { return changed.toList(); }
+
+	/**
+	 * @brief Remove all properties from the delta
+	 */
+	void clear() { changed.clear(); }
+
+private:
+	friend class BluetoothDeviceStateCache;
+
+	BluetoothPropertyBag changed;
+};
+
+/**
+ * @brief Cache of the last known properties of remote devices.
+ *
+ *        SIL implementations feed every property update of a device into the
+ *        cache and get back the delta against the previously known state. This
+ *        way repeated updates with unchanged values (e.g. the same RSSI reported
+ *        again during LE scanning) don't need to be delivered at all.
+ *
+ *        Devices are keyed by their packed BluetoothAddress. Updates for a
+ *        malformed address aren't cached and are reported completely.
+ *
+ *        The cache isn't thread-safe and is meant to be used from the context
+ *        the observers are notified from.
+ */
+class BluetoothDeviceStateCache
+{
+public:
+	/**
+	 * @brief Merge a property update of a device into the cache
+	 *
+	 * @param address Address of the device
+	 * @param properties Properties reported for the device. Properties of type
+	 *        EMPTY are ignored.
+	 * @param delta Receives the properties which differ from the cached state
+	 * @return True if at least one property has changed. False otherwise.
+	 */
+	bool update(const BluetoothAddress &address, const BluetoothPropertiesList &properties,
+	            BluetoothPropertiesDelta &delta)
+	{
+		delta.clear();
+
+		if (!address.isValid())
+		{
+			for (auto &property : properties)
+				delta.changed.set(property);
+
+			return !delta.empty();
+		}
+
+		BluetoothPropertyBag &state = devices[address];
+
+		for (auto &property : properties)
+		{
+			if (property.getType() == BluetoothProperty::Type::EMPTY)
+				continue;
+
+			const BluetoothProperty *current = state.find(property.getType());
+			if (current && *current == property)
+				continue;
+
+			state.set(property);
+			delta.changed.set(property);
+		}
+
+		return !delta.empty();
+	}
+
+	bool update(const std::string &address, const BluetoothPropertiesList &properties,
+	            BluetoothPropertiesDelta &delta)
+	{
+		return update(BluetoothAddress(address), properties, delta);
+	}
+
+	/**
+	 * @brief Retrieve the cached properties of a device
+	 * @param address Address of the device
+	 * @return Cached properties or nullptr if the device is unknown
+	 */
+	const BluetoothPropertyBag* find(const BluetoothAddress &address) const
+	{
+		auto iter = devices.find(address);
+		if (iter == devices.end())
+			return nullptr;
+
+		return &iter->second;
+	}
+
+	const BluetoothPropertyBag* find(const std::string &address) const
+	{
+		return find(BluetoothAddress(address));
+	}
+
+	/**
+	 * @brief Drop the cached state of a device
+	 *
+	 *        Should be called once the device is removed so a later update of the
+	 *        same device is reported completely.
+	 *
+	 * @param address Address of the device
+	 * @return True if the device was known. False otherwise.
+	 */
+	bool remove(const BluetoothAddress &address)
+	{
+		return devices.erase(address) > 0;
+	}
+
+	bool remove(const std::string &address)
+	{
+		return remove(BluetoothAddress(address));
+	}
+
+	/**
+	 * @brief Drop the cached state of all devices
+	 */
+	void clear() { devices.clear(); }
+
+	/**
+	 * @brief Retrieve the number of cached devices
+	 * @return Number of cached devices
+	 */
+	size_t size() const { return devices.size(); }
+
+private:
+	std::unordered_map<BluetoothAddress, BluetoothPropertyBag> devices;
+};
+
+#endif
@@ -0,0 +1,331 @@
+// Copyright (c) 2026 LG Electronics, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef BLUETOOTH_SIL_DEVICETABLE_H_
+#define BLUETOOTH_SIL_DEVICETABLE_H_
+
+#ifndef BLUETOOTH_SIL_H_
+	#error This header file should only be included by bluetooth-sil-api.h
+#endif
+
+#include <functional>
+#include <unordered_map>
+
+/**
+ * @brief Bounded table of the devices seen during discovery.
+ *
+ *        Long running discovery sessions see an unbounded number of devices,
+ *        especially LE devices using random addresses. The table remembers up
+ *        to a fixed number of devices keyed by their packed 48 bit address and
+ *        keeps them in least recently seen order:
+ *        - when the table is full, the least recently seen device is evicted
+ *          to make room for a new one.
+ *        - devices not seen for longer than the maximum age are expired by
+ *          expire(), which SIL implementations call periodically.
+ *        Evicted and expired devices are handed to a RemovedCallback, once for
+ *        every transport they were seen on. The table doesn't notify the
+ *        observer itself: the device is usually cached in other places as well.
+ *        SIL implementations forward the removal to
+ *        BluetoothAdapter::notifyDeviceRemoved or notifyLeDeviceRemoved, which
+ *        drop the cached device state and notify the observer, and remove the
+ *        device from their other per device stages such as
+ *        BluetoothLeScanDeduplicator and BluetoothProximityTracker.
+ *
+ *        The entries are allocated up front and reused, so the memory used by
+ *        the table is bounded by its capacity. The table isn't thread-safe.
+ */
+class BluetoothDeviceTable
+{
+public:
+	/**
+	 * @brief Counters of the table
+	 */
+	struct Statistics
+	{
+		/// Number of devices currently in the table
+		size_t size;
+		/// Maximum number of devices
+		size_t capacity;
+		/// Number of devices inserted since the creation or last clear
+		uint64_t inserted;
+		/// Number of devices evicted because the table was full
+		uint64_t evicted;
+		/// Number of devices expired because of their age
+		uint64_t expired;
+	};
+
+	/**
+	 * @brief Called for a device which was evicted or expired
+	 * @param address Address of the device
+	 * @param le True if the device was seen by a LE scan, false if it was seen
+	 *        by a classic discovery
+	 */
+	typedef std::function<void(const std::string &address, bool le)> RemovedCallback;
+
+	/**
+	 * @brief Create a table
+	 * @param capacity Maximum number of devices. Must be greater than zero.
+	 * @param maxAge Time in milliseconds after which a device which wasn't
+	 *        seen again is expired
+	 */
+	BluetoothDeviceTable(size_t capacity = 1024, uint64_t maxAge = 60000) :
+		entries(capacity),
+		maxAge(maxAge),
+		head(NONE),
+		tail(NONE),
+		freeList(NONE),
+		inserted(0),
+		evicted(0),
+		expired(0)
+	{
+		index.reserve(capacity);
+		resetFreeList();
+	}
+
+	/**
+	 * @brief Record that a device has been seen
+	 *
+	 *        If the table is full the least recently seen device is evicted and
+	 *        reported as removed.
+	 *
+	 * @param removed Called for an evicted device
+	 * @param address Address of the device
+	 * @param le True if the device was seen by a LE scan
+	 * @param now Current time of a monotonic clock in milliseconds
+	 * @return True if the device is new. False if it was already known or the
+	 *         address is invalid.
+	 */
+	bool touch(const RemovedCallback &removed, const BluetoothAddress &address, bool le, uint64_t now)
+	{
+		if (entries.empty() || !address.isValid())
+			return false;
+
+		auto iter = index.find(address);
+		if (iter != index.end())
+		{
+			Entry &entry = entries[iter->second];
+			entry.lastSeen = now;
+			entry.transports |= le ? TRANSPORT_LE : TRANSPORT_CLASSIC;
+			unlink(iter->second);
+			pushFront(iter->second);
+			return false;
+		}
+
+		if (freeList == NONE)
+		{
+			evicted++;
+			removeEntry(&removed, tail);
+		}
+
+		uint32_t slot = freeList;
+		freeList = entries[slot].next;
+
+		Entry &entry = entries[slot];
+		entry.address = address;
+		entry.lastSeen = now;
+		entry.transports = le ? TRANSPORT_LE : TRANSPORT_CLASSIC;
+		pushFront(slot);
+		index[address] = slot;
+
+		inserted++;
+		return true;
+	}
+
+	bool touch(const RemovedCallback &removed, const std::string &address, bool le, uint64_t now)
+	{
+		return touch(removed, BluetoothAddress(address), le, now);
+	}
+
+	/**
+	 * @brief Expire all devices not seen for longer than the maximum age
+	 * @param removed Called for every expired device
+	 * @param now Current time of a monotonic clock in milliseconds
+	 * @return Number of expired devices
+	 */
+	size_t expire(const RemovedCallback &removed, uint64_t now)
+	{
+		size_t count = 0;
+
+		// The least recently seen device is always at the tail
+		while (tail != NONE && now - entries[tail].lastSeen >= maxAge)
+		{
+			removeEntry(&removed, tail);
+			count++;
+		}
+
+		expired += count;
+		return count;
+	}
+
+	/**
+	 * @brief Check if a device is in the table
+	 * @param address Address of the device
+	 * @return True if the device is known
+	 */
+	bool contains(const BluetoothAddress &address) const
+	{
+		return index.count(address) > 0;
+	}
+
+	bool contains(const std::string &address) const
+	{
+		return contains(BluetoothAddress(address));
+	}
+
+	/**
+	 * @brief Remove a device without reporting it, e.g. when the stack
+	 *        already reported it as removed
+	 * @param address Address of the device
+	 * @return True if the device was known
+	 */
+	bool remove(const BluetoothAddress &address)
+	{
+		auto iter = index.find(address);
+		if (iter == index.end())
+			return false;
+
+		removeEntry(nullptr, iter->second);
+		return true;
+	}
+
+	bool remove(const std::string &address)
+	{
+		return remove(BluetoothAddress(address));
+	}
+
+	/**
+	 * @brief Remove all devices without reporting them and reset the
+	 *        counters
+	 */
+	void clear()
+	{
+		index.clear();
+		head = NONE;
+		tail = NONE;
+		resetFreeList();
+		inserted = 0;
+		evicted = 0;
+		expired = 0;
+	}
+
+	void setMaxAge(uint64_t age) { maxAge = age; }
+	uint64_t getMaxAge() const { return maxAge; }
+
+	size_t size() const { return index.size(); }
+	size_t capacity() const { return entries.size(); }
+
+	/**
+	 * @brief Retrieve the occupancy and the eviction counters
+	 * @return Current statistics
+	 */
+	Statistics getStatistics() const
+	{
+		Statistics statistics;
+		statistics.size = size();
+		statistics.capacity = capacity();
+		statistics.inserted = inserted;
+		statistics.evicted = evicted;
+		statistics.expired = expired;
+		return statistics;
+	}
+
+private:
+	static const uint32_t NONE = ~0U;
+
+	enum Transport
+	{
+		TRANSPORT_CLASSIC = 1 << 0,
+		TRANSPORT_LE = 1 << 1
+	};
+
+	struct Entry
+	{
+		Entry() : lastSeen(0), transports(0), prev(NONE), next(NONE) { }
+
+		BluetoothAddress address;
+		uint64_t lastSeen;
+		unsigned transports;
+		uint32_t prev;
+		uint32_t next;
+	};
+
+	void resetFreeList()
+	{
+		freeList = NONE;
+		for (uint32_t n = entries.size(); n > 0; n--)
+		{
+			entries[n - 1].next = freeList;
+			freeList = n - 1;
+		}
+	}
+
+	void pushFront(uint32_t slot)
+	{
+		entries[slot].prev = NONE;
+		entries[slot].next = head;
+		if (head != NONE)
+			entries[head].prev = slot;
+		head = slot;
+		if (tail == NONE)
+			tail = slot;
+	}
+
+	void unlink(uint32_t slot)
+	{
+		Entry &entry = entries[slot];
+
+		if (entry.prev != NONE)
+			entries[entry.prev].next = entry.next;
+		else
+			head = entry.next;
+
+		if (entry.next != NONE)
+			entries[entry.next].prev = entry.prev;
+		else
+			tail = entry.prev;
+	}
+
+	void removeEntry(const RemovedCallback *removed, uint32_t slot)
+	{
+		Entry &entry = entries[slot];
+
+		unlink(slot);
+		index.erase(entry.address);
+		entry.next = freeList;
+		freeList = slot;
+
+		if (!removed || !*removed)
+			return;
+
+		std::string address = entry.address.toString();
+		if (entry.transports & TRANSPORT_CLASSIC)
+			(*removed)(address, false);
+		if (entry.transports & TRANSPORT_LE)
+			(*removed)(address, true);
+	}
+
+	std::vector<Entry> entries;
+	std::unordered_map<BluetoothAddress, uint32_t> index;
+	uint64_t maxAge;
+	uint32_t head;
+	uint32_t tail;
+	uint32_t freeList;
+	uint64_t inserted;
+	uint64_t evicted;
+	uint64_t expired;
+};
+
+#endif
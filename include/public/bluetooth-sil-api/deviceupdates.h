@@ -0,0 +1,231 @@
+// Copyright (c) 2026 LG Electronics, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef BLUETOOTH_SIL_DEVICEUPDATES_H_
+#define BLUETOOTH_SIL_DEVICEUPDATES_H_
+
+#ifndef BLUETOOTH_SIL_H_
+	#error This header file should only be included by bluetooth-sil-api.h
+#endif
+
+#include <algorithm>
+#include <unordered_map>
+
+/**
+ * @brief Collects discovery events and delivers them in batches through
+ *        BluetoothAdapterStatusObserver::devicesUpdated.
+ *
+ *        SIL implementations opting into batched delivery pass found devices
+ *        and property changes to the batcher instead of calling the observer
+ *        directly. A batch is delivered when it reaches the maximum batch size
+ *        or when the flush interval has elapsed after its first event.
+ *
+ *        Repeated property changes of a device within the same batch are
+ *        merged into a single update carrying the latest value of every
+ *        property.
+ *
+ *        The batcher doesn't depend on a main loop itself. Once the first
+ *        event of a batch is queued it calls the schedule callback with the
+ *        flush interval; the SIL then arms a timer in its GMainLoop which
+ *        calls flush():
+ *
+ *            batcher.setScheduleCallback([this](uint32_t interval) {
+ *                g_timeout_add(interval, [](gpointer data) -> gboolean {
+ *                    static_cast<Adapter*>(data)->batcher.flush();
+ *                    return FALSE;
+ *                }, this);
+ *            });
+ *
+ *        Without a schedule callback batches are only delivered when full or
+ *        on an explicit flush(). The batcher isn't thread-safe.
+ */
+class BluetoothDeviceUpdateBatcher
+{
+public:
+	typedef std::function<void(uint32_t interval)> ScheduleCallback;
+
+	/**
+	 * @brief Create a batcher
+	 * @param observer Observer the batches are delivered to
+	 * @param flushInterval Maximum time in milliseconds an event is held back
+	 * @param maxBatchSize Maximum number of updates in a single batch
+	 */
+	BluetoothDeviceUpdateBatcher(BluetoothAdapterStatusObserver *observer, uint32_t flushInterval = 100,
+	                             size_t maxBatchSize = 64) :
+		observer(observer),
+		flushInterval(flushInterval),
+		maxBatchSize(maxBatchSize ? maxBatchSize : 1),
+		flushScheduled(false),
+		delivering(false)
+	{
+		pending.reserve(this->maxBatchSize);
+	}
+
+	void setObserver(BluetoothAdapterStatusObserver *observer) { this->observer = observer; }
+
+	void setScheduleCallback(ScheduleCallback callback) { scheduleCallback = std::move(callback); }
+
+	void setFlushInterval(uint32_t interval) { flushInterval = interval; }
+	uint32_t getFlushInterval() const { return flushInterval; }
+
+	void setMaxBatchSize(size_t size) { maxBatchSize = size ? size : 1; }
+	size_t getMaxBatchSize() const { return maxBatchSize; }
+
+	void deviceFound(BluetoothPropertiesList properties)
+	{
+		queue(BluetoothDeviceUpdate::DEVICE_FOUND, std::string(), std::move(properties));
+	}
+
+	void deviceFound(const std::string &address, BluetoothPropertiesList properties)
+	{
+		queue(BluetoothDeviceUpdate::DEVICE_FOUND, address, std::move(properties));
+	}
+
+	void devicePropertiesChanged(const std::string &address, BluetoothPropertiesList properties)
+	{
+		queue(BluetoothDeviceUpdate::DEVICE_PROPERTIES_CHANGED, address, std::move(properties));
+	}
+
+	void leDeviceFound(const std::string &address, BluetoothPropertiesList properties)
+	{
+		queue(BluetoothDeviceUpdate::LE_DEVICE_FOUND, address, std::move(properties));
+	}
+
+	void leDevicePropertiesChanged(const std::string &address, BluetoothPropertiesList properties)
+	{
+		queue(BluetoothDeviceUpdate::LE_DEVICE_PROPERTIES_CHANGED, address, std::move(properties));
+	}
+
+	/**
+	 * @brief Notify the observer about a removed device
+	 *
+	 *        Pending updates are delivered first, so the observer never sees
+	 *        an update of a device after its removal.
+	 *
+	 * @param address Address of the device
+	 */
+	void deviceRemoved(const std::string &address)
+	{
+		flush();
+		observer->deviceRemoved(address);
+	}
+
+	/**
+	 * @brief Notify the observer about a removed LE device after delivering
+	 *        the pending updates
+	 * @param address Address of the device
+	 */
+	void leDeviceRemoved(const std::string &address)
+	{
+		flush();
+		observer->leDeviceRemoved(address);
+	}
+
+	/**
+	 * @brief Deliver all pending updates
+	 *
+	 *        Does nothing if no update is pending. Updates queued by the
+	 *        observer while the batch is delivered are part of the next batch.
+	 */
+	void flush()
+	{
+		// Called again by the observer while a batch is delivered
+		if (delivering)
+			return;
+
+		flushScheduled = false;
+
+		if (pending.empty())
+			return;
+
+		batch.swap(pending);
+		merged.clear();
+
+		delivering = true;
+		observer->devicesUpdated(batch);
+		delivering = false;
+
+		batch.clear();
+	}
+
+	/**
+	 * @brief Retrieve the number of pending updates
+	 * @return Number of updates
+	 */
+	size_t size() const { return pending.size(); }
+
+private:
+	void queue(BluetoothDeviceUpdate::Type type, const std::string &address, BluetoothPropertiesList &&properties)
+	{
+		BluetoothAddress packed(address);
+		bool mergeable = packed.isValid() &&
+		                 (type == BluetoothDeviceUpdate::DEVICE_PROPERTIES_CHANGED ||
+		                  type == BluetoothDeviceUpdate::LE_DEVICE_PROPERTIES_CHANGED);
+
+		if (mergeable)
+		{
+			// The address takes the lower 48 bits of the key
+			uint64_t key = packed.toUInt64() | (static_cast<uint64_t>(type) << 48);
+			auto iter = merged.find(key);
+			if (iter != merged.end())
+			{
+				mergeProperties(pending[iter->second].properties, std::move(properties));
+				return;
+			}
+
+			merged[key] = pending.size();
+		}
+
+		pending.push_back(BluetoothDeviceUpdate(type, address, std::move(properties)));
+
+		if (pending.size() >= maxBatchSize)
+			flush();
+
+		if (!pending.empty() && !flushScheduled && scheduleCallback)
+		{
+			flushScheduled = true;
+			scheduleCallback(flushInterval);
+		}
+	}
+
+	static void mergeProperties(BluetoothPropertiesList &target, BluetoothPropertiesList &&properties)
+	{
+		for (auto &property : properties)
+		{
+			auto iter = std::find_if(target.begin(), target.end(), [&property](const BluetoothProperty &current) {
+				return current.getType() == property.getType();
+			});
+
+			if (iter != target.end())
+				*iter = std::move(property);
+			else
+				target.push_back(std::move(property));
+		}
+	}
+
+	BluetoothAdapterStatusObserver *observer;
+	uint32_t flushInterval;
+	size_t maxBatchSize;
+	bool flushScheduled;
+	bool delivering;
+	ScheduleCallback scheduleCallback;
+	BluetoothDeviceUpdateList pending;
+	BluetoothDeviceUpdateList batch;
+	// Index of the pending property change per device and update type
+	std::unordered_map<uint64_t, size_t> merged;
+};
+
+#endif
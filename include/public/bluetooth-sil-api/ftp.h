@@ -87,19 +87,10 @@ public:
 	 * @brief Copy c'tor
 	 * @param other Other element to copy from.
 	 */
-	BluetoothFtpElement(const BluetoothFtpElement &other) :
-		fieldsSet(other.fieldsSet),
-		name(other.getName()),
-		type(other.getType()),
-		size(other.getSize()),
-		userPermission(other.getUserPermission()),
-		groupPermission(other.getGroupPermission()),
-		otherPermission(other.getOtherPermission()),
-		modifiedTime(other.getModifiedTime()),
-		accessedTime(other.getAccessedTime()),
-		createdTime(other.getCreatedTime())
-	{
-	}
+	BluetoothFtpElement(const BluetoothFtpElement &other) = default;
+	BluetoothFtpElement(BluetoothFtpElement &&other) = default;
+	BluetoothFtpElement& operator =(const BluetoothFtpElement &other) = default;
+	BluetoothFtpElement& operator =(BluetoothFtpElement &&other) = default;
 
 	/**
 	 * @brief Check if a field is set.
@@ -116,7 +107,8 @@ public:
 	 * @brief Returns the name of the element.
 	 * @return Name of the element
 	 */
-	std::string getName() const { return name; }
+	const std::string& getName() const & { return name; }
+	std::string getName() && { return std::move(name); }
 
 	/**
 	 * @brief Returns the type of the element.
@@ -202,6 +194,7 @@ public:
 	 * @param name Name of the element
 	 */
 	void setName(const std::string &name) { this->name = name; }
+	void setName(std::string &&name) { this->name = std::move(name); }
 
 	/**
 	 * @brief Set the type of the element.
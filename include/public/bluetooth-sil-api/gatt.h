@@ -123,6 +123,75 @@ enum BluetoothGattTransportMode
 	GATT_TRANSPORT_MODE_LE_BR_EDR = 0x03,
 };
 
+/**
+ * @brief LE PHYs. Combined into a BluetoothLePhyMask to express preferences.
+ *
+ *        See Bluetooth Specification Core 5.0 vol 2 Part E chapter 7.8.49
+ */
+enum BluetoothLePhy
+{
+	LE_PHY_1M = 0x01,
+	LE_PHY_2M = 0x02,
+	LE_PHY_CODED = 0x04,
+};
+
+/**
+ * @brief Bit field of BluetoothLePhy values
+ */
+typedef uint8_t BluetoothLePhyMask;
+
+/**
+ * @brief Callback which is called to provide the result of BluetoothGattProfile::requestMtu
+ */
+typedef std::function<void(BluetoothError, uint16_t mtu)> BluetoothGattMtuCallback;
+
+/**
+ * @brief Link layer and ATT sizes for choosing throughput oriented link settings.
+ *
+ *        With Data Length Extension a link layer PDU carries up to 251 octets.
+ *        An ATT MTU of 247 fills it completely together with the L2CAP header,
+ *        so bulk transfers like firmware updates should request both.
+ */
+struct BluetoothLeDataLength
+{
+	/// Payload octets of a link layer PDU without Data Length Extension
+	static constexpr uint16_t minOctets() { return 27; }
+
+	/// Maximum payload octets of a link layer PDU
+	static constexpr uint16_t maxOctets() { return 251; }
+
+	/// Minimum ATT MTU on LE
+	static constexpr uint16_t minMtu() { return 23; }
+
+	/// Maximum ATT MTU, an attribute value of 512 octets plus the ATT header
+	static constexpr uint16_t maxMtu() { return 517; }
+
+	/**
+	 * @brief Largest ATT MTU whose PDUs fit into a single link layer PDU
+	 * @param octets Payload octets of the link layer PDU
+	 * @return MTU without the 4 octets of the L2CAP header
+	 */
+	static constexpr uint16_t mtuForOctets(uint16_t octets) { return octets - 4; }
+
+	/**
+	 * @brief Time needed to transmit a link layer PDU, as passed to
+	 *        BluetoothGattProfile::setDataLength
+	 *
+	 *        Includes the MIC of encrypted links. LE Coded is calculated for
+	 *        S=8 coding which takes the longest.
+	 *
+	 * @param octets Payload octets of the link layer PDU
+	 * @param phy PHY the PDU is sent on
+	 * @return Time in microseconds
+	 */
+	static constexpr uint16_t txTime(uint16_t octets, BluetoothLePhy phy)
+	{
+		return phy == LE_PHY_2M ? (octets + 15) * 4 :
+		       phy == LE_PHY_CODED ? 400 + (octets + 9) * 64 :
+		       (octets + 14) * 8;
+	}
+};
+
 /**
  * @brief Write type of GATT characteristic/descriptor.
  */
@@ -180,14 +249,10 @@ public:
 	* @brief Copy c'tor
     * @param other Other descriptor object to copy from
     */
-	BluetoothGattDescriptor(const BluetoothGattDescriptor &other) :
-	    uuid(other.uuid),
-	    value(other.value),
-	    permissions(other.permissions),
-	    write_type(other.write_type),
-	    handle(other.handle)
-	{
-	}
+	BluetoothGattDescriptor(const BluetoothGattDescriptor &other) = default;
+	BluetoothGattDescriptor(BluetoothGattDescriptor &&other) = default;
+	BluetoothGattDescriptor& operator =(const BluetoothGattDescriptor &other) = default;
+	BluetoothGattDescriptor& operator =(BluetoothGattDescriptor &&other) = default;
 
 	/**
 	 * @brief Check if the descriptor is valid or not
@@ -215,6 +280,7 @@ public:
 	 * @param value Value to set
 	 */
 	void setValue(const BluetoothGattValue &value) { this->value = value; }
+	void setValue(BluetoothGattValue &&value) { this->value = std::move(value); }
 
 	/**
 	 * @brief Set permissions of the characteristic
@@ -239,7 +305,8 @@ public:
 	 * @brief Retrieve the value of the descriptor
 	 * @return Value of the descriptor
 	 */
-	BluetoothGattValue getValue() const { return value; }
+	const BluetoothGattValue& getValue() const & { return value; }
+	BluetoothGattValue getValue() && { return std::move(value); }
 
 	/**
 	 * @brief Set handle of the characteristic
@@ -318,16 +385,10 @@ public:
 	 * @brief Copy c'tor
 	 * @param other Other characteristic object to copy from
 	 */
-	BluetoothGattCharacteristic(const BluetoothGattCharacteristic &other) :
-	    uuid(other.uuid),
-	    value(other.value),
-	    descriptors(other.descriptors),
-	    properties(other.properties),
-	    permissions(other.permissions),
-	    write_type(other.write_type),
-	    handle(other.handle)
-	{
-	}
+	BluetoothGattCharacteristic(const BluetoothGattCharacteristic &other) = default;
+	BluetoothGattCharacteristic(BluetoothGattCharacteristic &&other) = default;
+	BluetoothGattCharacteristic& operator =(const BluetoothGattCharacteristic &other) = default;
+	BluetoothGattCharacteristic& operator =(BluetoothGattCharacteristic &&other) = default;
 
 	/**
 	 * @brief Checks if the characteristic is a valid one.
@@ -380,13 +441,15 @@ public:
 	 * @brief Set the value of the characteristic
 	 * @param value Value to set
 	 */
-	void setValue(BluetoothGattValue value) { this->value = value; }
+	void setValue(const BluetoothGattValue &value) { this->value = value; }
+	void setValue(BluetoothGattValue &&value) { this->value = std::move(value); }
 
 	/**
 	 * @brief Return the value of the characteristic
 	 * @return Value of the characteristic
 	 */
-	BluetoothGattValue getValue() const { return value; }
+	const BluetoothGattValue& getValue() const & { return value; }
+	BluetoothGattValue getValue() && { return std::move(value); }
 
 	/**
 	 * @brief Set permissions of the characteristic
@@ -411,19 +474,26 @@ public:
 	 * @brief Add a descriptor to the characteristic
 	 * @param descriptor Descriptor to be added
 	 */
-	void addDescriptor(BluetoothGattDescriptor descriptor) { descriptors.insert(std::pair<BluetoothUuid, BluetoothGattDescriptor>(descriptor.getUuid(), descriptor)); }
+	void addDescriptor(const BluetoothGattDescriptor &descriptor)
+	{
+		if (!findDescriptor(descriptor.getUuid()))
+			descriptors.push_back(descriptor);
+	}
+	void addDescriptor(BluetoothGattDescriptor &&descriptor)
+	{
+		if (!findDescriptor(descriptor.getUuid()))
+			descriptors.push_back(std::move(descriptor));
+	}
 
 	/**
 	 * @brief Get the list of descriptors which are part of the characteristic
+	 *
+	 *        Descriptors are kept in the order they were added. A descriptor with
+	 *        the UUID of one which was already added is ignored.
+	 *
 	 * @return List of descriptors
 	 */
-	BluetoothGattDescriptorList getDescriptors() const
-	{
-		std::vector<BluetoothGattDescriptor> result;
-		for (auto iter = descriptors.begin(); iter != descriptors.end(); ++iter)
-			result.push_back(iter->second);
-		return result;
-	}
+	const BluetoothGattDescriptorList& getDescriptors() const { return descriptors; }
 
 	/**
 	 * @brief Get a single descriptor identified by its UUID
@@ -433,11 +503,29 @@ public:
 	 */
 	BluetoothGattDescriptor getDescriptor(const BluetoothUuid &uuid) const
 	{
-		auto iter = descriptors.find(uuid);
-		if (iter == descriptors.end())
+		const BluetoothGattDescriptor *descriptor = findDescriptor(uuid);
+		if (!descriptor)
 			return BluetoothGattDescriptor();
 
-		return iter->second;
+		return *descriptor;
+	}
+
+	/**
+	 * @brief Find a single descriptor identified by its UUID without copying it
+	 *
+	 * @param uuid UUID of the descriptor to find
+	 * @return Pointer to the descriptor or nullptr if not found. The pointer stays
+	 *         valid as long as the characteristic isn't modified or destroyed.
+	 */
+	const BluetoothGattDescriptor* findDescriptor(const BluetoothUuid &uuid) const
+	{
+		for (auto &descriptor : descriptors)
+		{
+			if (descriptor.getUuid() == uuid)
+				return &descriptor;
+		}
+
+		return nullptr;
 	}
 	/**
 	 * @brief Update the handle of a specific descriptor
@@ -455,15 +543,15 @@ public:
 
 		for (; iter != descriptors.end(); iter++)
 		{
-			if (iter->second.getUuid() == descriptor.getUuid() &&
-				iter->second.isPermissionSet(descriptor.getPermissions()))
+			if (iter->getUuid() == descriptor.getUuid() &&
+				iter->isPermissionSet(descriptor.getPermissions()))
 				break;
 		}
 
 		if (iter == descriptors.end())
 			return false;
 
-		iter->second.setHandle(handle);
+		iter->setHandle(handle);
 
 		return true;
 	}
@@ -483,14 +571,14 @@ public:
 
 		for (; iter != descriptors.end(); iter++)
 		{
-			if (iter->second.getUuid() == descriptor)
+			if (iter->getUuid() == descriptor)
 				break;
 		}
 
 		if (iter == descriptors.end())
 			return false;
 
-		iter->second.setValue(value);
+		iter->setValue(value);
 
 		return true;
 	}
@@ -521,7 +609,7 @@ public:
 private:
 	BluetoothUuid uuid;
 	BluetoothGattValue value;
-	std::map<BluetoothUuid, BluetoothGattDescriptor> descriptors;
+	BluetoothGattDescriptorList descriptors;
 	BluetoothGattCharacteristicProperties properties;
 	BluetoothGattCharacteristicPermissions permissions;
 	uint16_t handle;
@@ -576,13 +664,10 @@ public:
 	 * @brief Copy c'tor
 	 * @param other Other service object to copy from
 	 */
-	BluetoothGattService(const BluetoothGattService &other) :
-	    uuid(other.uuid),
-	    type(other.type),
-	    includes(other.includes),
-	    characteristics(other.characteristics)
-	{
-	}
+	BluetoothGattService(const BluetoothGattService &other) = default;
+	BluetoothGattService(BluetoothGattService &&other) = default;
+	BluetoothGattService& operator =(const BluetoothGattService &other) = default;
+	BluetoothGattService& operator =(BluetoothGattService &&other) = default;
 
 	/**
 	 * @brief Checks if the service is valid.
@@ -599,7 +684,7 @@ public:
 	 *
 	 * @param uuid UUID of the service
 	 */
-	void setUuid(BluetoothUuid uuid) { this->uuid = uuid; }
+	void setUuid(const BluetoothUuid &uuid) { this->uuid = uuid; }
 
 	/**
 	 * @brief Retrieve the UUID of the service
@@ -627,28 +712,30 @@ public:
 	 *
 	 * @param service GATT service object to be included
 	 */
-	void includeService(BluetoothGattService service) { includes.push_back(service.getUuid()); }
+	void includeService(const BluetoothGattService &service) { includes.push_back(service.getUuid()); }
 
 	/**
 	 * @brief Include another GATT service
 	 *
 	 * @param uuid UUID of the GATT service object to be included
 	 */
-	void includeService(BluetoothUuid uuid) { includes.push_back(uuid); }
+	void includeService(const BluetoothUuid &uuid) { includes.push_back(uuid); }
 
 	/**
 	 * @brief Retrieve a list of included services
 	 *
 	 * @return List of included services
 	 */
-	BluetoothUuidList getIncludedServices() const { return includes; }
+	const BluetoothUuidList& getIncludedServices() const & { return includes; }
+	BluetoothUuidList getIncludedServices() && { return std::move(includes); }
 
 	/**
 	 * @brief Add a characteristic to the service
 	 *
 	 * @param characteristic Characteristic to be added to the service
 	 */
-	void addCharacteristic(BluetoothGattCharacteristic characteristic) { characteristics.push_back(characteristic); }
+	void addCharacteristic(const BluetoothGattCharacteristic &characteristic) { characteristics.push_back(characteristic); }
+	void addCharacteristic(BluetoothGattCharacteristic &&characteristic) { characteristics.push_back(std::move(characteristic)); }
 	/**
 	 * @brief Update the handle of a specific characteristic
 	 *
@@ -753,13 +840,15 @@ public:
 	 * @param characteristics Set of new characteristics to store.
 	 */
 	void setCharacteristics(const BluetoothGattCharacteristicList &characteristics) { this->characteristics = characteristics; }
+	void setCharacteristics(BluetoothGattCharacteristicList &&characteristics) { this->characteristics = std::move(characteristics); }
 
 	/**
 	 * @brief Get the list of characteristics which are part of the service
 	 *
 	 * @return List of characteristics of the service
 	 */
-	BluetoothGattCharacteristicList getCharacteristics() const { return characteristics; }
+	const BluetoothGattCharacteristicList& getCharacteristics() const & { return characteristics; }
+	BluetoothGattCharacteristicList getCharacteristics() && { return std::move(characteristics); }
 
 	/**
 	 * @brief Get a specific characteristic from the service.
@@ -778,6 +867,24 @@ public:
 		return BluetoothGattCharacteristic();
 	}
 
+	/**
+	 * @brief Find a specific characteristic of the service without copying it.
+	 *
+	 * @param uuid UUID of the characteristic
+	 * @return Pointer to the characteristic or nullptr if not found. The pointer
+	 *         stays valid as long as the service isn't modified or destroyed.
+	 */
+	const BluetoothGattCharacteristic* findCharacteristic(const BluetoothUuid &uuid) const
+	{
+		for (auto &characteristic : characteristics)
+		{
+			if (characteristic.getUuid() == uuid)
+				return &characteristic;
+		}
+
+		return nullptr;
+	}
+
 private:
 	BluetoothUuid uuid;
 	Type type;
@@ -785,6 +892,90 @@ private:
 	std::vector<BluetoothGattCharacteristic> characteristics;
 };
 
+/**
+ * @brief Defines how notifications and indications of a watched characteristic
+ *        are delivered to the BluetoothGattProfileStatusObserver.
+ *
+ *        See BluetoothGattProfile::setCharacteristicNotificationDelivery.
+ */
+struct BluetoothGattNotificationDelivery
+{
+	enum Mode
+	{
+		/// characteristicValueChanged with a complete characteristic object
+		CHARACTERISTIC,
+		/// characteristicValueNotified with the borrowed value for every notification
+		VALUE,
+		/// characteristicValuesNotified with the values collected over a batch interval
+		BATCH
+	};
+
+	BluetoothGattNotificationDelivery(Mode mode = CHARACTERISTIC, uint32_t batchInterval = 0, size_t maxBatchSize = 0) :
+		mode(mode),
+		batchInterval(batchInterval),
+		maxBatchSize(maxBatchSize)
+	{
+	}
+
+	Mode mode;
+	/// Maximum time in milliseconds a value is held back in BATCH mode
+	uint32_t batchInterval;
+	/// Maximum number of values of a batch in BATCH mode. 0 for no limit.
+	size_t maxBatchSize;
+};
+
+/**
+ * @brief Values of a characteristic collected in BATCH delivery mode.
+ *
+ *        The batch borrows the memory of the SIL. It is only valid during the
+ *        call of BluetoothGattProfileStatusObserver::characteristicValuesNotified;
+ *        observers copy the values they keep.
+ */
+class BluetoothGattNotificationBatch
+{
+public:
+	/**
+	 * @param data Values stored back to back
+	 * @param offsets Offsets of the values in data followed by the end of the
+	 *        last value, count + 1 entries
+	 * @param timestamps Time in milliseconds every value was received
+	 * @param count Number of values
+	 */
+	BluetoothGattNotificationBatch(const uint8_t *data, const uint32_t *offsets, const uint64_t *timestamps, size_t count) :
+		data(data),
+		offsets(offsets),
+		timestamps(timestamps),
+		count(count)
+	{
+	}
+
+	size_t size() const { return count; }
+	bool empty() const { return count == 0; }
+
+	/**
+	 * @brief Retrieve a value of the batch
+	 * @param index Index of the value in the order of reception
+	 * @return Value
+	 */
+	BluetoothByteSpan operator[](size_t index) const
+	{
+		return BluetoothByteSpan(data + offsets[index], offsets[index + 1] - offsets[index]);
+	}
+
+	/**
+	 * @brief Retrieve the time a value was received
+	 * @param index Index of the value in the order of reception
+	 * @return Time in milliseconds
+	 */
+	uint64_t getTimestamp(size_t index) const { return timestamps[index]; }
+
+private:
+	const uint8_t *data;
+	const uint32_t *offsets;
+	const uint64_t *timestamps;
+	size_t count;
+};
+
 /**
  * @brief This interface is the base to implement an observer for the Bluetooth
  *        GATT profile to get notifications from the profile when something has changed.
@@ -835,6 +1026,56 @@ public:
 	 */
 	virtual void characteristicValueChanged(const BluetoothUuid &service, const BluetoothGattCharacteristic &characteristic, const std::string &adapterAddress) { }
 
+	/**
+	 * @brief This method is called for every notification or indication of a
+	 *        characteristic watched in VALUE delivery mode.
+	 *
+	 *        No characteristic object is created for the call, which makes it
+	 *        suitable for high rate sensors. The value is borrowed from the SIL
+	 *        and only valid during the call.
+	 *
+	 * @param connId ID of the remote device
+	 * @param handle Handle of the characteristic value
+	 * @param value New value of the characteristic
+	 */
+	virtual void characteristicValueNotified(uint16_t connId, uint16_t handle, BluetoothByteSpan value) { }
+
+	/**
+	 * @brief This method is called with the values of a characteristic watched
+	 *        in BATCH delivery mode.
+	 *
+	 *        The default implementation calls characteristicValueNotified for
+	 *        every value of the batch.
+	 *
+	 * @param connId ID of the remote device
+	 * @param handle Handle of the characteristic value
+	 * @param values Values in the order they were received
+	 */
+	virtual void characteristicValuesNotified(uint16_t connId, uint16_t handle, const BluetoothGattNotificationBatch &values)
+	{
+		for (size_t n = 0; n < values.size(); n++)
+			characteristicValueNotified(connId, handle, values[n]);
+	}
+
+	/**
+	 * @brief This method is called when the ATT MTU of a connection has changed,
+	 *        either through BluetoothGattProfile::requestMtu or an exchange
+	 *        started by the remote device.
+	 *
+	 * @param connId ID of the remote device
+	 * @param mtu New MTU
+	 */
+	virtual void mtuChanged(uint16_t connId, uint16_t mtu) { }
+
+	/**
+	 * @brief This method is called when the PHYs of a connection have changed.
+	 *
+	 * @param connId ID of the remote device
+	 * @param txPhy PHY used for transmitting
+	 * @param rxPhy PHY used for receiving
+	 */
+	virtual void phyUpdated(uint16_t connId, BluetoothLePhy txPhy, BluetoothLePhy rxPhy) { }
+
 	/**
 	 * @brief This method is called when the value of a specific descriptor of the
 	 *        local adapter has changed.
@@ -1092,6 +1333,90 @@ public:
 		if (callback) callback(BLUETOOTH_ERROR_UNSUPPORTED);
 	}
 
+	/**
+	 * @brief Select how value changes of a watched characteristic are delivered.
+	 *
+	 *        By default value changes are reported through characteristicValueChanged.
+	 *        The VALUE and BATCH modes report them through characteristicValueNotified
+	 *        and characteristicValuesNotified of the registered
+	 *        BluetoothGattProfileStatusObserver instead, without creating a
+	 *        characteristic object for every notification. The mode applies until
+	 *        it is changed again or the device disconnects.
+	 *
+	 * @param connId ID of remote device
+	 * @param handle Handle of the characteristic value
+	 * @param delivery Delivery mode
+	 * @param callback Callback function which is called when the operation is done or
+	 *        has failed.
+	 */
+	virtual void setCharacteristicNotificationDelivery(const uint16_t &connId, const uint16_t &handle,
+	                                                   const BluetoothGattNotificationDelivery &delivery,
+	                                                   BluetoothResultCallback callback)
+	{
+		if (callback) callback(BLUETOOTH_ERROR_UNSUPPORTED);
+	}
+
+	/**
+	 * @brief Exchange the ATT MTU with a remote device.
+	 *
+	 *        The resulting MTU is the smaller one of the requested MTU and the
+	 *        one of the remote device. ATT allows a single exchange per
+	 *        connection; later calls report the current MTU. Writes longer than
+	 *        the MTU allows are split into Prepare Write requests automatically.
+	 *
+	 *        A changed MTU is also reported through the mtuChanged method of the
+	 *        BluetoothGattProfileStatusObserver observer instance registered with
+	 *        the profile.
+	 *
+	 * @param connId ID of remote device
+	 * @param mtu MTU to request. BluetoothLeDataLength::mtuForOctets(BluetoothLeDataLength::maxOctets())
+	 *        fills a link layer PDU of maximum size.
+	 * @param callback Callback function which is called with the resulting MTU when
+	 *        the operation is done or has failed.
+	 */
+	virtual void requestMtu(const uint16_t &connId, uint16_t mtu, BluetoothGattMtuCallback callback)
+	{
+		if (callback) callback(BLUETOOTH_ERROR_UNSUPPORTED, BluetoothLeDataLength::minMtu());
+	}
+
+	/**
+	 * @brief Set the preferred PHYs of a connection.
+	 *
+	 *        The controller negotiates the PHYs with the remote device. The
+	 *        result is reported through the phyUpdated method of the
+	 *        BluetoothGattProfileStatusObserver observer instance registered
+	 *        with the profile.
+	 *
+	 * @param connId ID of remote device
+	 * @param txPhys PHYs preferred for transmitting
+	 * @param rxPhys PHYs preferred for receiving
+	 * @param callback Callback function which is called when the request was passed
+	 *        to the controller or has failed.
+	 */
+	virtual void setPreferredPhy(const uint16_t &connId, BluetoothLePhyMask txPhys, BluetoothLePhyMask rxPhys,
+	                             BluetoothResultCallback callback)
+	{
+		if (callback) callback(BLUETOOTH_ERROR_UNSUPPORTED);
+	}
+
+	/**
+	 * @brief Set the maximum size of the link layer PDUs sent on a connection
+	 *        (LE Data Length Extension).
+	 *
+	 * @param connId ID of remote device
+	 * @param txOctets Maximum payload octets. BluetoothLeDataLength::maxOctets() for bulk
+	 *        transfers.
+	 * @param txTime Maximum time in microseconds to transmit a PDU, see
+	 *        BluetoothLeDataLength::txTime. 0 lets the implementation derive it
+	 *        from txOctets for the PHY in use.
+	 * @param callback Callback function which is called when the operation is done or
+	 *        has failed.
+	 */
+	virtual void setDataLength(const uint16_t &connId, uint16_t txOctets, uint16_t txTime, BluetoothResultCallback callback)
+	{
+		if (callback) callback(BLUETOOTH_ERROR_UNSUPPORTED);
+	}
+
 	/**
 	 * @brief Read a characteristic for a remote device.
 	 *
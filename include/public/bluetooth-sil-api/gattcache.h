@@ -0,0 +1,568 @@
+// Copyright (c) 2026 LG Electronics, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef BLUETOOTH_SIL_GATTCACHE_H_
+#define BLUETOOTH_SIL_GATTCACHE_H_
+
+#ifndef BLUETOOTH_SIL_H_
+	#error This header file should only be included by bluetooth-sil-api.h
+#endif
+
+#include <cerrno>
+#include <cstdio>
+#include <cstring>
+#include <map>
+
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+/**
+ * @brief Persistent cache of the GATT databases of bonded devices.
+ *
+ *        SIL implementations store the database of a bonded device after the
+ *        service discovery and load it on the next connection instead of
+ *        discovering again, so getServices and getService can be answered
+ *        right after the reconnect. The cached database is validated with the
+ *        Database Hash characteristic of the device if it has one; otherwise
+ *        the Service Changed indication sent by bonded devices after a change
+ *        is passed to serviceChanged.
+ *
+ *        All databases are kept in a single file which is memory mapped by
+ *        open(). The file starts with a directory sorted by address, followed
+ *        by the databases in the form of BluetoothGattDatabase::serialize:
+ *
+ *            header     "BTGC", version, number of entries, reserved (4 x 32 bit)
+ *            directory  per entry: address (64 bit), offset (64 bit),
+ *                       length (32 bit), hash length (8 bit), 3 reserved bytes,
+ *                       database hash (16 bytes)
+ *            databases
+ *
+ *        All integers are little endian. open() only checks the header and the
+ *        directory, a database is decoded when it's loaded. Changes are kept in
+ *        memory until save() writes a new file and replaces the old one
+ *        atomically.
+ *
+ *        The cache isn't thread-safe.
+ */
+class BluetoothGattCache
+{
+public:
+	static const uint32_t VERSION = 1;
+
+	/**
+	 * @brief Create a cache
+	 * @param path Path of the cache file
+	 */
+	BluetoothGattCache(const std::string &path) :
+		path(path),
+		mapping(nullptr),
+		mappingSize(0),
+		entryCount(0)
+	{
+	}
+
+	~BluetoothGattCache()
+	{
+		unmap();
+	}
+
+	BluetoothGattCache(const BluetoothGattCache &other) = delete;
+	BluetoothGattCache& operator =(const BluetoothGattCache &other) = delete;
+
+	/**
+	 * @brief Map the cache file
+	 *
+	 *        Unsaved changes are dropped.
+	 *
+	 * @return True if the file was mapped or doesn't exist yet. False if it
+	 *         can't be read or is malformed; the cache is empty then.
+	 */
+	bool open()
+	{
+		unmap();
+		changes.clear();
+
+		int fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+		if (fd < 0)
+			return errno == ENOENT;
+
+		struct stat info;
+		bool result = fstat(fd, &info) == 0;
+
+		if (result && info.st_size > 0)
+		{
+			void *address = mmap(nullptr, info.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+			result = address != MAP_FAILED;
+
+			if (result)
+			{
+				mapping = static_cast<const uint8_t*>(address);
+				mappingSize = info.st_size;
+				result = validateMapping();
+
+				if (!result)
+					unmap();
+			}
+		}
+
+		close(fd);
+		return result;
+	}
+
+	/**
+	 * @brief Write all changes to the cache file
+	 *
+	 *        The new content is written to a temporary file which then replaces
+	 *        the cache file, so a crash never leaves a partially written cache.
+	 *
+	 * @return True on success or if nothing changed. False if the file can't be
+	 *         written; the changes are kept then.
+	 */
+	bool save()
+	{
+		if (changes.empty())
+			return true;
+
+		std::vector<uint8_t> content;
+		std::vector<Entry> entries;
+		collectEntries(entries);
+
+		size_t offset = HEADER_SIZE + entries.size() * DIRECTORY_ENTRY_SIZE;
+		content.reserve(offset);
+		content.insert(content.end(), magic(), magic() + 4);
+		writeUInt32(content, VERSION);
+		writeUInt32(content, entries.size());
+		writeUInt32(content, 0);
+
+		for (auto &entry : entries)
+		{
+			writeUInt64(content, entry.address.toUInt64());
+			writeUInt64(content, offset);
+			writeUInt32(content, entry.size);
+			content.push_back(entry.hashLength);
+			content.insert(content.end(), 3, 0);
+			content.insert(content.end(), entry.hash, entry.hash + MAX_HASH_LENGTH);
+			offset += entry.size;
+		}
+
+		for (auto &entry : entries)
+			content.insert(content.end(), entry.data, entry.data + entry.size);
+
+		std::string temporaryPath = path + ".tmp";
+		if (!writeFile(temporaryPath, content))
+			return false;
+
+		if (rename(temporaryPath.c_str(), path.c_str()) != 0)
+		{
+			unlink(temporaryPath.c_str());
+			return false;
+		}
+
+		return open();
+	}
+
+	/**
+	 * @brief Store the database of a device
+	 * @param address Address of the device
+	 * @param db Database of the device
+	 * @param databaseHash Value of the Database Hash characteristic or empty if
+	 *        the device doesn't have one
+	 * @return True on success. False if the address is invalid, the hash is
+	 *         longer than 16 bytes or the database can't be serialized.
+	 */
+	bool store(const BluetoothAddress &address, const BluetoothGattDatabase &db,
+	           const BluetoothGattValue &databaseHash = BluetoothGattValue())
+	{
+		if (!address.isValid() || databaseHash.size() > MAX_HASH_LENGTH)
+			return false;
+
+		Change change;
+		if (!db.serialize(change.data))
+			return false;
+
+		change.removed = false;
+		change.hash = databaseHash;
+		changes[address] = std::move(change);
+		return true;
+	}
+
+	bool store(const std::string &address, const BluetoothGattDatabase &db,
+	           const BluetoothGattValue &databaseHash = BluetoothGattValue())
+	{
+		return store(BluetoothAddress(address), db, databaseHash);
+	}
+
+	/**
+	 * @brief Load the cached database of a device
+	 * @param address Address of the device
+	 * @param db Receives the database
+	 * @return True if a valid database is cached for the device
+	 */
+	bool load(const BluetoothAddress &address, BluetoothGattDatabase &db) const
+	{
+		Entry entry;
+		if (!find(address, entry))
+			return false;
+
+		return db.deserialize(entry.data, entry.size);
+	}
+
+	bool load(const std::string &address, BluetoothGattDatabase &db) const
+	{
+		return load(BluetoothAddress(address), db);
+	}
+
+	/**
+	 * @brief Retrieve the database hash stored with the database of a device
+	 * @param address Address of the device
+	 * @param databaseHash Receives the hash. Empty if none was stored.
+	 * @return True if a database is cached for the device
+	 */
+	bool getDatabaseHash(const BluetoothAddress &address, BluetoothGattValue &databaseHash) const
+	{
+		Entry entry;
+		if (!find(address, entry))
+			return false;
+
+		databaseHash.assign(entry.hash, entry.hash + entry.hashLength);
+		return true;
+	}
+
+	/**
+	 * @brief Validate the cached database of a device against the current
+	 *        value of its Database Hash characteristic
+	 *
+	 *        The cached database is dropped if the hash differs. Databases of
+	 *        devices without Database Hash stay valid until a Service Changed
+	 *        indication is received.
+	 *
+	 * @param address Address of the device
+	 * @param databaseHash Value read from the device or empty if the device
+	 *        doesn't have a Database Hash characteristic
+	 * @return True if the cached database is still valid
+	 */
+	bool validate(const BluetoothAddress &address, const BluetoothGattValue &databaseHash)
+	{
+		BluetoothGattValue cachedHash;
+		if (!getDatabaseHash(address, cachedHash))
+			return false;
+
+		if (cachedHash == databaseHash)
+			return true;
+
+		remove(address);
+		return false;
+	}
+
+	bool validate(const std::string &address, const BluetoothGattValue &databaseHash)
+	{
+		return validate(BluetoothAddress(address), databaseHash);
+	}
+
+	/**
+	 * @brief Handle a Service Changed indication of a device
+	 *
+	 *        Services overlapping the changed handle range are dropped from the
+	 *        cached database, so only they have to be discovered again. The stored
+	 *        database hash is dropped as it no longer matches.
+	 *
+	 * @param address Address of the device
+	 * @param startHandle First handle of the changed range
+	 * @param endHandle Last handle of the changed range
+	 */
+	void serviceChanged(const BluetoothAddress &address, uint16_t startHandle, uint16_t endHandle)
+	{
+		BluetoothGattDatabase cached;
+		if (!load(address, cached))
+			return;
+
+		BluetoothGattDatabase remaining;
+		for (size_t n = 0; n < cached.getServiceCount(); n++)
+		{
+			BluetoothGattDatabase::Service service = cached.getService(n);
+			if (service.getEndHandle() < startHandle || service.getHandle() > endHandle)
+				remaining.addService(service.toService());
+		}
+
+		if (remaining.getServiceCount() == 0 || !store(address, remaining))
+			remove(address);
+	}
+
+	/**
+	 * @brief Drop the cached database of a device, e.g. when it's unpaired
+	 * @param address Address of the device
+	 * @return True if a database was cached for the device
+	 */
+	bool remove(const BluetoothAddress &address)
+	{
+		if (!contains(address))
+			return false;
+
+		Change change;
+		change.removed = true;
+		changes[address] = std::move(change);
+		return true;
+	}
+
+	bool remove(const std::string &address)
+	{
+		return remove(BluetoothAddress(address));
+	}
+
+	/**
+	 * @brief Check if a database is cached for a device
+	 * @param address Address of the device
+	 * @return True if a database is cached
+	 */
+	bool contains(const BluetoothAddress &address) const
+	{
+		Entry entry;
+		return find(address, entry);
+	}
+
+	/**
+	 * @brief Retrieve the number of cached databases
+	 * @return Number of databases
+	 */
+	size_t size() const
+	{
+		std::vector<Entry> entries;
+		collectEntries(entries);
+		return entries.size();
+	}
+
+	/**
+	 * @brief Check if there are unsaved changes
+	 * @return True if save() has to be called
+	 */
+	bool isModified() const { return !changes.empty(); }
+
+private:
+	static const size_t HEADER_SIZE = 16;
+	static const size_t DIRECTORY_ENTRY_SIZE = 40;
+	static const size_t MAX_HASH_LENGTH = 16;
+
+	static const char* magic() { return "BTGC"; }
+
+	struct Change
+	{
+		bool removed;
+		std::vector<uint8_t> data;
+		BluetoothGattValue hash;
+	};
+
+	struct Entry
+	{
+		BluetoothAddress address;
+		const uint8_t *data;
+		size_t size;
+		uint8_t hash[16];
+		uint8_t hashLength;
+	};
+
+	bool validateMapping()
+	{
+		if (mappingSize < HEADER_SIZE || memcmp(mapping, magic(), 4) != 0 || readUInt32(mapping + 4) != VERSION)
+			return false;
+
+		uint32_t count = readUInt32(mapping + 8);
+		if (count > (mappingSize - HEADER_SIZE) / DIRECTORY_ENTRY_SIZE)
+			return false;
+
+		uint64_t previous = 0;
+		for (uint32_t n = 0; n < count; n++)
+		{
+			const uint8_t *record = mapping + HEADER_SIZE + n * DIRECTORY_ENTRY_SIZE;
+			uint64_t address = readUInt64(record);
+			uint64_t offset = readUInt64(record + 8);
+			uint32_t size = readUInt32(record + 16);
+
+			// Addresses have to be sorted for the binary search
+			if ((n > 0 && address <= previous) || address > 0xffffffffffffULL ||
+			    offset > mappingSize || size > mappingSize - offset || record[20] > MAX_HASH_LENGTH)
+				return false;
+
+			previous = address;
+		}
+
+		entryCount = count;
+		return true;
+	}
+
+	void unmap()
+	{
+		if (mapping)
+			munmap(const_cast<uint8_t*>(mapping), mappingSize);
+
+		mapping = nullptr;
+		mappingSize = 0;
+		entryCount = 0;
+	}
+
+	uint64_t addressAt(size_t position) const
+	{
+		return readUInt64(mapping + HEADER_SIZE + position * DIRECTORY_ENTRY_SIZE);
+	}
+
+	Entry entryAt(size_t position) const
+	{
+		const uint8_t *record = mapping + HEADER_SIZE + position * DIRECTORY_ENTRY_SIZE;
+
+		Entry entry;
+		entry.address = BluetoothAddress(readUInt64(record));
+		entry.data = mapping + readUInt64(record + 8);
+		entry.size = readUInt32(record + 16);
+		entry.hashLength = record[20];
+		memcpy(entry.hash, record + 24, MAX_HASH_LENGTH);
+		return entry;
+	}
+
+	static Entry entryOf(const BluetoothAddress &address, const Change &change)
+	{
+		Entry entry;
+		entry.address = address;
+		entry.data = change.data.data();
+		entry.size = change.data.size();
+		entry.hashLength = change.hash.size();
+		memset(entry.hash, 0, MAX_HASH_LENGTH);
+		std::copy(change.hash.begin(), change.hash.end(), entry.hash);
+		return entry;
+	}
+
+	bool find(const BluetoothAddress &address, Entry &entry) const
+	{
+		auto change = changes.find(address);
+		if (change != changes.end())
+		{
+			if (change->second.removed)
+				return false;
+
+			entry = entryOf(address, change->second);
+			return true;
+		}
+
+		size_t low = 0;
+		size_t high = entryCount;
+		while (low < high)
+		{
+			size_t middle = (low + high) / 2;
+			uint64_t current = addressAt(middle);
+
+			if (current == address.toUInt64())
+			{
+				entry = entryAt(middle);
+				return true;
+			}
+
+			if (current < address.toUInt64())
+				low = middle + 1;
+			else
+				high = middle;
+		}
+
+		return false;
+	}
+
+	// Merge the mapped entries with the changes, sorted by address
+	void collectEntries(std::vector<Entry> &entries) const
+	{
+		entries.reserve(entryCount + changes.size());
+
+		size_t n = 0;
+		auto change = changes.begin();
+
+		while (n < entryCount || change != changes.end())
+		{
+			uint64_t mapped = n < entryCount ? addressAt(n) : ~0ULL;
+
+			if (change == changes.end() || change->first.toUInt64() > mapped)
+			{
+				entries.push_back(entryAt(n++));
+				continue;
+			}
+
+			// The change replaces or removes the mapped entry
+			if (change->first.toUInt64() == mapped)
+				n++;
+
+			if (!change->second.removed)
+				entries.push_back(entryOf(change->first, change->second));
+
+			++change;
+		}
+	}
+
+	static bool writeFile(const std::string &path, const std::vector<uint8_t> &content)
+	{
+		int fd = ::open(path.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0600);
+		if (fd < 0)
+			return false;
+
+		size_t written = 0;
+		while (written < content.size())
+		{
+			ssize_t result = write(fd, content.data() + written, content.size() - written);
+			if (result < 0 && errno == EINTR)
+				continue;
+
+			if (result <= 0)
+				break;
+
+			written += result;
+		}
+
+		bool success = written == content.size() && fsync(fd) == 0;
+		success = close(fd) == 0 && success;
+
+		if (!success)
+			unlink(path.c_str());
+
+		return success;
+	}
+
+	static void writeUInt32(std::vector<uint8_t> &data, uint32_t value)
+	{
+		for (int n = 0; n < 4; n++)
+			data.push_back(static_cast<uint8_t>(value >> (8 * n)));
+	}
+
+	static void writeUInt64(std::vector<uint8_t> &data, uint64_t value)
+	{
+		for (int n = 0; n < 8; n++)
+			data.push_back(static_cast<uint8_t>(value >> (8 * n)));
+	}
+
+	static uint32_t readUInt32(const uint8_t *data)
+	{
+		return data[0] | (data[1] << 8) | (data[2] << 16) | (static_cast<uint32_t>(data[3]) << 24);
+	}
+
+	static uint64_t readUInt64(const uint8_t *data)
+	{
+		return readUInt32(data) | (static_cast<uint64_t>(readUInt32(data + 4)) << 32);
+	}
+
+	std::string path;
+	const uint8_t *mapping;
+	size_t mappingSize;
+	size_t entryCount;
+	// Changes since the file was mapped, sorted by address
+	std::map<BluetoothAddress, Change> changes;
+};
+
+#endif
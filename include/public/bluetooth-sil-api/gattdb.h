@@ -0,0 +1,951 @@
+// Copyright (c) 2026 LG Electronics, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef BLUETOOTH_SIL_GATTDB_H_
+#define BLUETOOTH_SIL_GATTDB_H_
+
+#ifndef BLUETOOTH_SIL_H_
+	#error This header file should only be included by bluetooth-sil-api.h
+#endif
+
+#include <unordered_map>
+
+/**
+ * @brief Flat GATT attribute database in the style of the ATT attribute table.
+ *
+ *        Services, characteristics and descriptors are stored as attributes in
+ *        a single contiguous array in the order they were added. A service is
+ *        followed by its characteristics, each characteristic by its
+ *        descriptors. This isn't necessarily the handle order. The values are
+ *        kept in a parallel array.
+ *
+ *        Attributes are found by handle in constant time through a handle
+ *        indexed table, characteristics by service and characteristic UUID
+ *        through a hash index. The Service, Characteristic and Descriptor views
+ *        returned by the lookups only hold the database and an index, so they
+ *        are cheap to pass around. They stay valid until the database is
+ *        cleared or destroyed; adding services doesn't invalidate them.
+ *
+ *        BluetoothGattService and friends remain the value types passed through
+ *        BluetoothGattProfile and its observer. addService imports them and the
+ *        views convert back with toService, toCharacteristic and toDescriptor.
+ *
+ *        If several services share a UUID the UUID lookups find the first one.
+ *        The database isn't thread-safe.
+ */
+class BluetoothGattDatabase
+{
+	struct Attribute;
+
+public:
+	class Service;
+	class Characteristic;
+	class Descriptor;
+
+	/**
+	 * @brief Kind of an attribute
+	 */
+	enum AttributeType
+	{
+		ATTRIBUTE_SERVICE,
+		ATTRIBUTE_CHARACTERISTIC,
+		ATTRIBUTE_DESCRIPTOR
+	};
+
+	/**
+	 * @brief View of a descriptor in the database
+	 */
+	class Descriptor
+	{
+	public:
+		Descriptor() : db(nullptr), index(0) { }
+
+		bool isValid() const { return db != nullptr; }
+
+		BluetoothUuid getUuid() const { return attribute().uuid; }
+		uint16_t getHandle() const { return attribute().handle; }
+		BluetoothGattDescriptorPermissions getPermissions() const { return attribute().permissions; }
+		WriteType getWriteType() const { return static_cast<WriteType>(attribute().writeType); }
+		const BluetoothGattValue& getValue() const { return db->values[index]; }
+
+		/**
+		 * @brief Retrieve the characteristic the descriptor belongs to
+		 * @return Characteristic
+		 */
+		Characteristic getCharacteristic() const { return Characteristic(db, attribute().parent); }
+
+		/**
+		 * @brief Copy the descriptor into a BluetoothGattDescriptor
+		 * @return Descriptor
+		 */
+		BluetoothGattDescriptor toDescriptor() const
+		{
+			BluetoothGattDescriptor descriptor;
+			descriptor.setUuid(getUuid());
+			descriptor.setHandle(getHandle());
+			descriptor.setPermissions(getPermissions());
+			descriptor.setWriteType(getWriteType());
+			descriptor.setValue(getValue());
+			return descriptor;
+		}
+
+	private:
+		friend class BluetoothGattDatabase;
+
+		Descriptor(const BluetoothGattDatabase *db, uint32_t index) : db(db), index(index) { }
+
+		const Attribute& attribute() const { return db->attributes[index]; }
+
+		const BluetoothGattDatabase *db;
+		uint32_t index;
+	};
+
+	/**
+	 * @brief View of a characteristic in the database
+	 */
+	class Characteristic
+	{
+	public:
+		Characteristic() : db(nullptr), index(0) { }
+
+		bool isValid() const { return db != nullptr; }
+
+		BluetoothUuid getUuid() const { return attribute().uuid; }
+		uint16_t getHandle() const { return attribute().handle; }
+		BluetoothGattCharacteristicProperties getProperties() const { return attribute().properties; }
+		BluetoothGattCharacteristicPermissions getPermissions() const { return attribute().permissions; }
+		WriteType getWriteType() const { return static_cast<WriteType>(attribute().writeType); }
+		const BluetoothGattValue& getValue() const { return db->values[index]; }
+
+		bool isPropertySet(BluetoothGattCharacteristicProperties properties) const
+		{
+			return (getProperties() & properties) == properties;
+		}
+
+		/**
+		 * @brief Retrieve the service the characteristic belongs to
+		 * @return Service
+		 */
+		Service getService() const { return Service(db, attribute().parent); }
+
+		size_t getDescriptorCount() const { return attribute().count; }
+
+		/**
+		 * @brief Retrieve a descriptor by its position
+		 * @param position Position of the descriptor, less than getDescriptorCount()
+		 * @return Descriptor
+		 */
+		Descriptor getDescriptor(size_t position) const { return Descriptor(db, index + 1 + position); }
+
+		/**
+		 * @brief Find a descriptor by its UUID
+		 * @param uuid UUID of the descriptor
+		 * @return Descriptor. Invalid if not found.
+		 */
+		Descriptor findDescriptor(const BluetoothUuid &uuid) const
+		{
+			for (uint32_t n = index + 1; n <= index + attribute().count; n++)
+			{
+				if (db->attributes[n].uuid == uuid)
+					return Descriptor(db, n);
+			}
+
+			return Descriptor();
+		}
+
+		/**
+		 * @brief Copy the characteristic and its descriptors into a
+		 *        BluetoothGattCharacteristic
+		 * @return Characteristic
+		 */
+		BluetoothGattCharacteristic toCharacteristic() const
+		{
+			BluetoothGattCharacteristic characteristic;
+			characteristic.setUuid(getUuid());
+			characteristic.setHandle(getHandle());
+			characteristic.setProperties(getProperties());
+			characteristic.setPermissions(getPermissions());
+			characteristic.setWriteType(getWriteType());
+			characteristic.setValue(getValue());
+
+			for (size_t n = 0; n < getDescriptorCount(); n++)
+				characteristic.addDescriptor(getDescriptor(n).toDescriptor());
+
+			return characteristic;
+		}
+
+	private:
+		friend class BluetoothGattDatabase;
+
+		Characteristic(const BluetoothGattDatabase *db, uint32_t index) : db(db), index(index) { }
+
+		const Attribute& attribute() const { return db->attributes[index]; }
+
+		const BluetoothGattDatabase *db;
+		uint32_t index;
+	};
+
+	/**
+	 * @brief View of a service in the database
+	 */
+	class Service
+	{
+	public:
+		Service() : db(nullptr), index(0) { }
+
+		bool isValid() const { return db != nullptr; }
+
+		BluetoothUuid getUuid() const { return attribute().uuid; }
+		uint16_t getHandle() const { return attribute().handle; }
+		BluetoothGattService::Type getType() const { return static_cast<BluetoothGattService::Type>(attribute().properties); }
+
+		/**
+		 * @brief Retrieve the last handle of the service
+		 * @return Highest handle of the attributes belonging to the service
+		 */
+		uint16_t getEndHandle() const { return db->endHandleOf(index); }
+
+		size_t getCharacteristicCount() const { return attribute().count; }
+
+		/**
+		 * @brief Retrieve a characteristic by its position
+		 * @param position Position of the characteristic, less than getCharacteristicCount()
+		 * @return Characteristic
+		 */
+		Characteristic getCharacteristic(size_t position) const
+		{
+			return Characteristic(db, db->characteristicIndices[attribute().first + position]);
+		}
+
+		/**
+		 * @brief Find a characteristic by its UUID
+		 * @param uuid UUID of the characteristic
+		 * @return Characteristic. Invalid if not found.
+		 */
+		Characteristic findCharacteristic(const BluetoothUuid &uuid) const
+		{
+			auto iter = db->characteristicsByUuid.find(CharacteristicKey(index, uuid));
+			if (iter == db->characteristicsByUuid.end())
+				return Characteristic();
+
+			return Characteristic(db, iter->second);
+		}
+
+		/**
+		 * @brief Copy the service with all characteristics and descriptors into a
+		 *        BluetoothGattService
+		 * @return Service
+		 */
+		BluetoothGattService toService() const
+		{
+			BluetoothGattService service(getType(), getUuid());
+
+			auto includes = db->includes.find(index);
+			if (includes != db->includes.end())
+			{
+				for (auto &uuid : includes->second)
+					service.includeService(uuid);
+			}
+
+			BluetoothGattCharacteristicList characteristics;
+			characteristics.reserve(getCharacteristicCount());
+			for (size_t n = 0; n < getCharacteristicCount(); n++)
+				characteristics.push_back(getCharacteristic(n).toCharacteristic());
+
+			service.setCharacteristics(std::move(characteristics));
+			return service;
+		}
+
+	private:
+		friend class BluetoothGattDatabase;
+
+		Service(const BluetoothGattDatabase *db, uint32_t index) : db(db), index(index) { }
+
+		const Attribute& attribute() const { return db->attributes[index]; }
+
+		const BluetoothGattDatabase *db;
+		uint32_t index;
+	};
+
+	BluetoothGattDatabase() : nextHandle(1) { }
+
+	BluetoothGattDatabase(const BluetoothGattDatabase &other) = delete;
+	BluetoothGattDatabase& operator =(const BluetoothGattDatabase &other) = delete;
+
+	/**
+	 * @brief Add a service with its characteristics and descriptors
+	 *
+	 *        Characteristics and descriptors keep their handles. Attributes with
+	 *        handle 0, e.g. of services which are registered locally, get the next
+	 *        free handle after the highest handle used so far. The service itself
+	 *        takes the handle before its first characteristic if that one is free.
+	 *
+	 * @param service Service to add
+	 * @return View of the added service. Invalid if the service is invalid or
+	 *         a handle is already used, the database is unchanged then.
+	 */
+	Service addService(const BluetoothGattService &service)
+	{
+		if (!service.isValid())
+			return Service();
+
+		size_t attributeCount = attributes.size();
+		size_t characteristicCount = characteristicIndices.size();
+		uint16_t previousNextHandle = nextHandle;
+
+		const BluetoothGattCharacteristicList &characteristics = service.getCharacteristics();
+
+		uint16_t serviceHandle = 0;
+		if (!characteristics.empty() && characteristics.front().getHandle() > 1 &&
+		    !isHandleUsed(characteristics.front().getHandle() - 1))
+			serviceHandle = characteristics.front().getHandle() - 1;
+
+		uint32_t serviceIndex = attributes.size();
+		if (!append(ATTRIBUTE_SERVICE, service.getUuid(), serviceHandle, 0, 0, service.getType(), 0, BluetoothGattValue()))
+			return Service();
+
+		attributes[serviceIndex].first = characteristicCount;
+
+		for (auto &characteristic : characteristics)
+		{
+			uint32_t characteristicIndex = attributes.size();
+			if (!append(ATTRIBUTE_CHARACTERISTIC, characteristic.getUuid(), characteristic.getHandle(), serviceIndex,
+			            characteristic.getPermissions(), characteristic.getProperties(),
+			            characteristic.getWriteType(), characteristic.getValue()))
+			{
+				rollback(attributeCount, characteristicCount, previousNextHandle);
+				return Service();
+			}
+
+			characteristicIndices.push_back(characteristicIndex);
+			attributes[serviceIndex].count++;
+
+			for (auto &descriptor : characteristic.getDescriptors())
+			{
+				if (!append(ATTRIBUTE_DESCRIPTOR, descriptor.getUuid(), descriptor.getHandle(), characteristicIndex,
+				            descriptor.getPermissions(), 0, descriptor.getWriteType(), descriptor.getValue()))
+				{
+					rollback(attributeCount, characteristicCount, previousNextHandle);
+					return Service();
+				}
+
+				attributes[characteristicIndex].count++;
+			}
+		}
+
+		// Both indexes are only updated once the service was added completely
+		for (size_t n = characteristicCount; n < characteristicIndices.size(); n++)
+			indexCharacteristic(serviceIndex, characteristicIndices[n]);
+
+		indexService(serviceIndex);
+
+		if (!service.getIncludedServices().empty())
+			includes[serviceIndex] = service.getIncludedServices();
+
+		return Service(this, serviceIndex);
+	}
+
+	/**
+	 * @brief Add several services
+	 * @param services Services to add
+	 * @return True if all services were added
+	 */
+	bool addServices(const BluetoothGattServiceList &services)
+	{
+		bool result = true;
+
+		for (auto &service : services)
+			result = addService(service).isValid() && result;
+
+		return result;
+	}
+
+	/**
+	 * @brief Remove all attributes
+	 */
+	void clear()
+	{
+		attributes.clear();
+		values.clear();
+		characteristicIndices.clear();
+		handleIndex.clear();
+		characteristicsByUuid.clear();
+		servicesByUuid.clear();
+		includes.clear();
+		services.clear();
+		nextHandle = 1;
+	}
+
+	/**
+	 * @brief Retrieve the number of attributes
+	 * @return Number of services, characteristics and descriptors
+	 */
+	size_t size() const { return attributes.size(); }
+
+	size_t getServiceCount() const { return services.size(); }
+
+	/**
+	 * @brief Retrieve a service by its position
+	 * @param position Position of the service, less than getServiceCount()
+	 * @return Service
+	 */
+	Service getService(size_t position) const { return Service(this, services[position]); }
+
+	/**
+	 * @brief Find a service by its UUID
+	 * @param uuid UUID of the service
+	 * @return Service. Invalid if not found.
+	 */
+	Service findService(const BluetoothUuid &uuid) const
+	{
+		auto iter = servicesByUuid.find(uuid);
+		if (iter == servicesByUuid.end())
+			return Service();
+
+		return Service(this, iter->second);
+	}
+
+	/**
+	 * @brief Find a characteristic by its service and characteristic UUID
+	 * @param service UUID of the service
+	 * @param characteristic UUID of the characteristic
+	 * @return Characteristic. Invalid if not found.
+	 */
+	Characteristic findCharacteristic(const BluetoothUuid &service, const BluetoothUuid &characteristic) const
+	{
+		Service found = findService(service);
+		if (!found.isValid())
+			return Characteristic();
+
+		return found.findCharacteristic(characteristic);
+	}
+
+	/**
+	 * @brief Find a descriptor by its service, characteristic and descriptor UUID
+	 * @param service UUID of the service
+	 * @param characteristic UUID of the characteristic
+	 * @param descriptor UUID of the descriptor
+	 * @return Descriptor. Invalid if not found.
+	 */
+	Descriptor findDescriptor(const BluetoothUuid &service, const BluetoothUuid &characteristic,
+	                          const BluetoothUuid &descriptor) const
+	{
+		Characteristic found = findCharacteristic(service, characteristic);
+		if (!found.isValid())
+			return Descriptor();
+
+		return found.findDescriptor(descriptor);
+	}
+
+	/**
+	 * @brief Retrieve the type of the attribute with a handle
+	 * @param handle Handle of the attribute
+	 * @param type Receives the type
+	 * @return True if an attribute with the handle exists
+	 */
+	bool getAttributeType(uint16_t handle, AttributeType &type) const
+	{
+		uint32_t index = indexOf(handle);
+		if (index == noIndex())
+			return false;
+
+		type = static_cast<AttributeType>(attributes[index].type);
+		return true;
+	}
+
+	/**
+	 * @brief Find the characteristic with a handle
+	 * @param handle Handle of the characteristic
+	 * @return Characteristic. Invalid if the handle doesn't belong to a characteristic.
+	 */
+	Characteristic findCharacteristic(uint16_t handle) const
+	{
+		uint32_t index = indexOf(handle);
+		if (index == noIndex() || attributes[index].type != ATTRIBUTE_CHARACTERISTIC)
+			return Characteristic();
+
+		return Characteristic(this, index);
+	}
+
+	/**
+	 * @brief Find the descriptor with a handle
+	 * @param handle Handle of the descriptor
+	 * @return Descriptor. Invalid if the handle doesn't belong to a descriptor.
+	 */
+	Descriptor findDescriptor(uint16_t handle) const
+	{
+		uint32_t index = indexOf(handle);
+		if (index == noIndex() || attributes[index].type != ATTRIBUTE_DESCRIPTOR)
+			return Descriptor();
+
+		return Descriptor(this, index);
+	}
+
+	/**
+	 * @brief Find the service containing an attribute
+	 * @param handle Handle of the service or any of its attributes
+	 * @return Service. Invalid if no attribute with the handle exists.
+	 */
+	Service findServiceByHandle(uint16_t handle) const
+	{
+		uint32_t index = indexOf(handle);
+		if (index == noIndex())
+			return Service();
+
+		while (attributes[index].type != ATTRIBUTE_SERVICE)
+			index = attributes[index].parent;
+
+		return Service(this, index);
+	}
+
+	/**
+	 * @brief Set the value of a characteristic or descriptor
+	 * @param handle Handle of the attribute
+	 * @param value New value
+	 * @return True if the value was set. False if no characteristic or
+	 *         descriptor with the handle exists.
+	 */
+	bool setValue(uint16_t handle, BluetoothGattValue value)
+	{
+		uint32_t index = indexOf(handle);
+		if (index == noIndex() || attributes[index].type == ATTRIBUTE_SERVICE)
+			return false;
+
+		values[index] = std::move(value);
+		return true;
+	}
+
+	/**
+	 * @brief Change the handle of an attribute, e.g. after a local service was
+	 *        registered with the stack
+	 * @param handle Current handle of the attribute
+	 * @param newHandle New handle of the attribute
+	 * @return True if the handle was changed. False if no attribute with the
+	 *         handle exists or the new handle is already used.
+	 */
+	bool setHandle(uint16_t handle, uint16_t newHandle)
+	{
+		uint32_t index = indexOf(handle);
+		if (index == noIndex() || newHandle == 0)
+			return false;
+
+		if (newHandle == handle)
+			return true;
+
+		if (isHandleUsed(newHandle))
+			return false;
+
+		handleIndex[handle] = noIndex();
+		mapHandle(newHandle, index);
+		attributes[index].handle = newHandle;
+		nextHandle = std::max<uint32_t>(nextHandle, newHandle + 1);
+		return true;
+	}
+
+	/**
+	 * @brief Copy all services into BluetoothGattService objects
+	 * @return List of services
+	 */
+	BluetoothGattServiceList toServices() const
+	{
+		BluetoothGattServiceList result;
+		result.reserve(services.size());
+
+		for (size_t n = 0; n < services.size(); n++)
+			result.push_back(getService(n).toService());
+
+		return result;
+	}
+
+	/**
+	 * @brief Append the database in a compact binary form to a buffer
+	 *
+	 *        The form consists of a header with the number of attributes and
+	 *        includes, one fixed size record per attribute in database order,
+	 *        the included services and finally all values. All integers are
+	 *        little endian, so the data can be stored and loaded on any host.
+	 *
+	 * @param data Buffer the database is appended to
+	 * @return True on success. False if an UUID can't be represented in binary
+	 *         form or a value is longer than 65535 bytes; the buffer is
+	 *         unchanged then.
+	 */
+	bool serialize(std::vector<uint8_t> &data) const
+	{
+		size_t start = data.size();
+		size_t includeCount = 0;
+		for (auto &entry : includes)
+			includeCount += entry.second.size();
+
+		writeUInt32(data, attributes.size());
+		writeUInt32(data, includeCount);
+
+		for (size_t n = 0; n < attributes.size(); n++)
+		{
+			const Attribute &attribute = attributes[n];
+			if (!writeUuid(data, attribute.uuid) || values[n].size() > 0xffff)
+			{
+				data.resize(start);
+				return false;
+			}
+
+			writeUInt16(data, attribute.handle);
+			writeUInt16(data, values[n].size());
+			data.push_back(attribute.type);
+			data.push_back(attribute.properties);
+			data.push_back(attribute.permissions);
+			data.push_back(attribute.writeType);
+		}
+
+		for (size_t n = 0; n < services.size(); n++)
+		{
+			auto entry = includes.find(services[n]);
+			if (entry == includes.end())
+				continue;
+
+			for (auto &uuid : entry->second)
+			{
+				writeUInt32(data, n);
+				if (!writeUuid(data, uuid))
+				{
+					data.resize(start);
+					return false;
+				}
+			}
+		}
+
+		for (auto &value : values)
+			data.insert(data.end(), value.begin(), value.end());
+
+		return true;
+	}
+
+	/**
+	 * @brief Replace the content of the database with a serialized database
+	 * @param data Data created by serialize()
+	 * @param size Size of the data
+	 * @return True on success. False if the data is malformed; the database is
+	 *         empty then.
+	 */
+	bool deserialize(const uint8_t *data, size_t size)
+	{
+		clear();
+
+		if (!parse(data, size))
+		{
+			clear();
+			return false;
+		}
+
+		return true;
+	}
+
+private:
+	static constexpr uint32_t noIndex() { return 0xffffffff; }
+
+	// Serialized UUID: most and least significant bits followed by the type
+	static const size_t UUID_SIZE = 17;
+	// Serialized attribute: UUID, handle, value length, type, properties, permissions and write type
+	static const size_t RECORD_SIZE = UUID_SIZE + 8;
+	// Serialized include: position of the service and included UUID
+	static const size_t INCLUDE_SIZE = 4 + UUID_SIZE;
+
+	struct Attribute
+	{
+		BluetoothUuid uuid;
+		uint16_t handle;
+		uint8_t type;
+		// Characteristic properties or service type
+		uint8_t properties;
+		uint8_t permissions;
+		uint8_t writeType;
+		// Index of the service of a characteristic or of the characteristic of a descriptor
+		uint32_t parent;
+		// Services: position of the first characteristic in characteristicIndices
+		uint32_t first;
+		// Number of characteristics of a service or descriptors of a characteristic
+		uint32_t count;
+	};
+
+	struct CharacteristicKey
+	{
+		CharacteristicKey(uint32_t service, const BluetoothUuid &uuid) : service(service), uuid(uuid) { }
+
+		bool operator ==(const CharacteristicKey &other) const { return service == other.service && uuid == other.uuid; }
+
+		uint32_t service;
+		BluetoothUuid uuid;
+	};
+
+	struct CharacteristicKeyHash
+	{
+		size_t operator()(const CharacteristicKey &key) const
+		{
+			return std::hash<BluetoothUuid>()(key.uuid) ^ (static_cast<size_t>(key.service) * 0x9e3779b9U);
+		}
+	};
+
+	bool append(AttributeType type, const BluetoothUuid &uuid, uint16_t handle, uint32_t parent,
+	            uint8_t permissions, uint8_t properties, uint8_t writeType, const BluetoothGattValue &value)
+	{
+		if (!uuid.isValid())
+			return false;
+
+		if (handle == 0)
+		{
+			if (nextHandle > 0xffff)
+				return false;
+
+			handle = static_cast<uint16_t>(nextHandle);
+		}
+		else if (isHandleUsed(handle))
+		{
+			return false;
+		}
+
+		Attribute attribute;
+		attribute.uuid = uuid;
+		attribute.handle = handle;
+		attribute.type = type;
+		attribute.properties = properties;
+		attribute.permissions = permissions;
+		attribute.writeType = writeType;
+		attribute.parent = parent;
+		attribute.first = 0;
+		attribute.count = 0;
+
+		mapHandle(handle, attributes.size());
+		attributes.push_back(attribute);
+		values.push_back(value);
+		nextHandle = std::max<uint32_t>(nextHandle, handle + 1);
+
+		return true;
+	}
+
+	void rollback(size_t attributeCount, size_t characteristicCount, uint16_t previousNextHandle)
+	{
+		for (size_t n = attributeCount; n < attributes.size(); n++)
+			handleIndex[attributes[n].handle] = noIndex();
+
+		attributes.resize(attributeCount);
+		values.resize(attributeCount);
+		characteristicIndices.resize(characteristicCount);
+		nextHandle = previousNextHandle;
+	}
+
+	void indexCharacteristic(uint32_t service, uint32_t characteristic)
+	{
+		// Keep the first characteristic if a service contains a UUID twice
+		characteristicsByUuid.insert(std::make_pair(CharacteristicKey(service, attributes[characteristic].uuid), characteristic));
+	}
+
+	void indexService(uint32_t service)
+	{
+		services.push_back(service);
+		servicesByUuid.insert(std::make_pair(attributes[service].uuid, service));
+	}
+
+	void mapHandle(uint16_t handle, uint32_t index)
+	{
+		if (handle >= handleIndex.size())
+			handleIndex.resize(handle + 1, noIndex());
+
+		handleIndex[handle] = index;
+	}
+
+	uint32_t indexOf(uint16_t handle) const
+	{
+		return handle < handleIndex.size() ? handleIndex[handle] : noIndex();
+	}
+
+	bool isHandleUsed(uint16_t handle) const { return indexOf(handle) != noIndex(); }
+
+	bool parse(const uint8_t *data, size_t size)
+	{
+		if (size < 8)
+			return false;
+
+		uint32_t attributeCount = readUInt32(data);
+		uint32_t includeCount = readUInt32(data + 4);
+
+		// Every attribute needs its own handle
+		if (attributeCount > 0xffff || includeCount > 0xffff)
+			return false;
+
+		size_t recordOffset = 8;
+		size_t includeOffset = recordOffset + attributeCount * RECORD_SIZE;
+		size_t valueOffset = includeOffset + includeCount * INCLUDE_SIZE;
+		if (valueOffset > size)
+			return false;
+
+		attributes.reserve(attributeCount);
+		values.reserve(attributeCount);
+
+		uint32_t service = noIndex();
+		uint32_t characteristic = noIndex();
+
+		for (uint32_t n = 0; n < attributeCount; n++)
+		{
+			const uint8_t *record = data + recordOffset + n * RECORD_SIZE;
+			BluetoothUuid uuid = readUuid(record);
+			uint16_t handle = readUInt16(record + UUID_SIZE);
+			uint16_t valueLength = readUInt16(record + UUID_SIZE + 2);
+			uint8_t type = record[UUID_SIZE + 4];
+
+			uint32_t parent = 0;
+			if (type == ATTRIBUTE_CHARACTERISTIC)
+				parent = service;
+			else if (type == ATTRIBUTE_DESCRIPTOR)
+				parent = characteristic;
+			else if (type != ATTRIBUTE_SERVICE)
+				return false;
+
+			if (handle == 0 || parent == noIndex() || valueLength > size - valueOffset)
+				return false;
+
+			uint32_t index = attributes.size();
+			const uint8_t *value = data + valueOffset;
+			valueOffset += valueLength;
+
+			if (!append(static_cast<AttributeType>(type), uuid, handle, parent, record[UUID_SIZE + 6],
+			            record[UUID_SIZE + 5], record[UUID_SIZE + 7], BluetoothGattValue(value, value + valueLength)))
+				return false;
+
+			if (type == ATTRIBUTE_SERVICE)
+			{
+				service = index;
+				characteristic = noIndex();
+				attributes[index].first = characteristicIndices.size();
+				indexService(index);
+			}
+			else if (type == ATTRIBUTE_CHARACTERISTIC)
+			{
+				characteristic = index;
+				characteristicIndices.push_back(index);
+				attributes[service].count++;
+				indexCharacteristic(service, index);
+			}
+			else
+			{
+				attributes[characteristic].count++;
+			}
+		}
+
+		for (uint32_t n = 0; n < includeCount; n++)
+		{
+			const uint8_t *record = data + includeOffset + n * INCLUDE_SIZE;
+			uint32_t position = readUInt32(record);
+			BluetoothUuid uuid = readUuid(record + 4);
+			if (position >= services.size() || !uuid.isValid())
+				return false;
+
+			includes[services[position]].push_back(uuid);
+		}
+
+		return true;
+	}
+
+	static bool writeUuid(std::vector<uint8_t> &data, const BluetoothUuid &uuid)
+	{
+		// UUIDs which couldn't be parsed only exist in text form
+		BluetoothUuid binary(uuid.getMostSignificantBits(), uuid.getLeastSignificantBits(), uuid.getType());
+		if (!(binary == uuid))
+			return false;
+
+		writeUInt64(data, uuid.getMostSignificantBits());
+		writeUInt64(data, uuid.getLeastSignificantBits());
+		data.push_back(uuid.getType());
+		return true;
+	}
+
+	static BluetoothUuid readUuid(const uint8_t *data)
+	{
+		if (data[16] > BluetoothUuid::UUID128)
+			return BluetoothUuid();
+
+		return BluetoothUuid(readUInt64(data), readUInt64(data + 8), static_cast<BluetoothUuid::Type>(data[16]));
+	}
+
+	static void writeUInt16(std::vector<uint8_t> &data, uint16_t value)
+	{
+		data.push_back(value & 0xff);
+		data.push_back(value >> 8);
+	}
+
+	static void writeUInt32(std::vector<uint8_t> &data, uint32_t value)
+	{
+		for (int n = 0; n < 4; n++)
+			data.push_back(static_cast<uint8_t>(value >> (8 * n)));
+	}
+
+	static void writeUInt64(std::vector<uint8_t> &data, uint64_t value)
+	{
+		for (int n = 0; n < 8; n++)
+			data.push_back(static_cast<uint8_t>(value >> (8 * n)));
+	}
+
+	static uint16_t readUInt16(const uint8_t *data)
+	{
+		return data[0] | (data[1] << 8);
+	}
+
+	static uint32_t readUInt32(const uint8_t *data)
+	{
+		return data[0] | (data[1] << 8) | (data[2] << 16) | (static_cast<uint32_t>(data[3]) << 24);
+	}
+
+	static uint64_t readUInt64(const uint8_t *data)
+	{
+		return readUInt32(data) | (static_cast<uint64_t>(readUInt32(data + 4)) << 32);
+	}
+
+	uint32_t lastAttributeOf(uint32_t service) const
+	{
+		const Attribute &attribute = attributes[service];
+		if (attribute.count == 0)
+			return service;
+
+		uint32_t last = characteristicIndices[attribute.first + attribute.count - 1];
+		return last + attributes[last].count;
+	}
+
+	// The attributes of a service aren't sorted by handle, so look at all of them
+	uint16_t endHandleOf(uint32_t service) const
+	{
+		uint32_t last = lastAttributeOf(service);
+		uint16_t end = 0;
+		for (uint32_t n = service; n <= last; n++)
+			end = std::max(end, attributes[n].handle);
+
+		return end;
+	}
+
+	std::vector<Attribute> attributes;
+	// Values of the attributes, same order as attributes
+	std::vector<BluetoothGattValue> values;
+	// Attribute indexes of the characteristics of all services, grouped by service
+	std::vector<uint32_t> characteristicIndices;
+	// Attribute indexes of the services in the order they were added
+	std::vector<uint32_t> services;
+	// Attribute index by handle
+	std::vector<uint32_t> handleIndex;
+	std::unordered_map<CharacteristicKey, uint32_t, CharacteristicKeyHash> characteristicsByUuid;
+	std::unordered_map<BluetoothUuid, uint32_t> servicesByUuid;
+	std::unordered_map<uint32_t, BluetoothUuidList> includes;
+	uint32_t nextHandle;
+};
+
+#endif
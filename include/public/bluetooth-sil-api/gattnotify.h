@@ -0,0 +1,282 @@
+// Copyright (c) 2026 LG Electronics, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef BLUETOOTH_SIL_GATTNOTIFY_H_
+#define BLUETOOTH_SIL_GATTNOTIFY_H_
+
+#ifndef BLUETOOTH_SIL_H_
+	#error This header file should only be included by bluetooth-sil-api.h
+#endif
+
+#include <limits>
+#include <unordered_map>
+
+/**
+ * @brief Delivers notifications and indications to the
+ *        BluetoothGattProfileStatusObserver according to the delivery mode of
+ *        their characteristic.
+ *
+ *        SIL implementations store the modes set through
+ *        BluetoothGattProfile::setCharacteristicNotificationDelivery in the
+ *        dispatcher and pass every received value to notify(). Values of
+ *        characteristics in VALUE mode are passed on to the observer
+ *        directly. Values in BATCH mode are copied into a buffer kept per
+ *        characteristic and delivered once the batch is full or its interval
+ *        has expired. The buffers keep their memory, so no allocation happens
+ *        per notification once a stream is running.
+ *
+ *        The dispatcher doesn't depend on a main loop; the SIL calls run()
+ *        when the delay returned by the last call has expired. The
+ *        dispatcher isn't thread-safe.
+ */
+class BluetoothGattNotificationDispatcher
+{
+public:
+	/**
+	 * @brief Create a dispatcher
+	 * @param observer Observer the values are delivered to
+	 */
+	BluetoothGattNotificationDispatcher(BluetoothGattProfileStatusObserver *observer) :
+		observer(observer),
+		delivering(false)
+	{
+	}
+
+	void setObserver(BluetoothGattProfileStatusObserver *observer) { this->observer = observer; }
+
+	/**
+	 * @brief Set the delivery mode of a characteristic
+	 *
+	 *        Pending values of the characteristic are delivered first, unless
+	 *        the mode is changed by the observer during a delivery.
+	 *
+	 * @param connId ID of the remote device
+	 * @param handle Handle of the characteristic value
+	 * @param delivery Delivery mode
+	 */
+	void setDelivery(uint16_t connId, uint16_t handle, const BluetoothGattNotificationDelivery &delivery)
+	{
+		uint32_t key = makeKey(connId, handle);
+		deliver(key);
+
+		if (delivery.mode == BluetoothGattNotificationDelivery::CHARACTERISTIC)
+		{
+			entries.erase(key);
+			return;
+		}
+
+		entries[key].delivery = delivery;
+	}
+
+	/**
+	 * @brief Retrieve the delivery mode of a characteristic
+	 * @param connId ID of the remote device
+	 * @param handle Handle of the characteristic value
+	 * @return Delivery mode, CHARACTERISTIC if none was set
+	 */
+	BluetoothGattNotificationDelivery getDelivery(uint16_t connId, uint16_t handle) const
+	{
+		auto iter = entries.find(makeKey(connId, handle));
+		if (iter == entries.end())
+			return BluetoothGattNotificationDelivery();
+
+		return iter->second.delivery;
+	}
+
+	/**
+	 * @brief Deliver a received notification or indication
+	 * @param connId ID of the remote device
+	 * @param handle Handle of the characteristic value
+	 * @param value Received value. Only needs to be valid during the call.
+	 * @param now Current time in milliseconds
+	 * @return True if the value was taken over. False if the characteristic
+	 *         is in CHARACTERISTIC mode and the SIL has to report the value
+	 *         through characteristicValueChanged itself.
+	 */
+	bool notify(uint16_t connId, uint16_t handle, BluetoothByteSpan value, uint64_t now)
+	{
+		uint32_t key = makeKey(connId, handle);
+		auto iter = entries.find(key);
+
+		if (iter == entries.end())
+			return false;
+
+		Entry &entry = iter->second;
+
+		if (entry.delivery.mode == BluetoothGattNotificationDelivery::VALUE)
+		{
+			observer->characteristicValueNotified(connId, handle, value);
+			return true;
+		}
+
+		if (entry.timestamps.empty())
+			entry.first = now;
+
+		entry.data.insert(entry.data.end(), value.data(), value.data() + value.size());
+		entry.offsets.push_back(entry.data.size());
+		entry.timestamps.push_back(now);
+
+		if (entry.delivery.maxBatchSize && entry.timestamps.size() >= entry.delivery.maxBatchSize)
+			deliver(key);
+
+		return true;
+	}
+
+	/**
+	 * @brief Deliver the batches whose interval has expired
+	 * @param now Current time in milliseconds
+	 * @param delay Receives the time in milliseconds after which run() has to
+	 *        be called again
+	 * @return True if run() has to be called again after the delay. False if
+	 *         no value is pending.
+	 */
+	bool run(uint64_t now, uint32_t &delay)
+	{
+		if (!delivering)
+		{
+			// Collect first as the observer may change the delivery modes
+			due.clear();
+			for (auto &entry : entries)
+			{
+				if (!entry.second.timestamps.empty() && entry.second.first + entry.second.delivery.batchInterval <= now)
+					due.push_back(entry.first);
+			}
+
+			for (uint32_t key : due)
+				deliver(key);
+		}
+
+		uint64_t wakeup = std::numeric_limits<uint64_t>::max();
+		for (auto &entry : entries)
+		{
+			if (!entry.second.timestamps.empty())
+				wakeup = std::min(wakeup, entry.second.first + entry.second.delivery.batchInterval);
+		}
+
+		if (wakeup == std::numeric_limits<uint64_t>::max())
+			return false;
+
+		delay = wakeup > now ? static_cast<uint32_t>(std::min<uint64_t>(wakeup - now, std::numeric_limits<uint32_t>::max())) : 0;
+		return true;
+	}
+
+	/**
+	 * @brief Deliver all pending values
+	 */
+	void flush()
+	{
+		if (delivering)
+			return;
+
+		due.clear();
+		for (auto &entry : entries)
+		{
+			if (!entry.second.timestamps.empty())
+				due.push_back(entry.first);
+		}
+
+		for (uint32_t key : due)
+			deliver(key);
+	}
+
+	/**
+	 * @brief Deliver the pending values of a device and forget its delivery
+	 *        modes after it has disconnected
+	 * @param connId ID of the remote device
+	 */
+	void disconnected(uint16_t connId)
+	{
+		std::vector<uint32_t> keys;
+		for (auto &entry : entries)
+		{
+			if ((entry.first >> 16) == connId)
+				keys.push_back(entry.first);
+		}
+
+		for (uint32_t key : keys)
+		{
+			deliver(key);
+			entries.erase(key);
+		}
+	}
+
+	/**
+	 * @brief Retrieve the number of values waiting for delivery
+	 * @return Number of values
+	 */
+	size_t size() const
+	{
+		size_t count = 0;
+		for (auto &entry : entries)
+			count += entry.second.timestamps.size();
+
+		return count;
+	}
+
+private:
+	struct Entry
+	{
+		Entry() : first(0), offsets(1, 0) { }
+
+		BluetoothGattNotificationDelivery delivery;
+		// Reception time of the first value of the batch
+		uint64_t first;
+		std::vector<uint8_t> data;
+		std::vector<uint32_t> offsets;
+		std::vector<uint64_t> timestamps;
+	};
+
+	static uint32_t makeKey(uint16_t connId, uint16_t handle)
+	{
+		return (static_cast<uint32_t>(connId) << 16) | handle;
+	}
+
+	void deliver(uint32_t key)
+	{
+		// Called again by the observer while a batch is delivered
+		if (delivering)
+			return;
+
+		auto iter = entries.find(key);
+		if (iter == entries.end() || iter->second.timestamps.empty())
+			return;
+
+		// The batch is delivered from the spare buffers, so the observer may
+		// queue values or change the mode of the characteristic meanwhile
+		Entry &entry = iter->second;
+		spare.data.swap(entry.data);
+		spare.offsets.swap(entry.offsets);
+		spare.timestamps.swap(entry.timestamps);
+
+		entry.data.clear();
+		entry.offsets.assign(1, 0);
+		entry.timestamps.clear();
+
+		BluetoothGattNotificationBatch batch(spare.data.data(), spare.offsets.data(), spare.timestamps.data(),
+		                                     spare.timestamps.size());
+		delivering = true;
+		observer->characteristicValuesNotified(key >> 16, key & 0xffff, batch);
+		delivering = false;
+	}
+
+	BluetoothGattProfileStatusObserver *observer;
+	std::unordered_map<uint32_t, Entry> entries;
+	Entry spare;
+	std::vector<uint32_t> due;
+	bool delivering;
+};
+
+#endif
@@ -0,0 +1,386 @@
+// Copyright (c) 2026 LG Electronics, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef BLUETOOTH_SIL_GATTPREPARE_H_
+#define BLUETOOTH_SIL_GATTPREPARE_H_
+
+#ifndef BLUETOOTH_SIL_H_
+	#error This header file should only be included by bluetooth-sil-api.h
+#endif
+
+#include <unordered_map>
+
+/**
+ * @brief Prepared write queues of a GATT server.
+ *
+ *        Long writes and reliable writes arrive as a sequence of Prepare Write
+ *        requests followed by an Execute Write request. SIL implementations
+ *        pass the fragments to the queue instead of handing each one to the
+ *        application through characteristicValueWriteRequested with a
+ *        ContinueType. On execution the queue delivers every written value
+ *        once and contiguous, so applications can use the
+ *        characteristicValueWriteRequested variant without ContinueType.
+ *
+ *        Every client has its own queue. The fragments are copied into an
+ *        arena reserved at the maximum queue length when the client prepares
+ *        its first write, and values are assembled in a buffer which keeps its
+ *        memory. Neither grows while a client's writes are processed.
+ *
+ *        Execution is atomic: all fragments are validated first, and either
+ *        every value is delivered or none is. The queue isn't thread-safe.
+ */
+class BluetoothGattPreparedWriteQueue
+{
+public:
+	/**
+	 * @brief Callback receiving an executed value
+	 *
+	 *        The value is only valid during the call.
+	 */
+	typedef std::function<void(const BluetoothAddress &address, uint16_t serviceId, uint16_t charId,
+	                           const BluetoothGattValue &value)> ExecuteCallback;
+
+	/**
+	 * @brief Create a queue
+	 * @param maxAttributeLength Maximum length of a written value
+	 * @param maxQueueLength Maximum number of bytes prepared by a single client
+	 */
+	BluetoothGattPreparedWriteQueue(uint16_t maxAttributeLength = 512, size_t maxQueueLength = 4096) :
+		maxAttributeLength(maxAttributeLength),
+		maxQueueLength(maxQueueLength)
+	{
+	}
+
+	void setMaxAttributeLength(uint16_t length) { maxAttributeLength = length; }
+	uint16_t getMaxAttributeLength() const { return maxAttributeLength; }
+
+	/**
+	 * @brief Set the maximum number of bytes a client can prepare
+	 *
+	 *        Applies to clients which prepare their first write afterwards.
+	 *
+	 * @param length Maximum queue length
+	 */
+	void setMaxQueueLength(size_t length) { maxQueueLength = length; }
+	size_t getMaxQueueLength() const { return maxQueueLength; }
+
+	/**
+	 * @brief Queue a fragment of a Prepare Write request
+	 * @param address Address of the client
+	 * @param serviceId Service handle
+	 * @param charId Characteristic handle
+	 * @param offset Offset of the fragment in the value
+	 * @param value Fragment. Only needs to be valid during the call.
+	 * @return BLUETOOTH_ERROR_PARAM_INVALID if the value would exceed the
+	 *         maximum attribute length, BLUETOOTH_ERROR_NOMEM if the queue of
+	 *         the client is full
+	 */
+	BluetoothError prepare(const BluetoothAddress &address, uint16_t serviceId, uint16_t charId, uint16_t offset,
+	                       BluetoothByteSpan value)
+	{
+		if (static_cast<size_t>(offset) + value.size() > maxAttributeLength)
+			return BLUETOOTH_ERROR_PARAM_INVALID;
+
+		Client &client = clients[address];
+		if (client.arena.capacity() == 0)
+			client.arena.reserve(maxQueueLength);
+
+		if (client.arena.size() + value.size() > client.arena.capacity())
+			return BLUETOOTH_ERROR_NOMEM;
+
+		Fragment fragment;
+		fragment.serviceId = serviceId;
+		fragment.charId = charId;
+		fragment.offset = offset;
+		fragment.position = client.arena.size();
+		fragment.length = value.size();
+
+		client.arena.insert(client.arena.end(), value.data(), value.data() + value.size());
+		client.fragments.push_back(fragment);
+		return BLUETOOTH_ERROR_NONE;
+	}
+
+	BluetoothError prepare(const std::string &address, uint16_t serviceId, uint16_t charId, uint16_t offset,
+	                       BluetoothByteSpan value)
+	{
+		return prepare(BluetoothAddress(address), serviceId, charId, offset, value);
+	}
+
+	/**
+	 * @brief Queue a fragment following the fragments already queued for the
+	 *        characteristic, for stacks which don't report offsets
+	 * @param address Address of the client
+	 * @param serviceId Service handle
+	 * @param charId Characteristic handle
+	 * @param value Fragment. Only needs to be valid during the call.
+	 * @return Result as for prepare()
+	 */
+	BluetoothError append(const BluetoothAddress &address, uint16_t serviceId, uint16_t charId, BluetoothByteSpan value)
+	{
+		size_t end = 0;
+
+		auto iter = clients.find(address);
+		if (iter != clients.end())
+		{
+			for (auto &fragment : iter->second.fragments)
+			{
+				if (fragment.serviceId == serviceId && fragment.charId == charId)
+					end = std::max<size_t>(end, fragment.offset + fragment.length);
+			}
+		}
+
+		if (end + value.size() > maxAttributeLength)
+			return BLUETOOTH_ERROR_PARAM_INVALID;
+
+		return prepare(address, serviceId, charId, static_cast<uint16_t>(end), value);
+	}
+
+	BluetoothError append(const std::string &address, uint16_t serviceId, uint16_t charId, BluetoothByteSpan value)
+	{
+		return append(BluetoothAddress(address), serviceId, charId, value);
+	}
+
+	/**
+	 * @brief Execute the prepared writes of a client
+	 *
+	 *        The values are delivered in the order their characteristics were
+	 *        first prepared. Fragments of a characteristic are applied in the
+	 *        order they were queued; a later fragment overwrites the bytes of an
+	 *        earlier one. The queue of the client is empty afterwards, also if
+	 *        the execution failed.
+	 *
+	 * @param address Address of the client
+	 * @param callback Callback receiving the values
+	 * @return BLUETOOTH_ERROR_PARAM_INVALID without delivering any value if a
+	 *         fragment starts behind the end of the value written before it.
+	 *         Values replace the whole attribute value, so the first fragment of
+	 *         a characteristic has to start at offset 0.
+	 */
+	BluetoothError execute(const BluetoothAddress &address, ExecuteCallback callback)
+	{
+		auto iter = clients.find(address);
+		if (iter == clients.end() || iter->second.fragments.empty())
+			return BLUETOOTH_ERROR_NONE;
+
+		// Take the fragments over, so the callback may prepare the next writes
+		Client &client = iter->second;
+		executing.arena.swap(client.arena);
+		executing.fragments.swap(client.fragments);
+		client.arena.clear();
+		client.fragments.clear();
+
+		BluetoothError error = validate(executing.fragments);
+
+		for (size_t n = 0; error == BLUETOOTH_ERROR_NONE && n < executing.fragments.size(); n++)
+		{
+			const Fragment &first = executing.fragments[n];
+			if (isPrecededBy(executing.fragments, n))
+				continue;
+
+			value.clear();
+			for (size_t m = n; m < executing.fragments.size(); m++)
+			{
+				const Fragment &fragment = executing.fragments[m];
+				if (fragment.serviceId != first.serviceId || fragment.charId != first.charId)
+					continue;
+
+				if (fragment.offset + fragment.length > value.size())
+					value.resize(fragment.offset + fragment.length);
+
+				std::copy(executing.arena.begin() + fragment.position,
+				          executing.arena.begin() + fragment.position + fragment.length,
+				          value.begin() + fragment.offset);
+			}
+
+			if (callback)
+				callback(address, first.serviceId, first.charId, value);
+		}
+
+		executing.arena.clear();
+		executing.fragments.clear();
+
+		// Hand the reserved arena back unless the callback prepared new writes
+		iter = clients.find(address);
+		if (iter != clients.end() && iter->second.fragments.empty())
+		{
+			iter->second.arena.swap(executing.arena);
+			iter->second.fragments.swap(executing.fragments);
+		}
+
+		return error;
+	}
+
+	BluetoothError execute(const std::string &address, ExecuteCallback callback)
+	{
+		return execute(BluetoothAddress(address), std::move(callback));
+	}
+
+	/**
+	 * @brief Discard the prepared writes of a client
+	 * @param address Address of the client
+	 */
+	void cancel(const BluetoothAddress &address)
+	{
+		auto iter = clients.find(address);
+		if (iter == clients.end())
+			return;
+
+		iter->second.arena.clear();
+		iter->second.fragments.clear();
+	}
+
+	void cancel(const std::string &address) { cancel(BluetoothAddress(address)); }
+
+	/**
+	 * @brief Handle a write reported with a ContinueType
+	 *
+	 *        SHORT_VALUE writes are delivered right away, CONTINUE_VALUE
+	 *        fragments are appended, END_VALUE appends its fragment if it isn't
+	 *        empty and executes the queue, CANCEL_VALUE discards it.
+	 *
+	 * @param address Address of the client
+	 * @param serviceId Service handle
+	 * @param charId Characteristic handle
+	 * @param value Value or fragment. Only needs to be valid during the call.
+	 * @param type Continue type reported by the stack
+	 * @param callback Callback receiving complete values
+	 * @return Result of the operation
+	 */
+	BluetoothError write(const BluetoothAddress &address, uint16_t serviceId, uint16_t charId, BluetoothByteSpan value,
+	                     ContinueType type, ExecuteCallback callback)
+	{
+		switch (type)
+		{
+		case SHORT_VALUE:
+			if (value.size() > maxAttributeLength)
+				return BLUETOOTH_ERROR_PARAM_INVALID;
+
+			this->value.assign(value.data(), value.data() + value.size());
+			if (callback)
+				callback(address, serviceId, charId, this->value);
+			return BLUETOOTH_ERROR_NONE;
+		case CONTINUE_VALUE:
+			return append(address, serviceId, charId, value);
+		case END_VALUE:
+			if (!value.empty())
+			{
+				BluetoothError error = append(address, serviceId, charId, value);
+				if (error != BLUETOOTH_ERROR_NONE)
+				{
+					cancel(address);
+					return error;
+				}
+			}
+
+			return execute(address, std::move(callback));
+		case CANCEL_VALUE:
+			cancel(address);
+			return BLUETOOTH_ERROR_NONE;
+		}
+
+		return BLUETOOTH_ERROR_PARAM_INVALID;
+	}
+
+	BluetoothError write(const std::string &address, uint16_t serviceId, uint16_t charId, BluetoothByteSpan value,
+	                     ContinueType type, ExecuteCallback callback)
+	{
+		return write(BluetoothAddress(address), serviceId, charId, value, type, std::move(callback));
+	}
+
+	/**
+	 * @brief Discard the queue of a client and release its memory after it
+	 *        has disconnected
+	 * @param address Address of the client
+	 */
+	void disconnected(const BluetoothAddress &address) { clients.erase(address); }
+
+	void disconnected(const std::string &address) { disconnected(BluetoothAddress(address)); }
+
+	/**
+	 * @brief Retrieve the number of bytes prepared by a client
+	 * @param address Address of the client
+	 * @return Number of bytes
+	 */
+	size_t size(const BluetoothAddress &address) const
+	{
+		auto iter = clients.find(address);
+		return iter == clients.end() ? 0 : iter->second.arena.size();
+	}
+
+	size_t size(const std::string &address) const { return size(BluetoothAddress(address)); }
+
+private:
+	struct Fragment
+	{
+		uint16_t serviceId;
+		uint16_t charId;
+		uint16_t offset;
+		uint32_t position;
+		uint32_t length;
+	};
+
+	struct Client
+	{
+		std::vector<uint8_t> arena;
+		std::vector<Fragment> fragments;
+	};
+
+	// Check if a fragment of the same characteristic was queued before the given one
+	static bool isPrecededBy(const std::vector<Fragment> &fragments, size_t index)
+	{
+		for (size_t n = 0; n < index; n++)
+		{
+			if (fragments[n].serviceId == fragments[index].serviceId && fragments[n].charId == fragments[index].charId)
+				return true;
+		}
+
+		return false;
+	}
+
+	// Every fragment has to start within or right behind the value written before it
+	static BluetoothError validate(const std::vector<Fragment> &fragments)
+	{
+		for (size_t n = 0; n < fragments.size(); n++)
+		{
+			if (isPrecededBy(fragments, n))
+				continue;
+
+			size_t length = 0;
+			for (size_t m = n; m < fragments.size(); m++)
+			{
+				if (fragments[m].serviceId != fragments[n].serviceId || fragments[m].charId != fragments[n].charId)
+					continue;
+
+				if (fragments[m].offset > length)
+					return BLUETOOTH_ERROR_PARAM_INVALID;
+
+				length = std::max<size_t>(length, fragments[m].offset + fragments[m].length);
+			}
+		}
+
+		return BLUETOOTH_ERROR_NONE;
+	}
+
+	uint16_t maxAttributeLength;
+	size_t maxQueueLength;
+	std::unordered_map<BluetoothAddress, Client> clients;
+	// Queue of the client whose writes are executed
+	Client executing;
+	// Assembled value passed to the callbacks
+	BluetoothGattValue value;
+};
+
+#endif
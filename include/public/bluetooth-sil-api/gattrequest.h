@@ -0,0 +1,910 @@
+// Copyright (c) 2026 LG Electronics, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef BLUETOOTH_SIL_GATTREQUEST_H_
+#define BLUETOOTH_SIL_GATTREQUEST_H_
+
+#ifndef BLUETOOTH_SIL_H_
+	#error This header file should only be included by bluetooth-sil-api.h
+#endif
+
+#include <deque>
+#include <limits>
+
+/**
+ * @brief ATT bearer of a connection used by BluetoothGattRequestEngine.
+ */
+class BluetoothAttBearer
+{
+public:
+	virtual ~BluetoothAttBearer() { }
+
+	/**
+	 * @brief Send an ATT PDU
+	 *
+	 *        Every PDU occupies one controller buffer until the controller
+	 *        reports it as completed through
+	 *        BluetoothGattRequestEngine::packetsCompleted.
+	 *
+	 * @param pdu PDU starting with the opcode
+	 */
+	virtual void send(const std::vector<uint8_t> &pdu) = 0;
+};
+
+/**
+ * @brief Sequences the GATT client operations of a single connection.
+ *
+ *        SIL implementations queue the reads and writes of a connection in the
+ *        engine, pass the ATT PDUs received from the server to receive() and
+ *        the completed packets reported by the controller to packetsCompleted().
+ *        The engine then defines how requests are put on air:
+ *
+ *        - Operations are sent in the order they were queued. ATT only allows
+ *          a single outstanding request, so requests wait for the response of
+ *          the previous one.
+ *        - Reads queued back to back are coalesced into a single Read Multiple
+ *          Variable Length request if the server supports it (Server Supported
+ *          Features, Core 5.2). Values which don't fit into the response are
+ *          read again. If the server rejects the request, the engine falls back
+ *          to single Read requests for the rest of the connection. Plain Read
+ *          Multiple isn't used as its response can't be split into values of
+ *          unknown length.
+ *        - Write Commands don't wait for responses. They are sent as long as
+ *          the controller has free buffers (credits), so a burst fills every
+ *          connection event.
+ *        - Write requests with values longer than the MTU allows are split
+ *          into Prepare Write requests and executed at once (long write).
+ *          If a part fails, the prepared parts are cancelled.
+ *        - Every operation has a deadline. Queued operations whose deadline
+ *          expires fail with BLUETOOTH_ERROR_ABORTED. Long writes are exempt
+ *          once their first part was sent. A request without response
+ *          for ATT_TIMEOUT milliseconds closes the bearer as required by ATT;
+ *          all operations fail then.
+ *
+ *        Callbacks are called with the values of ATT Error Responses mapped to
+ *        BluetoothError. The engine doesn't depend on a main loop; the SIL calls
+ *        run() when the delay returned by the last call has expired. The engine
+ *        isn't thread-safe.
+ */
+class BluetoothGattRequestEngine
+{
+public:
+	typedef std::function<void(BluetoothError error, const BluetoothGattValue &value)> ReadCallback;
+	typedef std::function<void(BluetoothError error, const std::vector<BluetoothGattValue> &values)> ReadMultipleCallback;
+
+	/// Time in milliseconds after which an outstanding request times out
+	static const uint32_t ATT_TIMEOUT = 30000;
+	/// Default MTU of the LE ATT bearer
+	static const uint16_t DEFAULT_MTU = 23;
+	/// Maximum length of an attribute value
+	static const uint16_t MAX_ATTRIBUTE_LENGTH = 512;
+
+	/**
+	 * @brief ATT opcodes used by the engine
+	 */
+	enum Opcode
+	{
+		ERROR_RESPONSE = 0x01,
+		EXCHANGE_MTU_REQUEST = 0x02,
+		EXCHANGE_MTU_RESPONSE = 0x03,
+		READ_REQUEST = 0x0a,
+		READ_RESPONSE = 0x0b,
+		WRITE_REQUEST = 0x12,
+		WRITE_RESPONSE = 0x13,
+		PREPARE_WRITE_REQUEST = 0x16,
+		PREPARE_WRITE_RESPONSE = 0x17,
+		EXECUTE_WRITE_REQUEST = 0x18,
+		EXECUTE_WRITE_RESPONSE = 0x19,
+		READ_MULTIPLE_VARIABLE_REQUEST = 0x20,
+		READ_MULTIPLE_VARIABLE_RESPONSE = 0x21,
+		WRITE_COMMAND = 0x52
+	};
+
+	/**
+	 * @brief Number of operations since the creation of the engine
+	 */
+	struct Statistics
+	{
+		Statistics() :
+			readRequests(0),
+			readMultipleRequests(0),
+			coalescedReads(0),
+			writeRequests(0),
+			prepareWriteRequests(0),
+			writeCommands(0)
+		{
+		}
+
+		/// Number of Read requests sent
+		uint64_t readRequests;
+		/// Number of Read Multiple Variable Length requests sent
+		uint64_t readMultipleRequests;
+		/// Number of reads carried by Read Multiple Variable Length requests
+		uint64_t coalescedReads;
+		/// Number of Write requests sent
+		uint64_t writeRequests;
+		/// Number of Prepare Write requests sent for long writes
+		uint64_t prepareWriteRequests;
+		/// Number of Write Commands sent
+		uint64_t writeCommands;
+	};
+
+	/**
+	 * @brief Create an engine
+	 * @param bearer Bearer the PDUs are sent over
+	 * @param credits Number of controller buffers available to the connection
+	 */
+	BluetoothGattRequestEngine(BluetoothAttBearer *bearer, uint16_t credits = 4) :
+		bearer(bearer),
+		mtu(DEFAULT_MTU),
+		credits(credits),
+		readMultipleVariable(false),
+		mtuExchanged(false),
+		closed(false),
+		outstandingOpcode(0),
+		requestSent(0)
+	{
+	}
+
+	/**
+	 * @brief Set the MTU after an exchange the engine didn't take part in,
+	 *        e.g. one started by the server
+	 * @param mtu MTU of the bearer
+	 */
+	void setMtu(uint16_t mtu)
+	{
+		this->mtu = DEFAULT_MTU;
+		if (mtu > this->mtu)
+			this->mtu = mtu;
+	}
+
+	uint16_t getMtu() const { return mtu; }
+
+	/**
+	 * @brief Queue an exchange of the MTU with the server
+	 *
+	 *        ATT allows a single exchange per connection. Later calls report
+	 *        the current MTU without sending a request.
+	 *
+	 * @param mtu MTU the client is able to receive
+	 * @param timeout Time in milliseconds the exchange may stay queued
+	 * @param now Current time in milliseconds
+	 * @param callback Callback which receives the resulting MTU
+	 */
+	void exchangeMtu(uint16_t mtu, uint32_t timeout, uint64_t now, BluetoothGattMtuCallback callback)
+	{
+		if (mtuExchanged && !closed)
+		{
+			if (callback)
+				callback(BLUETOOTH_ERROR_NONE, this->mtu);
+			return;
+		}
+
+		mtuExchanged = true;
+
+		// The handle carries the MTU of the client
+		Operation operation(Operation::EXCHANGE_MTU, mtu, now + timeout);
+		if (operation.handle < DEFAULT_MTU)
+			operation.handle = DEFAULT_MTU;
+
+		operation.mtuCallback = std::move(callback);
+		submit(std::move(operation), now);
+	}
+
+	/**
+	 * @brief Set if the server supports Read Multiple Variable Length
+	 * @param supported True if the server announced the EATT supported feature
+	 */
+	void setReadMultipleVariableSupported(bool supported) { readMultipleVariable = supported; }
+
+	/**
+	 * @brief Queue a read of a characteristic or descriptor value
+	 *
+	 *        Values longer than the MTU are truncated to the part returned by a
+	 *        single read.
+	 *
+	 * @param handle Handle of the attribute
+	 * @param timeout Time in milliseconds the read may stay queued
+	 * @param now Current time in milliseconds
+	 * @param callback Callback which receives the value
+	 */
+	void read(uint16_t handle, uint32_t timeout, uint64_t now, ReadCallback callback)
+	{
+		Operation operation(Operation::READ, handle, now + timeout);
+		operation.readCallback = std::move(callback);
+		submit(std::move(operation), now);
+	}
+
+	/**
+	 * @brief Queue reads of several values
+	 *
+	 *        The reads are queued back to back, so they are coalesced if the
+	 *        server supports it.
+	 *
+	 * @param handles Handles of the attributes
+	 * @param timeout Time in milliseconds the reads may stay queued
+	 * @param now Current time in milliseconds
+	 * @param callback Callback which receives the values in the order of the
+	 *        handles. Called with the first error if any read fails.
+	 */
+	void read(const std::vector<uint16_t> &handles, uint32_t timeout, uint64_t now, ReadMultipleCallback callback)
+	{
+		if (handles.empty())
+		{
+			if (callback)
+				callback(BLUETOOTH_ERROR_PARAM_INVALID, std::vector<BluetoothGattValue>());
+			return;
+		}
+
+		struct Result
+		{
+			Result(size_t count, ReadMultipleCallback callback) :
+				values(count), remaining(count), error(BLUETOOTH_ERROR_NONE), callback(std::move(callback)) { }
+
+			std::vector<BluetoothGattValue> values;
+			size_t remaining;
+			BluetoothError error;
+			ReadMultipleCallback callback;
+		};
+
+		std::shared_ptr<Result> result = std::make_shared<Result>(handles.size(), std::move(callback));
+
+		for (size_t n = 0; n < handles.size(); n++)
+		{
+			Operation operation(Operation::READ, handles[n], now + timeout);
+			operation.readCallback = [result, n](BluetoothError error, const BluetoothGattValue &value) {
+				if (error != BLUETOOTH_ERROR_NONE && result->error == BLUETOOTH_ERROR_NONE)
+					result->error = error;
+
+				result->values[n] = value;
+
+				if (--result->remaining == 0 && result->callback)
+				{
+					if (result->error != BLUETOOTH_ERROR_NONE)
+						result->values.clear();
+
+					result->callback(result->error, result->values);
+				}
+			};
+
+			// Queue all reads before sending, so the first one isn't sent on its own
+			enqueue(std::move(operation));
+		}
+
+		pump(now);
+	}
+
+	/**
+	 * @brief Queue a write of a characteristic or descriptor value
+	 *
+	 * @param handle Handle of the attribute
+	 * @param value Value to write. Up to MTU - 3 bytes for Write Commands,
+	 *        up to MAX_ATTRIBUTE_LENGTH bytes for Write requests.
+	 * @param withResponse True to send a Write request, false to send a Write
+	 *        Command
+	 * @param timeout Time in milliseconds the write may stay queued
+	 * @param now Current time in milliseconds
+	 * @param callback Callback which is called with the result of a Write
+	 *        request or once the controller has sent a Write Command
+	 */
+	void write(uint16_t handle, BluetoothGattValue value, bool withResponse, uint32_t timeout, uint64_t now,
+	           BluetoothResultCallback callback)
+	{
+		Operation operation(withResponse ? Operation::WRITE_REQUEST : Operation::WRITE_COMMAND, handle, now + timeout);
+		operation.value = std::move(value);
+		operation.writeCallback = std::move(callback);
+		submit(std::move(operation), now);
+	}
+
+	/**
+	 * @brief Handle a PDU received from the server
+	 * @param pdu PDU starting with the opcode
+	 * @param size Size of the PDU
+	 * @param now Current time in milliseconds
+	 * @return True if the PDU was a response to the outstanding request. False
+	 *         if it's malformed, unexpected or not a response.
+	 */
+	bool receive(const uint8_t *pdu, size_t size, uint64_t now)
+	{
+		if (size == 0 || outstanding.empty())
+			return false;
+
+		uint8_t expected = responseOpcode(outstandingOpcode);
+		bool result = true;
+		Completions completions;
+
+		if (pdu[0] == ERROR_RESPONSE && size >= 5 && pdu[1] == outstandingOpcode)
+			handleError(pdu[4], pdu[2] | (pdu[3] << 8), completions);
+		else if (pdu[0] != expected)
+			result = false;
+		else if (expected == READ_MULTIPLE_VARIABLE_RESPONSE)
+			handleReadMultipleVariable(pdu + 1, size - 1, completions);
+		else if (expected == EXCHANGE_MTU_RESPONSE)
+			result = handleExchangeMtu(pdu + 1, size - 1, completions);
+		else if (expected == PREPARE_WRITE_RESPONSE)
+			handlePrepareWrite(pdu + 1, size - 1);
+		else
+			complete(outstanding.front(), outstanding.front().error, BluetoothGattValue(pdu + 1, pdu + size), completions);
+
+		if (result)
+			outstanding.clear();
+
+		pump(now);
+		notify(completions);
+		return result;
+	}
+
+	/**
+	 * @brief Return credits after the controller reported completed packets
+	 *        (HCI Number Of Completed Packets)
+	 *
+	 *        Only packets the engine sent return a credit, so packets of other
+	 *        users of the connection can't raise the credits above the buffers
+	 *        the controller has.
+	 *
+	 * @param count Number of completed packets of the connection
+	 * @param now Current time in milliseconds
+	 */
+	void packetsCompleted(uint16_t count, uint64_t now)
+	{
+		Completions completions;
+
+		for (; count > 0 && !inFlight.empty(); count--)
+		{
+			if (inFlight.front())
+				completions.push_back(std::bind(inFlight.front(), BLUETOOTH_ERROR_NONE));
+
+			inFlight.pop_front();
+			credits++;
+		}
+
+		pump(now);
+		notify(completions);
+	}
+
+	/**
+	 * @brief Expire operations whose deadline has passed
+	 * @param now Current time in milliseconds
+	 * @param delay Receives the time in milliseconds after which run() has to
+	 *        be called again
+	 * @return True if run() has to be called again after the delay. False if
+	 *         nothing is pending.
+	 */
+	bool run(uint64_t now, uint32_t &delay)
+	{
+		Completions completions;
+
+		if (!outstanding.empty() && now >= requestSent + ATT_TIMEOUT)
+		{
+			// No further requests may be sent on the bearer after a timeout
+			closed = true;
+			failAll(BLUETOOTH_ERROR_ABORTED, completions);
+		}
+
+		for (auto iter = queue.begin(); iter != queue.end(); )
+		{
+			if (iter->deadline > now || isLongWriteStarted(*iter))
+			{
+				++iter;
+				continue;
+			}
+
+			complete(*iter, BLUETOOTH_ERROR_ABORTED, BluetoothGattValue(), completions);
+			iter = queue.erase(iter);
+		}
+
+		notify(completions);
+
+		uint64_t wakeup = std::numeric_limits<uint64_t>::max();
+		if (!outstanding.empty())
+			wakeup = requestSent + ATT_TIMEOUT;
+
+		for (auto &operation : queue)
+		{
+			if (!isLongWriteStarted(operation))
+				wakeup = std::min(wakeup, operation.deadline);
+		}
+
+		if (wakeup == std::numeric_limits<uint64_t>::max())
+			return false;
+
+		delay = static_cast<uint32_t>(std::min<uint64_t>(wakeup - now, std::numeric_limits<uint32_t>::max()));
+		return true;
+	}
+
+	/**
+	 * @brief Fail all operations after the connection was closed
+	 *
+	 *        The engine accepts operations again afterwards, e.g. for the next
+	 *        connection to the device.
+	 *
+	 * @param credits Number of controller buffers for the next connection
+	 */
+	void disconnected(uint16_t credits)
+	{
+		Completions completions;
+		failAll(BLUETOOTH_ERROR_DEVICE_NOT_CONNECTED, completions);
+
+		inFlight.clear();
+		this->credits = credits;
+		mtu = DEFAULT_MTU;
+		readMultipleVariable = false;
+		mtuExchanged = false;
+		closed = false;
+
+		notify(completions);
+	}
+
+	/**
+	 * @brief Retrieve the number of queued operations
+	 * @return Number of operations which weren't sent yet
+	 */
+	size_t size() const { return queue.size(); }
+
+	/**
+	 * @brief Check if a request is waiting for its response
+	 * @return True if a request is outstanding
+	 */
+	bool isBusy() const { return !outstanding.empty(); }
+
+	uint16_t getCredits() const { return credits; }
+
+	const Statistics& getStatistics() const { return statistics; }
+
+private:
+	typedef std::vector<std::function<void()>> Completions;
+
+	struct Operation
+	{
+		enum Type
+		{
+			READ,
+			WRITE_REQUEST,
+			WRITE_COMMAND,
+			EXCHANGE_MTU
+		};
+
+		// Progress of a Write request
+		enum Stage
+		{
+			WRITE,
+			PREPARE,
+			EXECUTE,
+			CANCEL
+		};
+
+		Operation(Type type, uint16_t handle, uint64_t deadline) :
+			type(type),
+			handle(handle),
+			deadline(deadline),
+			single(false),
+			stage(WRITE),
+			offset(0),
+			error(BLUETOOTH_ERROR_NONE)
+		{
+		}
+
+		Type type;
+		uint16_t handle;
+		uint64_t deadline;
+		// Read without coalescing, e.g. after the value didn't fit into a Read Multiple Variable response
+		bool single;
+		Stage stage;
+		// Offset of the next part of a long write
+		uint16_t offset;
+		// Error reported once a cancelled long write is discarded by the server
+		BluetoothError error;
+		BluetoothGattValue value;
+		ReadCallback readCallback;
+		BluetoothResultCallback writeCallback;
+		BluetoothGattMtuCallback mtuCallback;
+	};
+
+	// A long write which has sent its first part has to run to its Execute Write,
+	// otherwise the server keeps the prepared parts for the next long write
+	static bool isLongWriteStarted(const Operation &operation)
+	{
+		return operation.type == Operation::WRITE_REQUEST && operation.stage != Operation::WRITE;
+	}
+
+	static uint8_t responseOpcode(uint8_t request)
+	{
+		switch (request)
+		{
+		case EXCHANGE_MTU_REQUEST:
+			return EXCHANGE_MTU_RESPONSE;
+		case READ_REQUEST:
+			return READ_RESPONSE;
+		case READ_MULTIPLE_VARIABLE_REQUEST:
+			return READ_MULTIPLE_VARIABLE_RESPONSE;
+		case WRITE_REQUEST:
+			return WRITE_RESPONSE;
+		case PREPARE_WRITE_REQUEST:
+			return PREPARE_WRITE_RESPONSE;
+		case EXECUTE_WRITE_REQUEST:
+			return EXECUTE_WRITE_RESPONSE;
+		default:
+			return 0;
+		}
+	}
+
+	static BluetoothError mapError(uint8_t code)
+	{
+		switch (code)
+		{
+		case 0x01: // Invalid Handle
+		case 0x0a: // Attribute Not Found
+		case 0x0d: // Invalid Attribute Value Length
+			return BLUETOOTH_ERROR_PARAM_INVALID;
+		case 0x02: // Read Not Permitted
+		case 0x03: // Write Not Permitted
+		case 0x05: // Insufficient Authentication
+		case 0x08: // Insufficient Authorization
+		case 0x0c: // Insufficient Encryption Key Size
+		case 0x0f: // Insufficient Encryption
+			return BLUETOOTH_ERROR_NOT_ALLOWED;
+		case 0x06: // Request Not Supported
+			return BLUETOOTH_ERROR_UNSUPPORTED;
+		default:
+			return BLUETOOTH_ERROR_FAIL;
+		}
+	}
+
+	void submit(Operation &&operation, uint64_t now)
+	{
+		enqueue(std::move(operation));
+		pump(now);
+	}
+
+	void enqueue(Operation &&operation)
+	{
+		if (closed)
+		{
+			Completions completions;
+			complete(operation, BLUETOOTH_ERROR_NOT_READY, BluetoothGattValue(), completions);
+			notify(completions);
+			return;
+		}
+
+		queue.push_back(std::move(operation));
+	}
+
+	// Send as many queued operations as the bearer and the credits allow
+	void pump(uint64_t now)
+	{
+		Completions completions;
+
+		while (credits > 0 && !queue.empty() && !closed)
+		{
+			Operation &front = queue.front();
+
+			if (front.type == Operation::WRITE_COMMAND)
+			{
+				if (front.value.size() + 3 > mtu)
+				{
+					complete(front, BLUETOOTH_ERROR_PARAM_INVALID, BluetoothGattValue(), completions);
+					queue.pop_front();
+					continue;
+				}
+
+				std::vector<uint8_t> pdu;
+				pdu.reserve(front.value.size() + 3);
+				pdu.push_back(WRITE_COMMAND);
+				appendHandle(pdu, front.handle);
+				pdu.insert(pdu.end(), front.value.begin(), front.value.end());
+
+				send(pdu, std::move(front.writeCallback));
+				statistics.writeCommands++;
+				queue.pop_front();
+				continue;
+			}
+
+			// Requests and the commands queued after them wait for the response
+			if (!outstanding.empty())
+				break;
+
+			std::vector<uint8_t> pdu;
+
+			if (front.type == Operation::EXCHANGE_MTU)
+			{
+				pdu.push_back(EXCHANGE_MTU_REQUEST);
+				appendHandle(pdu, front.handle);
+			}
+			else if (front.type == Operation::WRITE_REQUEST)
+			{
+				if (front.value.size() > MAX_ATTRIBUTE_LENGTH)
+				{
+					complete(front, BLUETOOTH_ERROR_PARAM_INVALID, BluetoothGattValue(), completions);
+					queue.pop_front();
+					continue;
+				}
+
+				if (front.stage == Operation::WRITE && front.value.size() + 3 > mtu)
+					front.stage = Operation::PREPARE;
+
+				buildWrite(front, pdu);
+			}
+			else
+			{
+				size_t count = coalescableReads();
+
+				pdu.push_back(count > 1 ? READ_MULTIPLE_VARIABLE_REQUEST : READ_REQUEST);
+				for (size_t n = 0; n < count; n++)
+					appendHandle(pdu, queue[n].handle);
+
+				if (count > 1)
+				{
+					statistics.readMultipleRequests++;
+					statistics.coalescedReads += count;
+				}
+				else
+				{
+					statistics.readRequests++;
+				}
+			}
+
+			size_t count = pdu[0] == READ_MULTIPLE_VARIABLE_REQUEST ? (pdu.size() - 1) / 2 : 1;
+			for (size_t n = 0; n < count; n++)
+			{
+				outstanding.push_back(std::move(queue.front()));
+				queue.pop_front();
+			}
+
+			outstandingOpcode = pdu[0];
+			requestSent = now;
+			send(pdu, BluetoothResultCallback());
+		}
+
+		notify(completions);
+	}
+
+	void buildWrite(Operation &operation, std::vector<uint8_t> &pdu)
+	{
+		switch (operation.stage)
+		{
+		case Operation::WRITE:
+			pdu.push_back(WRITE_REQUEST);
+			appendHandle(pdu, operation.handle);
+			pdu.insert(pdu.end(), operation.value.begin(), operation.value.end());
+			statistics.writeRequests++;
+			break;
+		case Operation::PREPARE:
+		{
+			size_t length = preparedLength(operation);
+			pdu.push_back(PREPARE_WRITE_REQUEST);
+			appendHandle(pdu, operation.handle);
+			appendHandle(pdu, operation.offset);
+			pdu.insert(pdu.end(), operation.value.begin() + operation.offset,
+			           operation.value.begin() + operation.offset + length);
+			statistics.prepareWriteRequests++;
+			break;
+		}
+		case Operation::EXECUTE:
+		case Operation::CANCEL:
+			pdu.push_back(EXECUTE_WRITE_REQUEST);
+			pdu.push_back(operation.stage == Operation::EXECUTE ? 0x01 : 0x00);
+			break;
+		}
+	}
+
+	// Length of the next part of a long write. Handle and offset take four bytes of the request.
+	size_t preparedLength(const Operation &operation) const
+	{
+		return std::min<size_t>(operation.value.size() - operation.offset, mtu - 5);
+	}
+
+	bool handleExchangeMtu(const uint8_t *data, size_t size, Completions &completions)
+	{
+		if (size < 2)
+			return false;
+
+		uint16_t serverMtu = data[0] | (data[1] << 8);
+		setMtu(std::min(outstanding.front().handle, serverMtu));
+		complete(outstanding.front(), BLUETOOTH_ERROR_NONE, BluetoothGattValue(), completions);
+		return true;
+	}
+
+	void handlePrepareWrite(const uint8_t *data, size_t size)
+	{
+		Operation &operation = outstanding.front();
+		size_t length = preparedLength(operation);
+
+		// The server echoes the part, which has to arrive unchanged
+		bool valid = size == length + 4 &&
+		             (data[0] | (data[1] << 8)) == operation.handle &&
+		             (data[2] | (data[3] << 8)) == operation.offset &&
+		             std::equal(data + 4, data + size, operation.value.begin() + operation.offset);
+
+		if (!valid)
+		{
+			operation.error = BLUETOOTH_ERROR_FAIL;
+			operation.stage = Operation::CANCEL;
+		}
+		else
+		{
+			operation.offset += length;
+			if (operation.offset == operation.value.size())
+				operation.stage = Operation::EXECUTE;
+		}
+
+		// The long write continues before any other request
+		requeue(0);
+	}
+
+	size_t coalescableReads() const
+	{
+		if (!readMultipleVariable)
+			return 1;
+
+		// Opcode and two handles per read have to fit into the request
+		size_t limit = (mtu - 1) / 2;
+		size_t count = 0;
+
+		while (count < limit && count < queue.size() && queue[count].type == Operation::READ && !queue[count].single)
+			count++;
+
+		return std::max<size_t>(count, 1);
+	}
+
+	void send(const std::vector<uint8_t> &pdu, BluetoothResultCallback callback)
+	{
+		credits--;
+		inFlight.push_back(std::move(callback));
+		bearer->send(pdu);
+	}
+
+	void handleError(uint8_t code, uint16_t handle, Completions &completions)
+	{
+		if (outstandingOpcode == PREPARE_WRITE_REQUEST && outstanding.front().offset > 0)
+		{
+			// Discard the parts the server has queued already
+			outstanding.front().error = mapError(code);
+			outstanding.front().stage = Operation::CANCEL;
+			requeue(0);
+			return;
+		}
+
+		if (outstandingOpcode == EXECUTE_WRITE_REQUEST && outstanding.front().stage == Operation::CANCEL)
+		{
+			complete(outstanding.front(), outstanding.front().error, BluetoothGattValue(), completions);
+			return;
+		}
+
+		if (outstandingOpcode == READ_MULTIPLE_VARIABLE_REQUEST && code == 0x06)
+		{
+			// Not supported after all, read the values one by one
+			readMultipleVariable = false;
+			requeue(0);
+			return;
+		}
+
+		if (outstanding.size() == 1)
+		{
+			complete(outstanding.front(), mapError(code), BluetoothGattValue(), completions);
+			return;
+		}
+
+		// Only the read the error refers to fails, the others are read again
+		for (size_t n = 0; n < outstanding.size(); n++)
+		{
+			if (outstanding[n].handle == handle)
+			{
+				complete(outstanding[n], mapError(code), BluetoothGattValue(), completions);
+				outstanding.erase(outstanding.begin() + n);
+				requeue(0);
+				return;
+			}
+		}
+
+		for (auto &operation : outstanding)
+			complete(operation, mapError(code), BluetoothGattValue(), completions);
+	}
+
+	void handleReadMultipleVariable(const uint8_t *data, size_t size, Completions &completions)
+	{
+		size_t offset = 0;
+
+		for (size_t n = 0; n < outstanding.size(); n++)
+		{
+			if (size - offset < 2)
+			{
+				requeue(n);
+				return;
+			}
+
+			size_t length = data[offset] | (data[offset + 1] << 8);
+			offset += 2;
+
+			if (length > size - offset)
+			{
+				// The value was truncated, read it on its own
+				outstanding[n].single = true;
+				requeue(n);
+				return;
+			}
+
+			complete(outstanding[n], BLUETOOTH_ERROR_NONE, BluetoothGattValue(data + offset, data + offset + length), completions);
+			offset += length;
+		}
+	}
+
+	// Put the outstanding operations starting at position back to the front of the queue
+	void requeue(size_t position)
+	{
+		for (size_t n = outstanding.size(); n > position; n--)
+			queue.push_front(std::move(outstanding[n - 1]));
+	}
+
+	void complete(Operation &operation, BluetoothError error, BluetoothGattValue value, Completions &completions)
+	{
+		if (operation.type == Operation::READ)
+		{
+			if (operation.readCallback)
+				completions.push_back(std::bind(std::move(operation.readCallback), error, std::move(value)));
+		}
+		else if (operation.type == Operation::EXCHANGE_MTU)
+		{
+			if (operation.mtuCallback)
+				completions.push_back(std::bind(std::move(operation.mtuCallback), error, mtu));
+		}
+		else if (operation.writeCallback)
+		{
+			completions.push_back(std::bind(std::move(operation.writeCallback), error));
+		}
+	}
+
+	void failAll(BluetoothError error, Completions &completions)
+	{
+		for (auto &operation : outstanding)
+			complete(operation, error, BluetoothGattValue(), completions);
+
+		for (auto &operation : queue)
+			complete(operation, error, BluetoothGattValue(), completions);
+
+		outstanding.clear();
+		queue.clear();
+	}
+
+	// Callbacks are called last as they may queue further operations
+	static void notify(Completions &completions)
+	{
+		for (auto &completion : completions)
+			completion();
+	}
+
+	static void appendHandle(std::vector<uint8_t> &pdu, uint16_t handle)
+	{
+		pdu.push_back(handle & 0xff);
+		pdu.push_back(handle >> 8);
+	}
+
+	BluetoothAttBearer *bearer;
+	uint16_t mtu;
+	uint16_t credits;
+	bool readMultipleVariable;
+	bool mtuExchanged;
+	bool closed;
+	std::deque<Operation> queue;
+	// Operations of the request waiting for its response
+	std::vector<Operation> outstanding;
+	uint8_t outstandingOpcode;
+	uint64_t requestSent;
+	// Completion callbacks of the packets the controller hasn't sent yet
+	std::deque<BluetoothResultCallback> inFlight;
+	Statistics statistics;
+};
+
+#endif
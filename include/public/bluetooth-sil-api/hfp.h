@@ -71,12 +71,10 @@ public:
 	 *
 	 *@param other Other AT command to copy from
 	 */
-	BluetoothHfpAtCommand(const BluetoothHfpAtCommand &other) :
-		type(other.getType()),
-		command(other.getCommand()),
-		arguments(other.getArguments())
-	{
-	}
+	BluetoothHfpAtCommand(const BluetoothHfpAtCommand &other) = default;
+	BluetoothHfpAtCommand(BluetoothHfpAtCommand &&other) = default;
+	BluetoothHfpAtCommand& operator =(const BluetoothHfpAtCommand &other) = default;
+	BluetoothHfpAtCommand& operator =(BluetoothHfpAtCommand &&other) = default;
 
 	/**
 	 * @brief Returns the type of AT command.
@@ -90,14 +88,16 @@ public:
 	 *
 	 * @return AT command without 'AT' string
 	 */
-	std::string getCommand() const { return command; }
+	const std::string& getCommand() const & { return command; }
+	std::string getCommand() && { return std::move(command); }
 
 	/**
 	 * @brief Returns the arguments of AT command.
 	 *
 	 * @return arguments of AT command
 	 */
-	std::string getArguments() const { return arguments; }
+	const std::string& getArguments() const & { return arguments; }
+	std::string getArguments() && { return std::move(arguments); }
 
 	/**
 	 * @brief Set the type of AT command.
@@ -112,6 +112,7 @@ public:
 	 * @param command AT command without 'AT' string
 	 */
 	void setCommand(const std::string &command) { this->command = command; }
+	void setCommand(std::string &&command) { this->command = std::move(command); }
 
 	/**
 	 * @brief Set the arguments of AT command.
@@ -119,6 +120,7 @@ public:
 	 * @param arguments Arguments of AT command
 	 */
 	void setArguments(const std::string &arguments) { this->arguments = arguments; }
+	void setArguments(std::string &&arguments) { this->arguments = std::move(arguments); }
 
 
 private:
@@ -0,0 +1,844 @@
+// Copyright (c) 2026 LG Electronics, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef BLUETOOTH_SIL_LEFILTER_H_
+#define BLUETOOTH_SIL_LEFILTER_H_
+
+#ifndef BLUETOOTH_SIL_H_
+	#error This header file should only be included by bluetooth-sil-api.h
+#endif
+
+#include <algorithm>
+#include <unordered_map>
+
+/**
+ * @brief Matches LE advertisements against a set of registered discovery filters.
+ *
+ *        SIL implementations register the filters passed to addLeDiscoveryFilter
+ *        and startLeDiscovery(scanId, uuids) and evaluate every received
+ *        advertisement once against all of them.
+ *
+ *        A filter matches when all of its criteria match:
+ *        - address: the device address is equal (case insensitive).
+ *        - name: the complete or shortened local name is equal.
+ *        - service UUID: one of the advertised service UUIDs is equal to the
+ *          filter UUID after applying the UUID mask (if any). Filters created from
+ *          a UUID list match if any UUID of the list is advertised.
+ *        - service data: the advertisement carries data for the service whose
+ *          first bytes are equal to the filter data after applying the byte mask.
+ *        - manufacturer data: same as service data for the manufacturer specific
+ *          data of the filter's company identifier (only if the id is > 0).
+ *        A filter without any criteria matches every advertisement. The
+ *        advertising type of BluetoothLeDiscoveryFilter isn't evaluated.
+ *
+ *        Filters are compiled into hash indexes for addresses, names, company
+ *        identifiers and service UUIDs plus flat arrays of masked byte patterns,
+ *        so only the filters which can possibly match are looked at for a single
+ *        advertisement. The result of every criterion is a bitset over all
+ *        filters which are combined with a few word operations.
+ *
+ *        The matcher isn't thread-safe.
+ */
+class BluetoothLeFilterMatcher
+{
+public:
+	BluetoothLeFilterMatcher() :
+		dirty(false),
+		words(0)
+	{
+	}
+
+	/**
+	 * @brief Register a LE discovery filter
+	 *
+	 *        A filter already registered with the same scan id is replaced.
+	 *
+	 * @param scanId Scan id the filter belongs to
+	 * @param filter Filter criteria
+	 * @return True if the filter was registered. False if it contains an invalid
+	 *         address or UUID.
+	 */
+	bool add(uint32_t scanId, const BluetoothLeDiscoveryFilter &filter)
+	{
+		Filter entry;
+		entry.scanId = scanId;
+
+		if (!filter.getAddress().empty())
+		{
+			if (!BluetoothAddress::parse(filter.getAddress(), entry.address))
+				return false;
+
+			entry.criteria |= CRITERION_ADDRESS;
+		}
+
+		if (!filter.getName().empty())
+		{
+			entry.name = filter.getName();
+			entry.criteria |= CRITERION_NAME;
+		}
+
+		const BluetoothLeServiceUuid &serviceUuid = filter.getServiceUuid();
+		if (!serviceUuid.getUuid().empty())
+		{
+			UuidPattern pattern;
+			if (!parseUuid(serviceUuid.getUuid(), pattern.uuid))
+				return false;
+
+			if (!serviceUuid.getMask().empty() && !parseUuid(serviceUuid.getMask(), pattern.mask))
+				return false;
+
+			entry.uuids.push_back(pattern);
+			entry.criteria |= CRITERION_SERVICE_UUID;
+		}
+
+		const BluetoothLeServiceData &serviceData = filter.getServiceData();
+		if (!serviceData.getUuid().empty())
+		{
+			if (!parseUuid(serviceData.getUuid(), entry.serviceDataUuid))
+				return false;
+
+			entry.serviceData = maskBytes(serviceData.getData(), serviceData.getMask(), entry.serviceDataMask);
+			entry.criteria |= CRITERION_SERVICE_DATA;
+		}
+
+		const BluetoothManufacturerData &manufacturerData = filter.getManufacturerData();
+		if (manufacturerData.getId() > 0)
+		{
+			entry.companyId = static_cast<uint16_t>(manufacturerData.getId());
+			entry.manufacturerData = maskBytes(manufacturerData.getData(), manufacturerData.getMask(), entry.manufacturerDataMask);
+			entry.criteria |= CRITERION_MANUFACTURER_DATA;
+		}
+
+		store(std::move(entry));
+		return true;
+	}
+
+	/**
+	 * @brief Register a service UUID filter as passed to startLeDiscovery
+	 *
+	 *        A filter already registered with the same scan id is replaced.
+	 *
+	 * @param scanId Scan id the filter belongs to
+	 * @param uuids Service UUIDs of which at least one must be advertised. If
+	 *        empty every advertisement matches.
+	 * @return True if the filter was registered. False if a UUID is invalid.
+	 */
+	bool add(uint32_t scanId, const BluetoothBleDiscoveryUuidFilterList &uuids)
+	{
+		Filter entry;
+		entry.scanId = scanId;
+
+		for (auto &uuid : uuids)
+		{
+			UuidPattern pattern;
+			if (!parseUuid(uuid, pattern.uuid))
+				return false;
+
+			entry.uuids.push_back(pattern);
+			entry.criteria |= CRITERION_SERVICE_UUID;
+		}
+
+		store(std::move(entry));
+		return true;
+	}
+
+	/**
+	 * @brief Remove the filter of a scan id
+	 * @param scanId Scan id the filter belongs to
+	 * @return True if a filter was removed. False otherwise.
+	 */
+	bool remove(uint32_t scanId)
+	{
+		for (auto iter = filters.begin(); iter != filters.end(); ++iter)
+		{
+			if (iter->scanId == scanId)
+			{
+				filters.erase(iter);
+				dirty = true;
+				return true;
+			}
+		}
+
+		return false;
+	}
+
+	/**
+	 * @brief Remove all filters
+	 */
+	void clear()
+	{
+		filters.clear();
+		dirty = true;
+	}
+
+	/**
+	 * @brief Retrieve the number of registered filters
+	 * @return Number of filters
+	 */
+	size_t size() const { return filters.size(); }
+
+	/**
+	 * @brief Retrieve the scan ids of all registered filters
+	 * @param scanIds Receives the scan ids in the order the filters were
+	 *        registered. Existing content is replaced.
+	 */
+	void getScanIds(std::vector<uint32_t> &scanIds) const
+	{
+		scanIds.clear();
+		for (auto &filter : filters)
+			scanIds.push_back(filter.scanId);
+	}
+
+	/**
+	 * @brief Evaluate an advertisement against all registered filters
+	 *
+	 * @param address Address of the advertising device
+	 * @param data Advertising data (and scan response) of the device
+	 * @param scanIds Receives the scan ids of all matching filters in the order
+	 *        the filters were registered. Existing content is replaced.
+	 */
+	void match(const std::string &address, const AdvertisingDataView &data, std::vector<uint32_t> &scanIds)
+	{
+		// An invalid address never equals the address of a filter
+		match(BluetoothAddress(address), data, scanIds);
+	}
+
+	/**
+	 * @brief Evaluate an advertisement against all registered filters
+	 *
+	 * @param address Address of the advertising device
+	 * @param data Advertising data (and scan response) of the device
+	 * @param scanIds Receives the scan ids of all matching filters
+	 */
+	void match(const BluetoothAddress &address, const AdvertisingDataView &data, std::vector<uint32_t> &scanIds)
+	{
+		match(address, data, std::string(), BluetoothUuidList(), scanIds);
+	}
+
+	/**
+	 * @brief Evaluate an advertisement and the name and service UUIDs of the
+	 *        device against all registered filters
+	 *
+	 *        For stacks which report the name and UUIDs as properties instead of
+	 *        or in addition to the advertisement.
+	 *
+	 * @param address Address of the advertising device
+	 * @param data Advertising data (and scan response) of the device
+	 * @param name Name of the device. Not matched if empty.
+	 * @param uuids Service UUIDs of the device
+	 * @param scanIds Receives the scan ids of all matching filters
+	 */
+	void match(const BluetoothAddress &address, const AdvertisingDataView &data, const std::string &name,
+	           const BluetoothUuidList &uuids, std::vector<uint32_t> &scanIds)
+	{
+		if (dirty)
+			compile();
+
+		scanIds.clear();
+		if (filters.empty())
+			return;
+
+		std::fill(satisfied.begin(), satisfied.end(), 0);
+
+		if (!addresses.empty())
+		{
+			auto range = addresses.equal_range(address);
+			for (auto iter = range.first; iter != range.second; ++iter)
+				setBit(CRITERION_INDEX_ADDRESS, iter->second);
+		}
+
+		for (auto &structure : data)
+		{
+			switch (structure.type)
+			{
+			case AdvertisingDataView::COMPLETE_LOCAL_NAME:
+			case AdvertisingDataView::SHORTENED_LOCAL_NAME:
+				matchName(structure.data);
+				break;
+			case AdvertisingDataView::SERVICE_DATA_UUID16:
+			case AdvertisingDataView::SERVICE_DATA_UUID32:
+			case AdvertisingDataView::SERVICE_DATA_UUID128:
+				matchServiceData(structure);
+				break;
+			case AdvertisingDataView::MANUFACTURER_SPECIFIC_DATA:
+				matchManufacturerData(structure);
+				break;
+			default:
+				if (AdvertisingDataView::getUuidListWidth(structure.type))
+					matchUuids(AdvertisingDataView::UuidList(structure.data, AdvertisingDataView::getUuidListWidth(structure.type), false));
+				break;
+			}
+		}
+
+		if (!name.empty())
+			matchName(BluetoothByteSpan(reinterpret_cast<const uint8_t*>(name.data()), name.size()));
+
+		for (auto &uuid : uuids)
+			matchUuid(uuid);
+
+		// A filter matches if every criterion it uses is satisfied
+		for (size_t word = 0; word < words; word++)
+		{
+			uint64_t result = ~0ULL;
+
+			for (int criterion = 0; criterion < CRITERION_COUNT; criterion++)
+				result &= ~uses[criterion * words + word] | satisfied[criterion * words + word];
+
+			result &= active[word];
+
+			while (result)
+			{
+				int bit = __builtin_ctzll(result);
+				scanIds.push_back(filters[word * 64 + bit].scanId);
+				result &= result - 1;
+			}
+		}
+	}
+
+private:
+	enum CriterionIndex
+	{
+		CRITERION_INDEX_ADDRESS,
+		CRITERION_INDEX_NAME,
+		CRITERION_INDEX_SERVICE_UUID,
+		CRITERION_INDEX_SERVICE_DATA,
+		CRITERION_INDEX_MANUFACTURER_DATA,
+		CRITERION_COUNT
+	};
+
+	enum Criterion
+	{
+		CRITERION_ADDRESS = 1 << CRITERION_INDEX_ADDRESS,
+		CRITERION_NAME = 1 << CRITERION_INDEX_NAME,
+		CRITERION_SERVICE_UUID = 1 << CRITERION_INDEX_SERVICE_UUID,
+		CRITERION_SERVICE_DATA = 1 << CRITERION_INDEX_SERVICE_DATA,
+		CRITERION_MANUFACTURER_DATA = 1 << CRITERION_INDEX_MANUFACTURER_DATA
+	};
+
+	struct UuidPattern
+	{
+		BluetoothUuid uuid;
+		// Invalid if the UUID has to match exactly
+		BluetoothUuid mask;
+	};
+
+	struct Filter
+	{
+		Filter() : scanId(0), criteria(0), companyId(0) { }
+
+		uint32_t scanId;
+		unsigned criteria;
+		BluetoothAddress address;
+		std::string name;
+		std::vector<UuidPattern> uuids;
+		BluetoothUuid serviceDataUuid;
+		std::vector<uint8_t> serviceData;
+		std::vector<uint8_t> serviceDataMask;
+		uint16_t companyId;
+		std::vector<uint8_t> manufacturerData;
+		std::vector<uint8_t> manufacturerDataMask;
+	};
+
+	// Masked bytes stored in the flat pattern arrays
+	struct BytePattern
+	{
+		uint32_t filter;
+		uint32_t offset;
+		uint32_t length;
+	};
+
+	struct MaskedUuid
+	{
+		uint32_t filter;
+		uint64_t msb;
+		uint64_t lsb;
+		uint64_t maskMsb;
+		uint64_t maskLsb;
+	};
+
+	void store(Filter &&entry)
+	{
+		for (auto &filter : filters)
+		{
+			if (filter.scanId == entry.scanId)
+			{
+				filter = std::move(entry);
+				dirty = true;
+				return;
+			}
+		}
+
+		filters.push_back(std::move(entry));
+		dirty = true;
+	}
+
+	void compile()
+	{
+		words = (filters.size() + 63) / 64;
+
+		uses.assign(words * CRITERION_COUNT, 0);
+		satisfied.assign(words * CRITERION_COUNT, 0);
+		active.assign(words, 0);
+		addresses.clear();
+		names.clear();
+		exactUuids.clear();
+		maskedUuids.clear();
+		serviceData.clear();
+		manufacturerData.clear();
+		patterns.clear();
+		masks.clear();
+
+		for (uint32_t n = 0; n < filters.size(); n++)
+		{
+			const Filter &filter = filters[n];
+
+			active[n / 64] |= 1ULL << (n % 64);
+			for (int criterion = 0; criterion < CRITERION_COUNT; criterion++)
+			{
+				if (filter.criteria & (1 << criterion))
+					uses[criterion * words + n / 64] |= 1ULL << (n % 64);
+			}
+
+			if (filter.criteria & CRITERION_ADDRESS)
+				addresses.insert(std::make_pair(filter.address, n));
+
+			if (filter.criteria & CRITERION_NAME)
+				names.insert(std::make_pair(hashBytes(BluetoothByteSpan(reinterpret_cast<const uint8_t*>(filter.name.data()), filter.name.size())), n));
+
+			for (auto &pattern : filter.uuids)
+			{
+				if (!pattern.mask.isValid())
+				{
+					exactUuids.insert(std::make_pair(pattern.uuid, n));
+					continue;
+				}
+
+				MaskedUuid masked;
+				masked.filter = n;
+				masked.maskMsb = pattern.mask.getMostSignificantBits();
+				masked.maskLsb = pattern.mask.getLeastSignificantBits();
+				masked.msb = pattern.uuid.getMostSignificantBits() & masked.maskMsb;
+				masked.lsb = pattern.uuid.getLeastSignificantBits() & masked.maskLsb;
+				maskedUuids.push_back(masked);
+			}
+
+			if (filter.criteria & CRITERION_SERVICE_DATA)
+				serviceData.insert(std::make_pair(filter.serviceDataUuid, addPattern(n, filter.serviceData, filter.serviceDataMask)));
+
+			if (filter.criteria & CRITERION_MANUFACTURER_DATA)
+				manufacturerData.insert(std::make_pair(filter.companyId, addPattern(n, filter.manufacturerData, filter.manufacturerDataMask)));
+		}
+
+		dirty = false;
+	}
+
+	BytePattern addPattern(uint32_t filter, const std::vector<uint8_t> &pattern, const std::vector<uint8_t> &mask)
+	{
+		BytePattern entry;
+		entry.filter = filter;
+		entry.offset = static_cast<uint32_t>(patterns.size());
+		entry.length = static_cast<uint32_t>(pattern.size());
+
+		patterns.insert(patterns.end(), pattern.begin(), pattern.end());
+		masks.insert(masks.end(), mask.begin(), mask.end());
+
+		return entry;
+	}
+
+	bool matchPattern(const BytePattern &pattern, BluetoothByteSpan data) const
+	{
+		if (data.size() < pattern.length)
+			return false;
+
+		// The arrays are empty if no filter has data to compare
+		const uint8_t *expected = patterns.data() + pattern.offset;
+		const uint8_t *mask = masks.data() + pattern.offset;
+
+		for (uint32_t n = 0; n < pattern.length; n++)
+		{
+			if ((data[n] & mask[n]) != expected[n])
+				return false;
+		}
+
+		return true;
+	}
+
+	void matchName(BluetoothByteSpan name)
+	{
+		if (names.empty())
+			return;
+
+		auto range = names.equal_range(hashBytes(name));
+		for (auto iter = range.first; iter != range.second; ++iter)
+		{
+			const std::string &expected = filters[iter->second].name;
+			if (expected.size() == name.size() && std::equal(name.begin(), name.end(), expected.begin()))
+				setBit(CRITERION_INDEX_NAME, iter->second);
+		}
+	}
+
+	void matchUuids(const AdvertisingDataView::UuidList &uuids)
+	{
+		for (size_t n = 0; n < uuids.size(); n++)
+			matchUuid(uuids[n]);
+	}
+
+	void matchUuid(const BluetoothUuid &uuid)
+	{
+		if (!exactUuids.empty())
+		{
+			auto range = exactUuids.equal_range(uuid);
+			for (auto iter = range.first; iter != range.second; ++iter)
+				setBit(CRITERION_INDEX_SERVICE_UUID, iter->second);
+		}
+
+		for (auto &masked : maskedUuids)
+		{
+			if ((uuid.getMostSignificantBits() & masked.maskMsb) == masked.msb &&
+			    (uuid.getLeastSignificantBits() & masked.maskLsb) == masked.lsb)
+				setBit(CRITERION_INDEX_SERVICE_UUID, masked.filter);
+		}
+	}
+
+	void matchServiceData(const AdvertisingDataView::Structure &structure)
+	{
+		AdvertisingDataView::ServiceData data;
+		if (serviceData.empty() || !AdvertisingDataView::parseServiceData(structure, data))
+			return;
+
+		auto range = serviceData.equal_range(data.uuid);
+		for (auto iter = range.first; iter != range.second; ++iter)
+		{
+			if (matchPattern(iter->second, data.data))
+				setBit(CRITERION_INDEX_SERVICE_DATA, iter->second.filter);
+		}
+	}
+
+	void matchManufacturerData(const AdvertisingDataView::Structure &structure)
+	{
+		AdvertisingDataView::ManufacturerData data;
+		if (manufacturerData.empty() || !AdvertisingDataView::parseManufacturerData(structure, data))
+			return;
+
+		auto range = manufacturerData.equal_range(data.companyId);
+		for (auto iter = range.first; iter != range.second; ++iter)
+		{
+			if (matchPattern(iter->second, data.data))
+				setBit(CRITERION_INDEX_MANUFACTURER_DATA, iter->second.filter);
+		}
+	}
+
+	void setBit(int criterion, uint32_t filter)
+	{
+		satisfied[criterion * words + filter / 64] |= 1ULL << (filter % 64);
+	}
+
+	static bool parseUuid(const std::string &text, BluetoothUuid &uuid)
+	{
+		uuid = BluetoothUuid(text);
+		return uuid.isValid();
+	}
+
+	// Pre-apply the mask to the data. Missing mask bytes compare exactly.
+	static std::vector<uint8_t> maskBytes(const std::vector<uint8_t> &data, const std::vector<uint8_t> &mask,
+	                                      std::vector<uint8_t> &fullMask)
+	{
+		std::vector<uint8_t> masked(data.size());
+		fullMask.assign(data.size(), 0xff);
+
+		for (size_t n = 0; n < data.size(); n++)
+		{
+			if (n < mask.size())
+				fullMask[n] = mask[n];
+
+			masked[n] = data[n] & fullMask[n];
+		}
+
+		return masked;
+	}
+
+	// FNV-1a
+	static uint64_t hashBytes(BluetoothByteSpan data)
+	{
+		uint64_t hash = 0xcbf29ce484222325ULL;
+
+		for (uint8_t byte : data)
+			hash = (hash ^ byte) * 0x100000001b3ULL;
+
+		return hash;
+	}
+
+private:
+	std::vector<Filter> filters;
+	bool dirty;
+
+	// Compiled match program
+	size_t words;
+	std::vector<uint64_t> uses;
+	std::vector<uint64_t> satisfied;
+	std::vector<uint64_t> active;
+	std::unordered_multimap<BluetoothAddress, uint32_t> addresses;
+	std::unordered_multimap<uint64_t, uint32_t> names;
+	std::unordered_multimap<BluetoothUuid, uint32_t> exactUuids;
+	std::vector<MaskedUuid> maskedUuids;
+	std::unordered_multimap<BluetoothUuid, BytePattern> serviceData;
+	std::unordered_multimap<uint16_t, BytePattern> manufacturerData;
+	std::vector<uint8_t> patterns;
+	std::vector<uint8_t> masks;
+};
+
+/**
+ * @brief Shared LE scan result pipeline for multiple concurrent scans.
+ *
+ *        SIL implementations supporting startLeDiscovery(scanId, uuids) and
+ *        addLeDiscoveryFilter register the filter of every scan here and pass
+ *        each device found or changed by the stack to deviceFound or
+ *        devicePropertiesChanged. The advertisement is matched once against all
+ *        filters and a single immutable BluetoothLeScanResult is delivered to
+ *        the observer for all matching scan ids, instead of matching and copying
+ *        the properties once per scan.
+ *
+ *        The advertisement is taken from the SCAN_RECORD property. The NAME and
+ *        UUIDS properties are matched as well, so stacks which report them
+ *        without a scan record are supported. The scan ids a device matched
+ *        are kept until it is removed, so property changes which don't touch
+ *        these properties (e.g. RSSI) and the removal reach exactly the scans
+ *        which found the device. Changes carrying SCAN_RECORD, NAME or UUIDS
+ *        are matched again against the latest values of the device.
+ *
+ *        The dispatcher isn't thread-safe.
+ */
+class BluetoothLeScanDispatcher
+{
+public:
+	/**
+	 * @brief Register the filter of a scan started with addLeDiscoveryFilter
+	 * @param scanId Unique ID of the scan
+	 * @param filter Filter criteria
+	 * @return True if the filter is valid and was registered
+	 */
+	bool addScan(uint32_t scanId, const BluetoothLeDiscoveryFilter &filter)
+	{
+		return filters.add(scanId, filter);
+	}
+
+	/**
+	 * @brief Register a scan started with startLeDiscovery(scanId, uuids)
+	 * @param scanId Unique ID of the scan
+	 * @param uuids Service UUIDs to filter for. If empty all devices match.
+	 * @return True if all UUIDs are valid and the scan was registered
+	 */
+	bool addScan(uint32_t scanId, const BluetoothBleDiscoveryUuidFilterList &uuids)
+	{
+		return filters.add(scanId, uuids);
+	}
+
+	/**
+	 * @brief Unregister a scan, for example from cancelLeDiscovery(scanId)
+	 * @param scanId Unique ID of the scan
+	 * @return True if the scan was registered
+	 */
+	bool removeScan(uint32_t scanId)
+	{
+		if (!filters.remove(scanId))
+			return false;
+
+		for (auto iter = devices.begin(); iter != devices.end(); )
+		{
+			std::vector<uint32_t> &ids = iter->second.scanIds;
+			ids.erase(std::remove(ids.begin(), ids.end(), scanId), ids.end());
+
+			if (ids.empty())
+				iter = devices.erase(iter);
+			else
+				++iter;
+		}
+
+		return true;
+	}
+
+	/**
+	 * @brief Unregister all scans
+	 */
+	void clear()
+	{
+		filters.clear();
+		devices.clear();
+	}
+
+	/**
+	 * @brief Retrieve the number of registered scans
+	 * @return Number of scans
+	 */
+	size_t size() const { return filters.size(); }
+
+	/**
+	 * @brief Deliver a newly found LE device to all scans it matches
+	 *
+	 * @param observer Observer to notify through leDeviceFoundByScanIds
+	 * @param address Address of the device
+	 * @param properties Properties reported by the stack
+	 * @return Result delivered to the observer or null if no scan matched
+	 */
+	BluetoothLeScanResultPtr deviceFound(BluetoothAdapterStatusObserver *observer, const std::string &address,
+	                                     BluetoothPropertiesList properties)
+	{
+		BluetoothLeScanResultPtr result = createResult(address, std::move(properties), true);
+		if (result)
+			observer->leDeviceFoundByScanIds(scanIds, result);
+
+		return result;
+	}
+
+	/**
+	 * @brief Deliver changed properties of a LE device to all scans it matches
+	 *
+	 *        Changes without SCAN_RECORD, NAME or UUIDS go to the scans the
+	 *        device matched before.
+	 *
+	 * @param observer Observer to notify through leDevicePropertiesChangedByScanIds
+	 * @param address Address of the device
+	 * @param properties Properties reported by the stack
+	 * @return Result delivered to the observer or null if no scan matched
+	 */
+	BluetoothLeScanResultPtr devicePropertiesChanged(BluetoothAdapterStatusObserver *observer, const std::string &address,
+	                                                 BluetoothPropertiesList properties)
+	{
+		BluetoothLeScanResultPtr result = createResult(address, std::move(properties), false);
+		if (result)
+			observer->leDevicePropertiesChangedByScanIds(scanIds, result);
+
+		return result;
+	}
+
+	/**
+	 * @brief Notify the scans which found a LE device that it disappeared
+	 *
+	 * @param observer Observer to notify through leDeviceRemovedByScanId
+	 * @param address Address of the device
+	 */
+	void deviceRemoved(BluetoothAdapterStatusObserver *observer, const std::string &address)
+	{
+		auto iter = devices.find(BluetoothAddress(address));
+		if (iter == devices.end())
+			return;
+
+		// The observer may add or remove scans
+		std::vector<uint32_t> ids;
+		ids.swap(iter->second.scanIds);
+		devices.erase(iter);
+
+		for (uint32_t scanId : ids)
+			observer->leDeviceRemovedByScanId(scanId, address);
+	}
+
+	/**
+	 * @brief Retrieve the scan ids matched by the last found or changed device
+	 * @return Scan ids in registration order
+	 */
+	const std::vector<uint32_t>& getMatchedScanIds() const { return scanIds; }
+
+private:
+	struct Device
+	{
+		// Scans the device matched, in registration order
+		std::vector<uint32_t> scanIds;
+		// Latest advertisement, name and UUIDs, to match again after one of them changed
+		std::vector<uint8_t> scanRecord;
+		std::string name;
+		BluetoothUuidList uuids;
+	};
+
+	BluetoothLeScanResultPtr createResult(const std::string &address, BluetoothPropertiesList &&properties, bool found)
+	{
+		const std::vector<uint8_t> *scanRecord = nullptr;
+		const std::string *name = nullptr;
+		const std::vector<std::string> *uuids = nullptr;
+		bool rematch = found;
+
+		for (auto &property : properties)
+		{
+			switch (property.getType())
+			{
+			case BluetoothProperty::Type::SCAN_RECORD:
+				scanRecord = &property.getValue<std::vector<uint8_t>>();
+				rematch = true;
+				break;
+			case BluetoothProperty::Type::NAME:
+				name = &property.getValue<std::string>();
+				rematch = true;
+				break;
+			case BluetoothProperty::Type::UUIDS:
+				uuids = &property.getValue<std::vector<std::string>>();
+				rematch = true;
+				break;
+			default:
+				break;
+			}
+		}
+
+		// Devices without a valid address can't be told apart and aren't cached
+		BluetoothAddress key(address);
+		Device uncached;
+
+		auto iter = devices.find(key);
+		if (iter == devices.end())
+		{
+			rematch = true;
+		}
+		else if (!rematch)
+		{
+			scanIds = iter->second.scanIds;
+			return std::make_shared<BluetoothLeScanResult>(address, std::move(properties));
+		}
+
+		Device &device = !key.isValid() ? uncached : iter == devices.end() ? devices[key] : iter->second;
+		if (scanRecord)
+			device.scanRecord.assign(scanRecord->begin(), scanRecord->end());
+		if (name)
+			device.name = *name;
+		if (uuids)
+		{
+			device.uuids.clear();
+			for (auto &text : *uuids)
+			{
+				BluetoothUuid uuid(text);
+				if (uuid.isValid())
+					device.uuids.push_back(uuid);
+			}
+		}
+
+		filters.match(key, AdvertisingDataView(BluetoothByteSpan(device.scanRecord)), device.name, device.uuids,
+		              device.scanIds);
+		scanIds = device.scanIds;
+
+		if (scanIds.empty())
+		{
+			devices.erase(key);
+			return BluetoothLeScanResultPtr();
+		}
+
+		return std::make_shared<BluetoothLeScanResult>(address, std::move(properties));
+	}
+
+	BluetoothLeFilterMatcher filters;
+	// Devices which matched at least one scan
+	std::unordered_map<BluetoothAddress, Device> devices;
+	// Reused for every advertisement to keep its storage around
+	std::vector<uint32_t> scanIds;
+};
+
+#endif
@@ -259,12 +259,10 @@ public:
 	 * @brief Copy constructor
 	 * @param other Other property to create a copy from
 	 */
-	BluetoothMapProperty(const BluetoothMapProperty &other) :
-		type(other.type),
-		impl(other.impl),
-		typeName(other.typeName)
-	{
-	}
+	BluetoothMapProperty(const BluetoothMapProperty &other) = default;
+	BluetoothMapProperty(BluetoothMapProperty &&other) = default;
+	BluetoothMapProperty& operator =(const BluetoothMapProperty &other) = default;
+	BluetoothMapProperty& operator =(BluetoothMapProperty &&other) = default;
 
 	/**
 	 * @brief Initialize the property with a type and a value
@@ -274,7 +272,7 @@ public:
 	template<class T>
 	BluetoothMapProperty(Type type, T value) :
 		type(type),
-		impl(new PropertyImpl<T>(value)),
+		impl(new PropertyImpl<T>(std::move(value))),
 		typeName(typeid(T).name()) { }
 
 	/**
@@ -310,7 +308,7 @@ public:
 	template<class T>
 	void setValue(T value)
 	{
-		impl.reset(new PropertyImpl<T>(value));
+		impl.reset(new PropertyImpl<T>(std::move(value)));
 		typeName = typeid(T).name();
 	}
 
@@ -323,7 +321,7 @@ private:
 	template<class T>
 	struct PropertyImpl : public BasePropertyImpl
 	{
-		PropertyImpl(T value) : value(value) { }
+		PropertyImpl(T value) : value(std::move(value)) { }
 		~PropertyImpl() { }
 
 		T getValue() const
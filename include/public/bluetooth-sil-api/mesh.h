@@ -71,11 +71,13 @@ class BleMeshProvisioner
 {
 public:
 	/* Accesssor and modifier functions for private variables */
-	std::string getName() const { return name; }
+	const std::string& getName() const & { return name; }
+	std::string getName() && { return std::move(name); }
 	uint16_t getUnicastAddress() const { return unicastAddress; }
 	uint16_t getLowAddress() const { return lowAddress; }
 	uint16_t getHighAddress() const { return highAddress; }
 	void setName(const std::string &name) { this->name = name; }
+	void setName(std::string &&name) { this->name = std::move(name); }
 	void setUnicastAddress(uint16_t unicastAddress) { this->unicastAddress = unicastAddress; }
 	void setLowAddress(uint16_t lowAddress) { this->lowAddress = lowAddress; }
 	void setHighAddress(uint16_t highAddress) { this->highAddress = highAddress; }
@@ -103,17 +105,25 @@ class BleMeshInfo
 public:
 	BleMeshInfo() : ivIndex(0) { }
 	/* Accesssor and modifier functions for private variables */
-	std::string getMeshName() const { return meshName; }
+	const std::string& getMeshName() const & { return meshName; }
+	std::string getMeshName() && { return std::move(meshName); }
 	uint32_t getIvIndex() const { return ivIndex; }
-	std::vector<BleMeshNetKeys> getNetKeys() const { return netKeys; }
-	std::vector<BleMeshAppKeys> getAppKeys() const { return appKeys; }
-	std::vector<BleMeshProvisioner> getProvisioners() const { return provisioners; }
+	const std::vector<BleMeshNetKeys>& getNetKeys() const & { return netKeys; }
+	std::vector<BleMeshNetKeys> getNetKeys() && { return std::move(netKeys); }
+	const std::vector<BleMeshAppKeys>& getAppKeys() const & { return appKeys; }
+	std::vector<BleMeshAppKeys> getAppKeys() && { return std::move(appKeys); }
+	const std::vector<BleMeshProvisioner>& getProvisioners() const & { return provisioners; }
+	std::vector<BleMeshProvisioner> getProvisioners() && { return std::move(provisioners); }
 
 	void setMeshName(const std::string &meshName) { this->meshName = meshName; }
+	void setMeshName(std::string &&meshName) { this->meshName = std::move(meshName); }
 	void setIvIndex(uint32_t ivIndex) { this->ivIndex = ivIndex; }
-	void setNetKeys(std::vector<BleMeshNetKeys> &netKeys) { this->netKeys = netKeys; }
-	void setAppKeys(std::vector<BleMeshAppKeys> &appKeys) { this->appKeys = appKeys; }
-	void setProvisioners(std::vector<BleMeshProvisioner> &appKeys) { this->provisioners = provisioners; }
+	void setNetKeys(const std::vector<BleMeshNetKeys> &netKeys) { this->netKeys = netKeys; }
+	void setNetKeys(std::vector<BleMeshNetKeys> &&netKeys) { this->netKeys = std::move(netKeys); }
+	void setAppKeys(const std::vector<BleMeshAppKeys> &appKeys) { this->appKeys = appKeys; }
+	void setAppKeys(std::vector<BleMeshAppKeys> &&appKeys) { this->appKeys = std::move(appKeys); }
+	void setProvisioners(const std::vector<BleMeshProvisioner> &provisioners) { this->provisioners = provisioners; }
+	void setProvisioners(std::vector<BleMeshProvisioner> &&provisioners) { this->provisioners = std::move(provisioners); }
 private:
 	/** @brief Mesh network name */
 	std::string meshName;
@@ -239,15 +249,19 @@ public:
 	/* Accesssor and modifier functions for private variables */
 	uint16_t getLoc() const { return loc; }
 	uint16_t getNumS() const { return numS; }
-	std::vector<uint32_t> getSigModelIds() const { return sigModelIds; }
+	const std::vector<uint32_t>& getSigModelIds() const & { return sigModelIds; }
+	std::vector<uint32_t> getSigModelIds() && { return std::move(sigModelIds); }
 	uint16_t getNumV() const { return numV; }
-	std::vector<uint32_t> getVendorModelIds() const { return vendorModelIds; }
+	const std::vector<uint32_t>& getVendorModelIds() const & { return vendorModelIds; }
+	std::vector<uint32_t> getVendorModelIds() && { return std::move(vendorModelIds); }
 
 	void setLoc(uint16_t loc) { this->loc = loc; }
 	void setNumS(uint8_t numS) { this->numS = numS; }
-	void setSigModelIds(std::vector<uint32_t> &sigModelIds) { this->sigModelIds = sigModelIds; }
+	void setSigModelIds(const std::vector<uint32_t> &sigModelIds) { this->sigModelIds = sigModelIds; }
+	void setSigModelIds(std::vector<uint32_t> &&sigModelIds) { this->sigModelIds = std::move(sigModelIds); }
 	void setNumV(uint8_t numV) { this->numV = numV; }
-	void setVendorModelIds(std::vector<uint32_t> &vendorModelIds) { this->vendorModelIds = vendorModelIds; }
+	void setVendorModelIds(const std::vector<uint32_t> &vendorModelIds) { this->vendorModelIds = vendorModelIds; }
+	void setVendorModelIds(std::vector<uint32_t> &&vendorModelIds) { this->vendorModelIds = std::move(vendorModelIds); }
 
 private:
 	/** @brief Location descriptor */
@@ -292,14 +306,16 @@ public:
 	uint16_t getVersionId() const { return versionId; }
 	uint16_t getNumRplEnteries() const { return numRplEnteries; }
 	BleMeshFeature getFeatures() const { return features; }
-	std::vector<BleMeshElement> getElements() const { return elements; }
+	const std::vector<BleMeshElement>& getElements() const & { return elements; }
+	std::vector<BleMeshElement> getElements() && { return std::move(elements); }
 
 	void setCompanyId(uint16_t cid) { this->companyId = cid; }
 	void setProductId(uint16_t pid) { this->productId = pid; }
 	void setVersionId(uint16_t vid) { this->versionId = vid; }
 	void setNumRplEnteries(uint16_t crpl) { this->numRplEnteries = crpl; }
 	void setFeatures(BleMeshFeature &features) { this->features = features; }
-	void setElements(std::vector<BleMeshElement> &elements) { this->elements = elements; }
+	void setElements(const std::vector<BleMeshElement> &elements) { this->elements = elements; }
+	void setElements(std::vector<BleMeshElement> &&elements) { this->elements = std::move(elements); }
 
 private:
 	/** @brief Company identifier assigned by the Bluetooth SIG */
@@ -333,18 +349,22 @@ public:
 	netKeyIndex(netKeyIndex),
 	appKeyIndexes(appKeyIndexes) {}
 	/* Accessor and modifier functions for private variables */
-	std::string getUuid() const { return uuid; }
+	const std::string& getUuid() const & { return uuid; }
+	std::string getUuid() && { return std::move(uuid); }
 	uint16_t getPrimaryElementAddress() const { return primaryElementAddress; }
 	uint16_t getNumberOfElements() const { return numberOfElements; }
 	uint16_t getNetKeyIndex() const { return netKeyIndex; }
-	std::vector<uint16_t> getAppKeyIndexes() const { return appKeyIndexes; }
+	const std::vector<uint16_t>& getAppKeyIndexes() const & { return appKeyIndexes; }
+	std::vector<uint16_t> getAppKeyIndexes() && { return std::move(appKeyIndexes); }
 
-	void setUuid(const std::string uuid) { this->uuid = uuid; }
+	void setUuid(const std::string &uuid) { this->uuid = uuid; }
+	void setUuid(std::string &&uuid) { this->uuid = std::move(uuid); }
 	void setPrimaryElementAddress(const uint16_t primaryElementAddress)
 								{ this->primaryElementAddress = primaryElementAddress; }
 	void setNumberOfElements(const uint16_t numberOfElements) { this->numberOfElements = numberOfElements; }
 	void setNetKeyIndex(const uint16_t netKeyIndex) { this->netKeyIndex = netKeyIndex; }
 	void setAppKeyIndexes(const std::vector<uint16_t> &appKeyIndexes) { this->appKeyIndexes = appKeyIndexes; }
+	void setAppKeyIndexes(std::vector<uint16_t> &&appKeyIndexes) { this->appKeyIndexes = std::move(appKeyIndexes); }
 private:
 	/** @brief uuid of the node */
 	std::string uuid;
@@ -366,23 +386,29 @@ class BleMeshConfiguration
 public:
 
 	/* Accesssor and modifier functions for private variables */
-	std::string getConfig() const { return config; }
-	std::vector<uint16_t> getAppKeyIndexes() const { return appKeyIndexes; }
+	const std::string& getConfig() const & { return config; }
+	std::string getConfig() && { return std::move(config); }
+	const std::vector<uint16_t>& getAppKeyIndexes() const & { return appKeyIndexes; }
+	std::vector<uint16_t> getAppKeyIndexes() && { return std::move(appKeyIndexes); }
 	uint8_t getGattProxyState() const { return gattProxyState; }
 	uint8_t getTTL() const { return ttl; }
 	BleMeshRelayStatus getRelayStatus() const { return relayStatus; }
-	BleMeshCompositionData getCompositionData() const { return compositionData; }
+	const BleMeshCompositionData& getCompositionData() const & { return compositionData; }
+	BleMeshCompositionData getCompositionData() && { return std::move(compositionData); }
 	bool getOnOffState() const { return onOffState; }
 	uint16_t getNodeAddress() const { return nodeAddress; }
 	uint16_t getNetKeyIndex() const { return netKeyIndex; }
 	uint16_t getAppKeyIndex() const { return appKeyIndex; }
 
-	void setConfig(const std::string config) { this->config = config; }
-	void setAppKeyIndexes(std::vector<uint16_t> &appKeyIndexes) { this->appKeyIndexes = appKeyIndexes; }
+	void setConfig(const std::string &config) { this->config = config; }
+	void setConfig(std::string &&config) { this->config = std::move(config); }
+	void setAppKeyIndexes(const std::vector<uint16_t> &appKeyIndexes) { this->appKeyIndexes = appKeyIndexes; }
+	void setAppKeyIndexes(std::vector<uint16_t> &&appKeyIndexes) { this->appKeyIndexes = std::move(appKeyIndexes); }
 	void setGattProxyState(uint8_t gattProxyState) { this->gattProxyState = gattProxyState; }
 	void setRelayStatus(BleMeshRelayStatus relayStatus) { this->relayStatus = relayStatus; }
 	void setTTL(uint8_t ttl) { this->ttl = ttl; }
-	void setCompositionData(BleMeshCompositionData compositionData) { this->compositionData = compositionData; }
+	void setCompositionData(const BleMeshCompositionData &compositionData) { this->compositionData = compositionData; }
+	void setCompositionData(BleMeshCompositionData &&compositionData) { this->compositionData = std::move(compositionData); }
 	void setOnOffState(bool onOffState) { this->onOffState = onOffState; }
 	void setNodeAddress(uint16_t nodeAddress) { this->nodeAddress = nodeAddress; }
 	void setNetKeyIndex(uint16_t netKeyIndex) { this->netKeyIndex = netKeyIndex; }
@@ -473,9 +499,11 @@ class BleMeshPayload
 {
 public:
 	/* Accesssor and modifier functions for private variables */
-	BleMeshPayloadPassthrough getPayloadPassthrough() const { return payloadPassthrough; }
+	const BleMeshPayloadPassthrough& getPayloadPassthrough() const & { return payloadPassthrough; }
+	BleMeshPayloadPassthrough getPayloadPassthrough() && { return std::move(payloadPassthrough); }
 	BleMeshPayloadOnOff getPayloadOnOff() const { return payloadOnOff; }
-	void setPayloadPassthrough(BleMeshPayloadPassthrough &payloadPassthrough) { this->payloadPassthrough = payloadPassthrough; }
+	void setPayloadPassthrough(const BleMeshPayloadPassthrough &payloadPassthrough) { this->payloadPassthrough = payloadPassthrough; }
+	void setPayloadPassthrough(BleMeshPayloadPassthrough &&payloadPassthrough) { this->payloadPassthrough = std::move(payloadPassthrough); }
 	void setPayloadOnOff(BleMeshPayloadOnOff &payloadOnOff) { this->payloadOnOff = payloadOnOff; }
 private:
 	/** @brief Payload for "passthrough" command */
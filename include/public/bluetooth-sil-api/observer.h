@@ -26,6 +26,39 @@
  */
 typedef std::vector<int32_t> BluetoothLinkKey;
 
+/**
+ * @brief Single discovery event delivered as part of a batch through
+ *        BluetoothAdapterStatusObserver::devicesUpdated.
+ */
+struct BluetoothDeviceUpdate
+{
+	enum Type
+	{
+		/// Corresponds to deviceFound
+		DEVICE_FOUND,
+		/// Corresponds to devicePropertiesChanged
+		DEVICE_PROPERTIES_CHANGED,
+		/// Corresponds to leDeviceFound
+		LE_DEVICE_FOUND,
+		/// Corresponds to leDevicePropertiesChanged
+		LE_DEVICE_PROPERTIES_CHANGED
+	};
+
+	BluetoothDeviceUpdate(Type type, const std::string &address, BluetoothPropertiesList properties) :
+		type(type),
+		address(address),
+		properties(std::move(properties))
+	{
+	}
+
+	Type type;
+	/// Address of the device. Empty for a deviceFound without address.
+	std::string address;
+	BluetoothPropertiesList properties;
+};
+
+typedef std::vector<BluetoothDeviceUpdate> BluetoothDeviceUpdateList;
+
 class BluetoothAdapter;
 /**
  * @brief This interface is the base to implement an observer for the Bluetooth
@@ -174,6 +207,111 @@ public:
 	virtual void leDevicePropertiesChangedByScanId(uint32_t scanId, const std::string &address,
 	                                     BluetoothPropertiesList properties) { }
 
+	/**
+	 * @brief The method is called once when a new LE device is discovered for
+	 *        all scans whose filter matched the advertisement.
+	 *
+	 *        The result is shared by all scans and must not be modified. The
+	 *        default implementation calls leDeviceFoundByScanId for every
+	 *        scan id with a copy of the properties.
+	 *
+	 * @param scanIds Unique IDs of the LE scans which matched
+	 * @param result Address and properties of the new device
+	 */
+	virtual void leDeviceFoundByScanIds(const std::vector<uint32_t> &scanIds,
+	                                    const BluetoothLeScanResultPtr &result)
+	{
+		for (uint32_t scanId : scanIds)
+			leDeviceFoundByScanId(scanId, result->getProperties());
+	}
+
+	/**
+	 * @brief The method is called once when one or more properties have changed
+	 *        for a LE device for all scans whose filter matched.
+	 *
+	 *        The default implementation calls leDevicePropertiesChangedByScanId
+	 *        for every scan id with a copy of the properties.
+	 *
+	 * @param scanIds Unique IDs of the LE scans which matched
+	 * @param result Address and changed properties of the device
+	 */
+	virtual void leDevicePropertiesChangedByScanIds(const std::vector<uint32_t> &scanIds,
+	                                                const BluetoothLeScanResultPtr &result)
+	{
+		for (uint32_t scanId : scanIds)
+			leDevicePropertiesChangedByScanId(scanId, result->getAddress(), result->getProperties());
+	}
+
+	/**
+	 * @brief The method is called with the delta of a device property update
+	 *        computed by BluetoothAdapter::notifyDevicePropertiesChanged.
+	 *
+	 *        Only properties whose value has changed are part of the delta. The
+	 *        default implementation forwards the changed properties to
+	 *        devicePropertiesChanged.
+	 *
+	 * @param address Address of the device whose properties have changed.
+	 * @param delta Changed properties with their new values.
+	 */
+	virtual void devicePropertiesDelta(const std::string &address,
+	                                   const BluetoothPropertiesDelta &delta)
+	{
+		devicePropertiesChanged(address, delta.toList());
+	}
+
+	/**
+	 * @brief The method is called with the delta of a LE device property update
+	 *        computed by BluetoothAdapter::notifyLeDevicePropertiesChanged.
+	 *
+	 *        The default implementation forwards the changed properties to
+	 *        leDevicePropertiesChanged.
+	 *
+	 * @param address Address of the device whose properties have changed.
+	 * @param delta Changed properties with their new values.
+	 */
+	virtual void leDevicePropertiesDelta(const std::string &address,
+	                                     const BluetoothPropertiesDelta &delta)
+	{
+		leDevicePropertiesChanged(address, delta.toList());
+	}
+
+	/**
+	 * @brief The method is called with a batch of discovery events collected by
+	 *        a BluetoothDeviceUpdateBatcher.
+	 *
+	 *        Observers which handle the whole batch at once (e.g. with a single
+	 *        message to their clients) override this method. The default
+	 *        implementation calls deviceFound, devicePropertiesChanged,
+	 *        leDeviceFound and leDevicePropertiesChanged for every update in
+	 *        the order they were queued.
+	 *
+	 * @param updates Events of the batch
+	 */
+	virtual void devicesUpdated(const BluetoothDeviceUpdateList &updates)
+	{
+		for (auto &update : updates)
+		{
+			switch (update.type)
+			{
+			case BluetoothDeviceUpdate::DEVICE_FOUND:
+				if (update.address.empty())
+					deviceFound(update.properties);
+				else
+					deviceFound(update.address, update.properties);
+				break;
+			case BluetoothDeviceUpdate::DEVICE_PROPERTIES_CHANGED:
+				devicePropertiesChanged(update.address, update.properties);
+				break;
+			case BluetoothDeviceUpdate::LE_DEVICE_FOUND:
+				leDeviceFound(update.address, update.properties);
+				break;
+			case BluetoothDeviceUpdate::LE_DEVICE_PROPERTIES_CHANGED:
+				leDevicePropertiesChanged(update.address, update.properties);
+				break;
+			}
+		}
+	}
+
 	/**
 	 * @brief The method is called when the status of the device discovery process changes.
 	 *        This will happen when either startDiscovery or cancelDiscovery of the adapter
@@ -97,17 +97,28 @@ public:
 	{
 	}
 
-	std::string getFolder() const { return folder; }
-	std::string getPrimaryCounter() const { return primaryCounter; }
-	std::string getSecondaryCounter() const { return secondaryCounter; }
-	std::string getDataBaseIdentifier() const { return databaseIdentifier; }
+	const std::string& getFolder() const & { return folder; }
+
+	std::string getFolder() && { return std::move(folder); }
+	const std::string& getPrimaryCounter() const & { return primaryCounter; }
+	std::string getPrimaryCounter() && { return std::move(primaryCounter); }
+	const std::string& getSecondaryCounter() const & { return secondaryCounter; }
+	std::string getSecondaryCounter() && { return std::move(secondaryCounter); }
+	const std::string& getDataBaseIdentifier() const & { return databaseIdentifier; }
+	std::string getDataBaseIdentifier() && { return std::move(databaseIdentifier); }
 	bool getFixedImageSize() { return fixedImageSize; }
 
 
 	void setFolder(const std::string &folder) { this->folder = folder; }
+
+
+	void setFolder(std::string &&folder) { this->folder = std::move(folder); }
 	void setPrimaryCounter(const std::string &primaryCounter) { this->primaryCounter = primaryCounter; }
+	void setPrimaryCounter(std::string &&primaryCounter) { this->primaryCounter = std::move(primaryCounter); }
 	void setSecondaryCounter(const std::string &secondaryCounter) { this->secondaryCounter = secondaryCounter; }
+	void setSecondaryCounter(std::string &&secondaryCounter) { this->secondaryCounter = std::move(secondaryCounter); }
 	void setDataBaseIdentifier(const std::string &databaseIdentifier) { this->databaseIdentifier = databaseIdentifier; }
+	void setDataBaseIdentifier(std::string &&databaseIdentifier) { this->databaseIdentifier = std::move(databaseIdentifier); }
 	void setFixedImageSize(bool fixedImageSize) { this->fixedImageSize = fixedImageSize; }
 
 private:
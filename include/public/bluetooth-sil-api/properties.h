@@ -21,6 +21,12 @@
 	#error This header file should only be included by bluetooth-sil-api.h
 #endif
 
+#include <cstring>
+#include <cstddef>
+#include <new>
+#include <type_traits>
+#include <utility>
+
 /**
  * @brief The BluetoothProperty class abstracts access to several properties
  *        of the Bluetooth adapter or found remote devices.
@@ -259,7 +265,7 @@ public:
 	 */
 	BluetoothProperty() :
 		type(EMPTY),
-		impl(0)
+		tag(VALUE_NONE)
 	{
 	}
 
@@ -269,7 +275,7 @@ public:
 	 */
 	BluetoothProperty(Type type) :
 		type(type),
-		impl(0)
+		tag(VALUE_NONE)
 	{
 	}
 
@@ -279,9 +285,20 @@ public:
 	 */
 	BluetoothProperty(const BluetoothProperty &other) :
 		type(other.type),
-		impl(other.impl),
-		typeName(other.typeName)
+		tag(VALUE_NONE)
+	{
+		copyValue(other);
+	}
+
+	/**
+	 * @brief Move constructor
+	 * @param other Other property to take the value from. Its value is left empty.
+	 */
+	BluetoothProperty(BluetoothProperty &&other) :
+		type(other.type),
+		tag(VALUE_NONE)
 	{
+		moveValue(other);
 	}
 
 	/**
@@ -292,8 +309,146 @@ public:
 	template<class T>
 	BluetoothProperty(Type type, T value) :
 		type(type),
-		impl(new PropertyImpl<T>(value)),
-		typeName(typeid(T).name()) { }
+		tag(VALUE_NONE)
+	{
+		setValue<T>(std::move(value));
+	}
+
+	/**
+	 * @brief D'tor
+	 */
+	~BluetoothProperty()
+	{
+		destroyValue();
+	}
+
+	/**
+	 * @brief Assignment operator
+	 * @param other Other property to copy from
+	 * @return Reference to this property
+	 */
+	BluetoothProperty& operator =(const BluetoothProperty &other)
+	{
+		if (this != &other)
+		{
+			destroyValue();
+			type = other.type;
+			copyValue(other);
+		}
+
+		return *this;
+	}
+
+	/**
+	 * @brief Move assignment operator
+	 * @param other Other property to take the value from
+	 * @return Reference to this property
+	 */
+	BluetoothProperty& operator =(BluetoothProperty &&other)
+	{
+		if (this != &other)
+		{
+			destroyValue();
+			type = other.type;
+			moveValue(other);
+		}
+
+		return *this;
+	}
+
+	/**
+	 * @brief Compare type and value with another property
+	 *
+	 *        Values of the documented property value types are compared by
+	 *        content. Any other value type is only considered equal if both
+	 *        properties share the same value instance.
+	 *
+	 * @param other Other property to compare with
+	 * @return True if both properties are equal. False otherwise.
+	 */
+	bool operator ==(const BluetoothProperty &other) const
+	{
+		if (type != other.type || tag != other.tag)
+			return false;
+
+		switch (tag)
+		{
+		case VALUE_STRING:
+			return getValue<std::string>() == other.getValue<std::string>();
+		case VALUE_UINT32:
+			return getValue<std::uint32_t>() == other.getValue<std::uint32_t>();
+		case VALUE_INT:
+			return getValue<int>() == other.getValue<int>();
+		case VALUE_BOOL:
+			return getValue<bool>() == other.getValue<bool>();
+		case VALUE_BYTES:
+			return getValue<std::vector<std::uint8_t>>() == other.getValue<std::vector<std::uint8_t>>();
+		case VALUE_STRINGS:
+			return getValue<std::vector<std::string>>() == other.getValue<std::vector<std::string>>();
+		case VALUE_OTHER:
+			return reinterpret_cast<const OtherValue*>(&storage)->impl ==
+			       reinterpret_cast<const OtherValue*>(&other.storage)->impl;
+		case VALUE_NONE:
+			break;
+		}
+
+		return true;
+	}
+
+	bool operator !=(const BluetoothProperty &other) const
+	{
+		return !(*this == other);
+	}
+
+	/**
+	 * @brief Compute a hash of type and value
+	 *
+	 *        Properties which compare equal have the same hash.
+	 *
+	 * @return Hash of the property
+	 */
+	uint64_t hash() const
+	{
+		uint64_t value = hashBytes(0xcbf29ce484222325ULL, &type, sizeof(type));
+
+		switch (tag)
+		{
+		case VALUE_STRING:
+		{
+			const std::string &text = getValue<std::string>();
+			return hashBytes(value, text.data(), text.size());
+		}
+		case VALUE_UINT32:
+			return hashBytes(value, &storage, sizeof(std::uint32_t));
+		case VALUE_INT:
+			return hashBytes(value, &storage, sizeof(int));
+		case VALUE_BOOL:
+			return hashBytes(value, &storage, sizeof(bool));
+		case VALUE_BYTES:
+		{
+			const std::vector<std::uint8_t> &bytes = getValue<std::vector<std::uint8_t>>();
+			return hashBytes(value, bytes.data(), bytes.size());
+		}
+		case VALUE_STRINGS:
+			for (auto &text : getValue<std::vector<std::string>>())
+			{
+				// Include the length so the split between the strings matters
+				size_t length = text.size();
+				value = hashBytes(value, &length, sizeof(length));
+				value = hashBytes(value, text.data(), text.size());
+			}
+			return value;
+		case VALUE_OTHER:
+		{
+			const BasePropertyImpl *impl = reinterpret_cast<const OtherValue*>(&storage)->impl.get();
+			return hashBytes(value, &impl, sizeof(impl));
+		}
+		case VALUE_NONE:
+			break;
+		}
+
+		return value;
+	}
 
 	/**
 	 * @brief Get the type of the property
@@ -306,19 +461,35 @@ public:
 
 	/**
 	 * @brief Get the value of the property
-	 * @return Value of the property
+	 *
+	 *        Values of the types documented for the property types (std::string,
+	 *        std::uint32_t, int, bool, std::vector<std::uint8_t> and
+	 *        std::vector<std::string>) are stored inline and only need a tag check
+	 *        to be read.
+	 *
+	 * @return Reference to the value of the property which stays valid as long as
+	 *         the property isn't modified or destroyed.
 	 */
 	template<class T>
-	T getValue() const
+	const T& getValue() const
 	{
-		std::string requestedType = typeid(T).name();
+		const ValueTag requested = tagFor(static_cast<const T*>(nullptr));
 
-		if (requestedType != typeName)
+		if (requested != tag)
 		{
 			throw std::logic_error("Non-matching types");
 		}
 
-		return dynamic_cast<PropertyImpl<T>*>(impl.get())->getValue();
+		if (requested != VALUE_OTHER)
+			return *reinterpret_cast<const T*>(&storage);
+
+		const OtherValue *other = reinterpret_cast<const OtherValue*>(&storage);
+		if (strcmp(other->typeName, typeid(T).name()) != 0)
+		{
+			throw std::logic_error("Non-matching types");
+		}
+
+		return static_cast<PropertyImpl<T>*>(other->impl.get())->value;
 	}
 
 	/**
@@ -328,11 +499,48 @@ public:
 	template<class T>
 	void setValue(T value)
 	{
-		impl.reset(new PropertyImpl<T>(value));
-		typeName = typeid(T).name();
+		destroyValue();
+		constructValue(value, std::integral_constant<bool, tagFor(static_cast<const T*>(nullptr)) != VALUE_OTHER>());
 	}
 
 private:
+	/*
+	 * Tag of the value currently stored. Everything which isn't one of the
+	 * documented property value types is kept on the heap as VALUE_OTHER.
+	 */
+	enum ValueTag
+	{
+		VALUE_NONE,
+		VALUE_STRING,
+		VALUE_UINT32,
+		VALUE_INT,
+		VALUE_BOOL,
+		VALUE_BYTES,
+		VALUE_STRINGS,
+		VALUE_OTHER
+	};
+
+	static constexpr ValueTag tagFor(const std::string*) { return VALUE_STRING; }
+	static constexpr ValueTag tagFor(const std::uint32_t*) { return VALUE_UINT32; }
+	static constexpr ValueTag tagFor(const int*) { return VALUE_INT; }
+	static constexpr ValueTag tagFor(const bool*) { return VALUE_BOOL; }
+	static constexpr ValueTag tagFor(const std::vector<std::uint8_t>*) { return VALUE_BYTES; }
+	static constexpr ValueTag tagFor(const std::vector<std::string>*) { return VALUE_STRINGS; }
+
+	template<class T>
+	static constexpr ValueTag tagFor(const T*) { return VALUE_OTHER; }
+
+	// FNV-1a
+	static uint64_t hashBytes(uint64_t hash, const void *data, size_t size)
+	{
+		const uint8_t *bytes = static_cast<const uint8_t*>(data);
+
+		for (size_t n = 0; n < size; n++)
+			hash = (hash ^ bytes[n]) * 0x100000001b3ULL;
+
+		return hash;
+	}
+
 	struct BasePropertyImpl
 	{
 		virtual ~BasePropertyImpl() { }
@@ -341,25 +549,340 @@ private:
 	template<class T>
 	struct PropertyImpl : public BasePropertyImpl
 	{
-		PropertyImpl(T value) : value(value) { }
+		PropertyImpl(T &&value) : value(std::move(value)) { }
 		~PropertyImpl() { }
 
-		T getValue() const
+		T value;
+	};
+
+	struct OtherValue
+	{
+		OtherValue(std::shared_ptr<BasePropertyImpl> impl, const char *typeName) :
+			impl(std::move(impl)),
+			typeName(typeName)
 		{
-			return value;
 		}
 
-		T value;
+		std::shared_ptr<BasePropertyImpl> impl;
+		const char *typeName;
 	};
 
+	template<class T>
+	void constructValue(T &value, std::true_type)
+	{
+		new (&storage) T(std::move(value));
+		tag = tagFor(static_cast<const T*>(nullptr));
+	}
+
+	template<class T>
+	void constructValue(T &value, std::false_type)
+	{
+		new (&storage) OtherValue(std::make_shared<PropertyImpl<T>>(std::move(value)), typeid(T).name());
+		tag = VALUE_OTHER;
+	}
+
+	void copyValue(const BluetoothProperty &other)
+	{
+		switch (other.tag)
+		{
+		case VALUE_STRING:
+			new (&storage) std::string(other.getValue<std::string>());
+			break;
+		case VALUE_UINT32:
+			new (&storage) std::uint32_t(other.getValue<std::uint32_t>());
+			break;
+		case VALUE_INT:
+			new (&storage) int(other.getValue<int>());
+			break;
+		case VALUE_BOOL:
+			new (&storage) bool(other.getValue<bool>());
+			break;
+		case VALUE_BYTES:
+			new (&storage) std::vector<std::uint8_t>(other.getValue<std::vector<std::uint8_t>>());
+			break;
+		case VALUE_STRINGS:
+			new (&storage) std::vector<std::string>(other.getValue<std::vector<std::string>>());
+			break;
+		case VALUE_OTHER:
+			new (&storage) OtherValue(*reinterpret_cast<const OtherValue*>(&other.storage));
+			break;
+		case VALUE_NONE:
+			break;
+		}
+
+		tag = other.tag;
+	}
+
+	void moveValue(BluetoothProperty &other)
+	{
+		switch (other.tag)
+		{
+		case VALUE_STRING:
+			new (&storage) std::string(std::move(*reinterpret_cast<std::string*>(&other.storage)));
+			break;
+		case VALUE_BYTES:
+			new (&storage) std::vector<std::uint8_t>(std::move(*reinterpret_cast<std::vector<std::uint8_t>*>(&other.storage)));
+			break;
+		case VALUE_STRINGS:
+			new (&storage) std::vector<std::string>(std::move(*reinterpret_cast<std::vector<std::string>*>(&other.storage)));
+			break;
+		case VALUE_OTHER:
+			new (&storage) OtherValue(std::move(*reinterpret_cast<OtherValue*>(&other.storage)));
+			break;
+		default:
+			// Trivial values are simply copied
+			copyValue(other);
+			return;
+		}
+
+		// The other property keeps its now empty value until it's destroyed
+		tag = other.tag;
+	}
+
+	void destroyValue()
+	{
+		switch (tag)
+		{
+		case VALUE_STRING:
+			reinterpret_cast<std::string*>(&storage)->~basic_string();
+			break;
+		case VALUE_BYTES:
+			reinterpret_cast<std::vector<std::uint8_t>*>(&storage)->~vector();
+			break;
+		case VALUE_STRINGS:
+			reinterpret_cast<std::vector<std::string>*>(&storage)->~vector();
+			break;
+		case VALUE_OTHER:
+			reinterpret_cast<OtherValue*>(&storage)->~OtherValue();
+			break;
+		default:
+			break;
+		}
+
+		tag = VALUE_NONE;
+	}
+
+	static const size_t STORAGE_SIZE =
+		sizeof(std::string) > sizeof(std::vector<std::string>) ?
+		(sizeof(std::string) > sizeof(OtherValue) ? sizeof(std::string) : sizeof(OtherValue)) :
+		(sizeof(std::vector<std::string>) > sizeof(OtherValue) ? sizeof(std::vector<std::string>) : sizeof(OtherValue));
+
 private:
 	Type type;
-	std::shared_ptr<BasePropertyImpl> impl;
-	std::string typeName;
+	ValueTag tag;
+	std::aligned_storage<STORAGE_SIZE>::type storage;
 };
 
 typedef std::vector<BluetoothProperty> BluetoothPropertiesList;
 
+/**
+ * @brief Container of properties indexed by their type.
+ *
+ *        Every property type is stored at most once. A presence bitmask and a
+ *        slot table allow to check for and find a property in constant time,
+ *        while the properties themselves are kept densely in a
+ *        BluetoothPropertiesList. The container can be iterated like and converted
+ *        from or to a BluetoothPropertiesList so existing code can migrate
+ *        gradually.
+ */
+class BluetoothPropertyBag
+{
+public:
+	typedef BluetoothPropertiesList::const_iterator const_iterator;
+
+	/**
+	 * @brief Default c'tor
+	 */
+	BluetoothPropertyBag() :
+		mask(0)
+	{
+	}
+
+	/**
+	 * @brief Create the container from a list of properties
+	 *
+	 *        If a type occurs more than once the last property wins. Properties of
+	 *        type EMPTY are skipped.
+	 *
+	 * @param properties List of properties
+	 */
+	BluetoothPropertyBag(const BluetoothPropertiesList &properties) :
+		mask(0)
+	{
+		this->properties.reserve(properties.size());
+
+		for (auto &property : properties)
+			set(property);
+	}
+
+	/**
+	 * @brief Create the container from a list of properties
+	 *
+	 *        Same as above but takes the values over from the list.
+	 *
+	 * @param properties List of properties
+	 */
+	BluetoothPropertyBag(BluetoothPropertiesList &&properties) :
+		mask(0)
+	{
+		this->properties.reserve(properties.size());
+
+		for (auto &property : properties)
+			set(std::move(property));
+	}
+
+	/**
+	 * @brief Check if a property of the specified type is available
+	 * @param type Type of the property
+	 * @return True if the property is available. False otherwise.
+	 */
+	bool has(BluetoothProperty::Type type) const
+	{
+		return (mask & bitFor(type)) != 0;
+	}
+
+	/**
+	 * @brief Find the property of the specified type
+	 * @param type Type of the property
+	 * @return Pointer to the property or nullptr if not available. The pointer
+	 *         stays valid until the container is modified.
+	 */
+	const BluetoothProperty* find(BluetoothProperty::Type type) const
+	{
+		if (!has(type))
+			return nullptr;
+
+		return &properties[slots[type]];
+	}
+
+	/**
+	 * @brief Retrieve the value of the property of the specified type
+	 * @param type Type of the property
+	 * @param defaultValue Value to return when the property isn't available. A
+	 *        temporary passed here must outlive the use of the returned reference.
+	 * @return Value of the property or defaultValue. Throws std::logic_error
+	 *         if the property holds a value of a different type.
+	 */
+	template<class T>
+	const T& getValue(BluetoothProperty::Type type, const T &defaultValue) const
+	{
+		const BluetoothProperty *property = find(type);
+		if (!property)
+			return defaultValue;
+
+		return property->getValue<T>();
+	}
+
+	/**
+	 * @brief Add a property or replace an existing one of the same type
+	 * @param property Property to store
+	 */
+	void set(const BluetoothProperty &property)
+	{
+		BluetoothProperty copy(property);
+		set(std::move(copy));
+	}
+
+	/**
+	 * @brief Add a property or replace an existing one of the same type
+	 * @param property Property to take over
+	 */
+	void set(BluetoothProperty &&property)
+	{
+		BluetoothProperty::Type type = property.getType();
+		if (type == BluetoothProperty::Type::EMPTY)
+			return;
+
+		if (has(type))
+		{
+			properties[slots[type]] = std::move(property);
+			return;
+		}
+
+		slots[type] = static_cast<uint8_t>(properties.size());
+		properties.push_back(std::move(property));
+		mask |= bitFor(type);
+	}
+
+	/**
+	 * @brief Remove the property of the specified type
+	 * @param type Type of the property
+	 * @return True if the property was removed. False if it wasn't available.
+	 */
+	bool erase(BluetoothProperty::Type type)
+	{
+		if (!has(type))
+			return false;
+
+		uint8_t slot = slots[type];
+		if (slot != properties.size() - 1)
+		{
+			// Keep the storage dense by moving the last property into the gap
+			properties[slot] = std::move(properties.back());
+			slots[properties[slot].getType()] = slot;
+		}
+
+		properties.pop_back();
+		mask &= ~bitFor(type);
+
+		return true;
+	}
+
+	/**
+	 * @brief Remove all properties
+	 */
+	void clear()
+	{
+		properties.clear();
+		mask = 0;
+	}
+
+	/**
+	 * @brief Retrieve the bitmask of available property types
+	 * @return Bitmask with bit (1 << type) set for every available type
+	 */
+	uint64_t getMask() const { return mask; }
+
+	/**
+	 * @brief Retrieve the number of properties
+	 * @return Number of properties
+	 */
+	size_t size() const { return properties.size(); }
+
+	/**
+	 * @brief Check if the container is empty
+	 * @return True if no property is stored. False otherwise.
+	 */
+	bool empty() const { return properties.empty(); }
+
+	const_iterator begin() const { return properties.begin(); }
+	const_iterator end() const { return properties.end(); }
+
+	/**
+	 * @brief Access the stored properties as list
+	 * @return List of all properties in insertion order
+	 */
+	const BluetoothPropertiesList& toList() const { return properties; }
+
+	operator const BluetoothPropertiesList&() const { return properties; }
+
+private:
+	static uint64_t bitFor(BluetoothProperty::Type type)
+	{
+		return 1ULL << type;
+	}
+
+	static const size_t MAX_TYPES = 64;
+
+	static_assert(BluetoothProperty::Type::MAP_SUPPORTED_MESSAGE_TYPE < MAX_TYPES,
+	              "BluetoothPropertyBag supports up to 64 property types");
+
+private:
+	BluetoothPropertiesList properties;
+	uint64_t mask;
+	uint8_t slots[MAX_TYPES];
+};
+
 /**
  * @brief Callback to return a list of properties asynchronously.
  */
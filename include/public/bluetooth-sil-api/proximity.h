@@ -0,0 +1,314 @@
+// Copyright (c) 2026 LG Electronics, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef BLUETOOTH_SIL_PROXIMITY_H_
+#define BLUETOOTH_SIL_PROXIMITY_H_
+
+#ifndef BLUETOOTH_SIL_H_
+	#error This header file should only be included by bluetooth-sil-api.h
+#endif
+
+#include <cmath>
+#include <unordered_map>
+
+/**
+ * @brief Smoothing filter for the RSSI samples of a single device.
+ *
+ *        The last WINDOW_SIZE raw samples are kept in a ring buffer. Their
+ *        median is fed into a one dimensional Kalman filter, so single spikes
+ *        caused by reflections are dropped and the remaining noise is
+ *        smoothed without the lag of a long moving average.
+ */
+class BluetoothRssiFilter
+{
+public:
+	static const size_t WINDOW_SIZE = 8;
+
+	/**
+	 * @brief Create a filter
+	 * @param processNoise Expected variance of the real RSSI between two
+	 *        samples. Higher values follow changes faster.
+	 * @param measurementNoise Expected variance of the measured samples.
+	 *        Higher values smooth stronger.
+	 */
+	BluetoothRssiFilter(double processNoise = 0.5, double measurementNoise = 4.0) :
+		processNoise(processNoise),
+		measurementNoise(measurementNoise),
+		estimate(0),
+		covariance(0),
+		count(0),
+		next(0)
+	{
+	}
+
+	/**
+	 * @brief Add a raw sample
+	 * @param rssi Measured RSSI in dBm
+	 * @return Smoothed RSSI in dBm after the sample
+	 */
+	double addSample(int rssi)
+	{
+		samples[next] = rssi;
+		next = (next + 1) % WINDOW_SIZE;
+		if (count < WINDOW_SIZE)
+			count++;
+
+		double measurement = median();
+
+		if (count == 1)
+		{
+			estimate = measurement;
+			covariance = measurementNoise;
+			return estimate;
+		}
+
+		covariance += processNoise;
+		double gain = covariance / (covariance + measurementNoise);
+		estimate += gain * (measurement - estimate);
+		covariance *= 1 - gain;
+
+		return estimate;
+	}
+
+	/**
+	 * @brief Retrieve the smoothed RSSI
+	 * @return Smoothed RSSI in dBm. Only meaningful if hasSamples() is true.
+	 */
+	double getRssi() const { return estimate; }
+
+	/**
+	 * @brief Check if any sample was added since the creation or last reset
+	 * @return True if a sample was added
+	 */
+	bool hasSamples() const { return count > 0; }
+
+	/**
+	 * @brief Drop all samples
+	 */
+	void reset()
+	{
+		count = 0;
+		next = 0;
+	}
+
+private:
+	double median() const
+	{
+		// Insertion sort, the window is tiny
+		int sorted[WINDOW_SIZE];
+		for (size_t n = 0; n < count; n++)
+		{
+			size_t position = n;
+			for (; position > 0 && sorted[position - 1] > samples[n]; position--)
+				sorted[position] = sorted[position - 1];
+
+			sorted[position] = samples[n];
+		}
+
+		if (count % 2)
+			return sorted[count / 2];
+
+		return (sorted[count / 2 - 1] + sorted[count / 2]) / 2.0;
+	}
+
+	double processNoise;
+	double measurementNoise;
+	double estimate;
+	double covariance;
+	int samples[WINDOW_SIZE];
+	size_t count;
+	size_t next;
+};
+
+/**
+ * @brief Per device RSSI smoothing and distance estimation for the
+ *        discovery pipeline.
+ *
+ *        SIL implementations pass every device property update through apply
+ *        before it's delivered to the observer. The RSSI property is then
+ *        replaced by the smoothed value, so all subscribers see the same
+ *        filtered value instead of each of them filtering the raw samples.
+ *
+ *        The distance is estimated with the log-distance path loss model from
+ *        the smoothed RSSI and the last TXPOWER reported by the device:
+ *
+ *            distance = 10 ^ ((txPower - pathLossAt1m - rssi) / (10 * n))
+ *
+ *        where n is the path loss exponent (2 in free space, 2.5 to 4 indoors).
+ *
+ *        The tracker isn't thread-safe.
+ */
+class BluetoothProximityTracker
+{
+public:
+	/**
+	 * @brief Create a tracker
+	 * @param pathLossExponent Path loss exponent of the environment
+	 * @param pathLossAt1m Path loss in dB at a distance of 1 m
+	 */
+	BluetoothProximityTracker(double pathLossExponent = 2.0, double pathLossAt1m = 41.0) :
+		pathLossExponent(pathLossExponent),
+		pathLossAt1m(pathLossAt1m)
+	{
+	}
+
+	/**
+	 * @brief Update the state of a device from reported properties
+	 *
+	 *        The RSSI property is replaced by the smoothed RSSI rounded to the
+	 *        next integer.
+	 *
+	 * @param address Address of the device
+	 * @param properties Reported properties which are updated in place
+	 * @return True if the RSSI was smoothed. False if the properties don't
+	 *         contain a RSSI or the address is invalid.
+	 */
+	bool apply(const BluetoothAddress &address, BluetoothPropertiesList &properties)
+	{
+		BluetoothProperty *rssi = nullptr;
+		const BluetoothProperty *txPower = nullptr;
+
+		for (auto &property : properties)
+		{
+			if (property.getType() == BluetoothProperty::Type::RSSI)
+				rssi = &property;
+			else if (property.getType() == BluetoothProperty::Type::TXPOWER)
+				txPower = &property;
+		}
+
+		if ((!rssi && !txPower) || !address.isValid())
+			return false;
+
+		DeviceState &state = devices[address];
+
+		if (txPower)
+		{
+			state.txPower = txPower->getValue<int>();
+			state.hasTxPower = true;
+		}
+
+		if (!rssi)
+			return false;
+
+		double smoothed = state.filter.addSample(rssi->getValue<int>());
+		rssi->setValue<int>(static_cast<int>(std::lround(smoothed)));
+
+		return true;
+	}
+
+	bool apply(const std::string &address, BluetoothPropertiesList &properties)
+	{
+		return apply(BluetoothAddress(address), properties);
+	}
+
+	/**
+	 * @brief Retrieve the smoothed RSSI of a device
+	 * @param address Address of the device
+	 * @param rssi Receives the smoothed RSSI in dBm
+	 * @return True if a RSSI is known for the device
+	 */
+	bool getRssi(const BluetoothAddress &address, double &rssi) const
+	{
+		auto iter = devices.find(address);
+		if (iter == devices.end() || !iter->second.filter.hasSamples())
+			return false;
+
+		rssi = iter->second.filter.getRssi();
+		return true;
+	}
+
+	bool getRssi(const std::string &address, double &rssi) const
+	{
+		return getRssi(BluetoothAddress(address), rssi);
+	}
+
+	/**
+	 * @brief Retrieve the estimated distance of a device
+	 * @param address Address of the device
+	 * @param distance Receives the distance in meters
+	 * @return True if both RSSI and TX power are known for the device
+	 */
+	bool getDistance(const BluetoothAddress &address, double &distance) const
+	{
+		auto iter = devices.find(address);
+		if (iter == devices.end() || !iter->second.filter.hasSamples() || !iter->second.hasTxPower)
+			return false;
+
+		distance = estimateDistance(iter->second.filter.getRssi(), iter->second.txPower);
+		return true;
+	}
+
+	bool getDistance(const std::string &address, double &distance) const
+	{
+		return getDistance(BluetoothAddress(address), distance);
+	}
+
+	/**
+	 * @brief Estimate the distance for a RSSI and TX power
+	 * @param rssi RSSI in dBm
+	 * @param txPower TX power in dBm
+	 * @return Distance in meters
+	 */
+	double estimateDistance(double rssi, int txPower) const
+	{
+		return std::pow(10.0, (txPower - pathLossAt1m - rssi) / (10.0 * pathLossExponent));
+	}
+
+	/**
+	 * @brief Forget the state of a device, e.g. when it has disappeared
+	 * @param address Address of the device
+	 * @return True if the device was known
+	 */
+	bool remove(const BluetoothAddress &address)
+	{
+		return devices.erase(address) > 0;
+	}
+
+	bool remove(const std::string &address)
+	{
+		return remove(BluetoothAddress(address));
+	}
+
+	/**
+	 * @brief Forget the state of all devices
+	 */
+	void clear()
+	{
+		devices.clear();
+	}
+
+	/**
+	 * @brief Retrieve the number of devices with state
+	 * @return Number of devices
+	 */
+	size_t size() const { return devices.size(); }
+
+private:
+	struct DeviceState
+	{
+		DeviceState() : txPower(0), hasTxPower(false) { }
+
+		BluetoothRssiFilter filter;
+		int txPower;
+		bool hasTxPower;
+	};
+
+	double pathLossExponent;
+	double pathLossAt1m;
+	std::unordered_map<BluetoothAddress, DeviceState> devices;
+};
+
+#endif
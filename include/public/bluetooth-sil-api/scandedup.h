@@ -0,0 +1,202 @@
+// Copyright (c) 2026 LG Electronics, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef BLUETOOTH_SIL_SCANDEDUP_H_
+#define BLUETOOTH_SIL_SCANDEDUP_H_
+
+#ifndef BLUETOOTH_SIL_H_
+	#error This header file should only be included by bluetooth-sil-api.h
+#endif
+
+#include <cstdlib>
+#include <unordered_map>
+
+/**
+ * @brief Optional stage which drops redundant LE scan reports before they
+ *        reach the observer.
+ *
+ *        In dense environments most advertising reports of a device only
+ *        repeat the previous one with a slightly different RSSI. For every
+ *        device the stage keeps a hash of the last reported properties
+ *        (without RSSI), the last reported RSSI and the time of the last
+ *        report. A report is passed on if the device is new, or if the
+ *        minimum report interval has elapsed and either the properties have
+ *        changed or the RSSI moved by at least the RSSI threshold.
+ *
+ *        Suppressed reports don't update the state, so a change which arrives
+ *        within the minimum interval is reported with the next advertisement
+ *        after it.
+ *
+ *        SIL implementations call shouldReport for every advertising report
+ *        and forget devices with remove when they disappear. The stage isn't
+ *        thread-safe.
+ */
+class BluetoothLeScanDeduplicator
+{
+public:
+	/**
+	 * @brief Create the stage
+	 * @param minReportInterval Minimum time between two reports of the same
+	 *        device in milliseconds
+	 * @param rssiThreshold Minimum RSSI change in dBm which is reported if
+	 *        nothing else changed
+	 */
+	BluetoothLeScanDeduplicator(uint32_t minReportInterval = 1000, int rssiThreshold = 5) :
+		minReportInterval(minReportInterval),
+		rssiThreshold(rssiThreshold),
+		reported(0),
+		suppressed(0)
+	{
+	}
+
+	void setMinReportInterval(uint32_t interval) { minReportInterval = interval; }
+	uint32_t getMinReportInterval() const { return minReportInterval; }
+
+	void setRssiThreshold(int threshold) { rssiThreshold = threshold; }
+	int getRssiThreshold() const { return rssiThreshold; }
+
+	/**
+	 * @brief Decide whether an advertising report is passed on
+	 *
+	 * @param address Address of the device
+	 * @param properties Properties of the report
+	 * @param now Current time of a monotonic clock in milliseconds
+	 * @return True if the report has to be delivered. False if it's redundant.
+	 *         Reports of invalid addresses are always delivered.
+	 */
+	bool shouldReport(const BluetoothAddress &address, const BluetoothPropertiesList &properties, uint64_t now)
+	{
+		if (!address.isValid())
+		{
+			reported++;
+			return true;
+		}
+
+		uint64_t hash = 0;
+		bool hasRssi = false;
+		int rssi = 0;
+
+		// Summing up the hashes makes the result independent of the property order
+		for (auto &property : properties)
+		{
+			if (property.getType() == BluetoothProperty::Type::RSSI)
+			{
+				rssi = property.getValue<int>();
+				hasRssi = true;
+			}
+			else
+			{
+				hash += property.hash();
+			}
+		}
+
+		auto iter = devices.find(address);
+		if (iter == devices.end())
+		{
+			iter = devices.insert(std::make_pair(address, DeviceState())).first;
+		}
+		else
+		{
+			const DeviceState &state = iter->second;
+			bool rssiChanged = hasRssi && (!state.hasRssi || std::abs(rssi - state.rssi) >= rssiThreshold);
+
+			if (now - state.lastReport < minReportInterval || (hash == state.hash && !rssiChanged))
+			{
+				suppressed++;
+				return false;
+			}
+		}
+
+		DeviceState &state = iter->second;
+		state.hash = hash;
+		state.lastReport = now;
+		if (hasRssi)
+		{
+			state.rssi = rssi;
+			state.hasRssi = true;
+		}
+
+		reported++;
+		return true;
+	}
+
+	bool shouldReport(const std::string &address, const BluetoothPropertiesList &properties, uint64_t now)
+	{
+		return shouldReport(BluetoothAddress(address), properties, now);
+	}
+
+	/**
+	 * @brief Forget the state of a device, e.g. when it has disappeared
+	 * @param address Address of the device
+	 * @return True if the device was known
+	 */
+	bool remove(const BluetoothAddress &address)
+	{
+		return devices.erase(address) > 0;
+	}
+
+	bool remove(const std::string &address)
+	{
+		return remove(BluetoothAddress(address));
+	}
+
+	/**
+	 * @brief Forget the state of all devices and reset the counters
+	 */
+	void clear()
+	{
+		devices.clear();
+		reported = 0;
+		suppressed = 0;
+	}
+
+	/**
+	 * @brief Retrieve the number of devices with state
+	 * @return Number of devices
+	 */
+	size_t size() const { return devices.size(); }
+
+	/**
+	 * @brief Retrieve the number of reports passed on since the last clear
+	 * @return Number of reports
+	 */
+	uint64_t getReportedCount() const { return reported; }
+
+	/**
+	 * @brief Retrieve the number of reports dropped since the last clear
+	 * @return Number of reports
+	 */
+	uint64_t getSuppressedCount() const { return suppressed; }
+
+private:
+	struct DeviceState
+	{
+		DeviceState() : hash(0), lastReport(0), rssi(0), hasRssi(false) { }
+
+		uint64_t hash;
+		uint64_t lastReport;
+		int rssi;
+		bool hasRssi;
+	};
+
+	uint32_t minReportInterval;
+	int rssiThreshold;
+	uint64_t reported;
+	uint64_t suppressed;
+	std::unordered_map<BluetoothAddress, DeviceState> devices;
+};
+
+#endif
@@ -0,0 +1,63 @@
+// Copyright (c) 2026 LG Electronics, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef BLUETOOTH_SIL_SCANRESULT_H_
+#define BLUETOOTH_SIL_SCANRESULT_H_
+
+#ifndef BLUETOOTH_SIL_H_
+	#error This header file should only be included by bluetooth-sil-api.h
+#endif
+
+/**
+ * @brief Immutable result of a LE scan shared by all scans it matched.
+ *
+ *        A result is created once per received advertisement and handed out as
+ *        a BluetoothLeScanResultPtr to every scan id whose filter matched, so
+ *        the properties aren't copied per scan. Receivers which need to keep
+ *        the result around just hold on to the pointer.
+ */
+class BluetoothLeScanResult
+{
+public:
+	BluetoothLeScanResult(const std::string &address, BluetoothPropertiesList properties) :
+		address(address),
+		properties(std::move(properties))
+	{
+	}
+
+	BluetoothLeScanResult(const BluetoothLeScanResult &) = delete;
+	BluetoothLeScanResult& operator =(const BluetoothLeScanResult &) = delete;
+
+	/**
+	 * @brief Retrieve the address of the device
+	 * @return Device address
+	 */
+	const std::string& getAddress() const { return address; }
+
+	/**
+	 * @brief Retrieve the properties of the device reported with the advertisement
+	 * @return Device properties
+	 */
+	const BluetoothPropertiesList& getProperties() const { return properties; }
+
+private:
+	const std::string address;
+	const BluetoothPropertiesList properties;
+};
+
+typedef std::shared_ptr<const BluetoothLeScanResult> BluetoothLeScanResultPtr;
+
+#endif
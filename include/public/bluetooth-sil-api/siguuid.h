@@ -0,0 +1,265 @@
+// Copyright (c) 2026 LG Electronics, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef BLUETOOTH_SIL_SIGUUID_H_
+#define BLUETOOTH_SIL_SIGUUID_H_
+
+#ifndef BLUETOOTH_SIL_H_
+	#error This header file should only be included by bluetooth-sil-api.h
+#endif
+
+#include <stdint.h>
+#include <cstddef>
+
+/**
+ * @brief 16 bit UUIDs assigned by the Bluetooth SIG for GATT services,
+ *        descriptors and characteristics.
+ *
+ *        The values can be used directly as case labels when dispatching on
+ *        BluetoothUuid::toShortUuid() and converted into a BluetoothUuid at compile
+ *        time with BluetoothUuid::fromUInt16().
+ *
+ *        See https://www.bluetooth.com/specifications/assigned-numbers/
+ */
+enum BluetoothSigUuid : uint16_t
+{
+	/* GATT services */
+	BLUETOOTH_UUID_GENERIC_ACCESS_SERVICE = 0x1800,
+	BLUETOOTH_UUID_GENERIC_ATTRIBUTE_SERVICE = 0x1801,
+	BLUETOOTH_UUID_IMMEDIATE_ALERT_SERVICE = 0x1802,
+	BLUETOOTH_UUID_LINK_LOSS_SERVICE = 0x1803,
+	BLUETOOTH_UUID_TX_POWER_SERVICE = 0x1804,
+	BLUETOOTH_UUID_CURRENT_TIME_SERVICE = 0x1805,
+	BLUETOOTH_UUID_REFERENCE_TIME_UPDATE_SERVICE = 0x1806,
+	BLUETOOTH_UUID_NEXT_DST_CHANGE_SERVICE = 0x1807,
+	BLUETOOTH_UUID_GLUCOSE_SERVICE = 0x1808,
+	BLUETOOTH_UUID_HEALTH_THERMOMETER_SERVICE = 0x1809,
+	BLUETOOTH_UUID_DEVICE_INFORMATION_SERVICE = 0x180a,
+	BLUETOOTH_UUID_HEART_RATE_SERVICE = 0x180d,
+	BLUETOOTH_UUID_PHONE_ALERT_STATUS_SERVICE = 0x180e,
+	BLUETOOTH_UUID_BATTERY_SERVICE = 0x180f,
+	BLUETOOTH_UUID_BLOOD_PRESSURE_SERVICE = 0x1810,
+	BLUETOOTH_UUID_ALERT_NOTIFICATION_SERVICE = 0x1811,
+	BLUETOOTH_UUID_HUMAN_INTERFACE_DEVICE_SERVICE = 0x1812,
+	BLUETOOTH_UUID_SCAN_PARAMETERS_SERVICE = 0x1813,
+	BLUETOOTH_UUID_RUNNING_SPEED_AND_CADENCE_SERVICE = 0x1814,
+	BLUETOOTH_UUID_AUTOMATION_IO_SERVICE = 0x1815,
+	BLUETOOTH_UUID_CYCLING_SPEED_AND_CADENCE_SERVICE = 0x1816,
+	BLUETOOTH_UUID_CYCLING_POWER_SERVICE = 0x1818,
+	BLUETOOTH_UUID_LOCATION_AND_NAVIGATION_SERVICE = 0x1819,
+	BLUETOOTH_UUID_ENVIRONMENTAL_SENSING_SERVICE = 0x181a,
+	BLUETOOTH_UUID_BODY_COMPOSITION_SERVICE = 0x181b,
+	BLUETOOTH_UUID_USER_DATA_SERVICE = 0x181c,
+	BLUETOOTH_UUID_WEIGHT_SCALE_SERVICE = 0x181d,
+	BLUETOOTH_UUID_BOND_MANAGEMENT_SERVICE = 0x181e,
+	BLUETOOTH_UUID_CONTINUOUS_GLUCOSE_MONITORING_SERVICE = 0x181f,
+	BLUETOOTH_UUID_INTERNET_PROTOCOL_SUPPORT_SERVICE = 0x1820,
+	BLUETOOTH_UUID_INDOOR_POSITIONING_SERVICE = 0x1821,
+	BLUETOOTH_UUID_PULSE_OXIMETER_SERVICE = 0x1822,
+	BLUETOOTH_UUID_HTTP_PROXY_SERVICE = 0x1823,
+	BLUETOOTH_UUID_TRANSPORT_DISCOVERY_SERVICE = 0x1824,
+	BLUETOOTH_UUID_OBJECT_TRANSFER_SERVICE = 0x1825,
+	BLUETOOTH_UUID_FITNESS_MACHINE_SERVICE = 0x1826,
+	BLUETOOTH_UUID_MESH_PROVISIONING_SERVICE = 0x1827,
+	BLUETOOTH_UUID_MESH_PROXY_SERVICE = 0x1828,
+	BLUETOOTH_UUID_RECONNECTION_CONFIGURATION_SERVICE = 0x1829,
+
+	/* GATT descriptors */
+	BLUETOOTH_UUID_CHARACTERISTIC_EXTENDED_PROPERTIES = 0x2900,
+	BLUETOOTH_UUID_CHARACTERISTIC_USER_DESCRIPTION = 0x2901,
+	BLUETOOTH_UUID_CLIENT_CHARACTERISTIC_CONFIGURATION = 0x2902,
+	BLUETOOTH_UUID_SERVER_CHARACTERISTIC_CONFIGURATION = 0x2903,
+	BLUETOOTH_UUID_CHARACTERISTIC_PRESENTATION_FORMAT = 0x2904,
+	BLUETOOTH_UUID_CHARACTERISTIC_AGGREGATE_FORMAT = 0x2905,
+	BLUETOOTH_UUID_VALID_RANGE = 0x2906,
+	BLUETOOTH_UUID_EXTERNAL_REPORT_REFERENCE = 0x2907,
+	BLUETOOTH_UUID_REPORT_REFERENCE = 0x2908,
+	BLUETOOTH_UUID_NUMBER_OF_DIGITALS = 0x2909,
+	BLUETOOTH_UUID_VALUE_TRIGGER_SETTING = 0x290a,
+	BLUETOOTH_UUID_ENVIRONMENTAL_SENSING_CONFIGURATION = 0x290b,
+	BLUETOOTH_UUID_ENVIRONMENTAL_SENSING_MEASUREMENT = 0x290c,
+	BLUETOOTH_UUID_ENVIRONMENTAL_SENSING_TRIGGER_SETTING = 0x290d,
+	BLUETOOTH_UUID_TIME_TRIGGER_SETTING = 0x290e,
+
+	/* GATT characteristics */
+	BLUETOOTH_UUID_DEVICE_NAME = 0x2a00,
+	BLUETOOTH_UUID_APPEARANCE = 0x2a01,
+	BLUETOOTH_UUID_PERIPHERAL_PRIVACY_FLAG = 0x2a02,
+	BLUETOOTH_UUID_RECONNECTION_ADDRESS = 0x2a03,
+	BLUETOOTH_UUID_PERIPHERAL_PREFERRED_CONNECTION_PARAMETERS = 0x2a04,
+	BLUETOOTH_UUID_SERVICE_CHANGED = 0x2a05,
+	BLUETOOTH_UUID_ALERT_LEVEL = 0x2a06,
+	BLUETOOTH_UUID_TX_POWER_LEVEL = 0x2a07,
+	BLUETOOTH_UUID_BATTERY_LEVEL = 0x2a19,
+	BLUETOOTH_UUID_SYSTEM_ID = 0x2a23,
+	BLUETOOTH_UUID_MODEL_NUMBER_STRING = 0x2a24,
+	BLUETOOTH_UUID_SERIAL_NUMBER_STRING = 0x2a25,
+	BLUETOOTH_UUID_FIRMWARE_REVISION_STRING = 0x2a26,
+	BLUETOOTH_UUID_HARDWARE_REVISION_STRING = 0x2a27,
+	BLUETOOTH_UUID_SOFTWARE_REVISION_STRING = 0x2a28,
+	BLUETOOTH_UUID_MANUFACTURER_NAME_STRING = 0x2a29,
+	BLUETOOTH_UUID_HEART_RATE_MEASUREMENT = 0x2a37,
+	BLUETOOTH_UUID_BODY_SENSOR_LOCATION = 0x2a38,
+	BLUETOOTH_UUID_HID_INFORMATION = 0x2a4a,
+	BLUETOOTH_UUID_REPORT_MAP = 0x2a4b,
+	BLUETOOTH_UUID_HID_CONTROL_POINT = 0x2a4c,
+	BLUETOOTH_UUID_REPORT = 0x2a4d,
+	BLUETOOTH_UUID_PROTOCOL_MODE = 0x2a4e,
+	BLUETOOTH_UUID_PNP_ID = 0x2a50,
+	BLUETOOTH_UUID_CENTRAL_ADDRESS_RESOLUTION = 0x2aa6,
+	BLUETOOTH_UUID_RESOLVABLE_PRIVATE_ADDRESS_ONLY = 0x2ac9,
+	BLUETOOTH_UUID_CLIENT_SUPPORTED_FEATURES = 0x2b29,
+	BLUETOOTH_UUID_DATABASE_HASH = 0x2b2a,
+	BLUETOOTH_UUID_SERVER_SUPPORTED_FEATURES = 0x2b3a
+};
+
+/**
+ * @brief Entry of the assigned number table.
+ */
+struct BluetoothSigUuidEntry
+{
+	BluetoothSigUuid uuid;
+	const char *name;
+};
+
+/**
+ * @brief Table of all known assigned numbers with their names, sorted by value.
+ */
+static constexpr BluetoothSigUuidEntry BLUETOOTH_SIG_UUIDS[] =
+{
+{ BLUETOOTH_UUID_GENERIC_ACCESS_SERVICE, "Generic Access Service" },
+	{ BLUETOOTH_UUID_GENERIC_ATTRIBUTE_SERVICE, "Generic Attribute Service" },
+	{ BLUETOOTH_UUID_IMMEDIATE_ALERT_SERVICE, "Immediate Alert Service" },
+	{ BLUETOOTH_UUID_LINK_LOSS_SERVICE, "Link Loss Service" },
+	{ BLUETOOTH_UUID_TX_POWER_SERVICE, "Tx Power Service" },
+	{ BLUETOOTH_UUID_CURRENT_TIME_SERVICE, "Current Time Service" },
+	{ BLUETOOTH_UUID_REFERENCE_TIME_UPDATE_SERVICE, "Reference Time Update Service" },
+	{ BLUETOOTH_UUID_NEXT_DST_CHANGE_SERVICE, "Next DST Change Service" },
+	{ BLUETOOTH_UUID_GLUCOSE_SERVICE, "Glucose Service" },
+	{ BLUETOOTH_UUID_HEALTH_THERMOMETER_SERVICE, "Health Thermometer Service" },
+	{ BLUETOOTH_UUID_DEVICE_INFORMATION_SERVICE, "Device Information Service" },
+	{ BLUETOOTH_UUID_HEART_RATE_SERVICE, "Heart Rate Service" },
+	{ BLUETOOTH_UUID_PHONE_ALERT_STATUS_SERVICE, "Phone Alert Status Service" },
+	{ BLUETOOTH_UUID_BATTERY_SERVICE, "Battery Service" },
+	{ BLUETOOTH_UUID_BLOOD_PRESSURE_SERVICE, "Blood Pressure Service" },
+	{ BLUETOOTH_UUID_ALERT_NOTIFICATION_SERVICE, "Alert Notification Service" },
+	{ BLUETOOTH_UUID_HUMAN_INTERFACE_DEVICE_SERVICE, "Human Interface Device Service" },
+	{ BLUETOOTH_UUID_SCAN_PARAMETERS_SERVICE, "Scan Parameters Service" },
+	{ BLUETOOTH_UUID_RUNNING_SPEED_AND_CADENCE_SERVICE, "Running Speed and Cadence Service" },
+	{ BLUETOOTH_UUID_AUTOMATION_IO_SERVICE, "Automation IO Service" },
+	{ BLUETOOTH_UUID_CYCLING_SPEED_AND_CADENCE_SERVICE, "Cycling Speed and Cadence Service" },
+	{ BLUETOOTH_UUID_CYCLING_POWER_SERVICE, "Cycling Power Service" },
+	{ BLUETOOTH_UUID_LOCATION_AND_NAVIGATION_SERVICE, "Location and Navigation Service" },
+	{ BLUETOOTH_UUID_ENVIRONMENTAL_SENSING_SERVICE, "Environmental Sensing Service" },
+	{ BLUETOOTH_UUID_BODY_COMPOSITION_SERVICE, "Body Composition Service" },
+	{ BLUETOOTH_UUID_USER_DATA_SERVICE, "User Data Service" },
+	{ BLUETOOTH_UUID_WEIGHT_SCALE_SERVICE, "Weight Scale Service" },
+	{ BLUETOOTH_UUID_BOND_MANAGEMENT_SERVICE, "Bond Management Service" },
+	{ BLUETOOTH_UUID_CONTINUOUS_GLUCOSE_MONITORING_SERVICE, "Continuous Glucose Monitoring Service" },
+	{ BLUETOOTH_UUID_INTERNET_PROTOCOL_SUPPORT_SERVICE, "Internet Protocol Support Service" },
+	{ BLUETOOTH_UUID_INDOOR_POSITIONING_SERVICE, "Indoor Positioning Service" },
+	{ BLUETOOTH_UUID_PULSE_OXIMETER_SERVICE, "Pulse Oximeter Service" },
+	{ BLUETOOTH_UUID_HTTP_PROXY_SERVICE, "HTTP Proxy Service" },
+	{ BLUETOOTH_UUID_TRANSPORT_DISCOVERY_SERVICE, "Transport Discovery Service" },
+	{ BLUETOOTH_UUID_OBJECT_TRANSFER_SERVICE, "Object Transfer Service" },
+	{ BLUETOOTH_UUID_FITNESS_MACHINE_SERVICE, "Fitness Machine Service" },
+	{ BLUETOOTH_UUID_MESH_PROVISIONING_SERVICE, "Mesh Provisioning Service" },
+	{ BLUETOOTH_UUID_MESH_PROXY_SERVICE, "Mesh Proxy Service" },
+	{ BLUETOOTH_UUID_RECONNECTION_CONFIGURATION_SERVICE, "Reconnection Configuration Service" },
+	{ BLUETOOTH_UUID_CHARACTERISTIC_EXTENDED_PROPERTIES, "Characteristic Extended Properties" },
+	{ BLUETOOTH_UUID_CHARACTERISTIC_USER_DESCRIPTION, "Characteristic User Description" },
+	{ BLUETOOTH_UUID_CLIENT_CHARACTERISTIC_CONFIGURATION, "Client Characteristic Configuration" },
+	{ BLUETOOTH_UUID_SERVER_CHARACTERISTIC_CONFIGURATION, "Server Characteristic Configuration" },
+	{ BLUETOOTH_UUID_CHARACTERISTIC_PRESENTATION_FORMAT, "Characteristic Presentation Format" },
+	{ BLUETOOTH_UUID_CHARACTERISTIC_AGGREGATE_FORMAT, "Characteristic Aggregate Format" },
+	{ BLUETOOTH_UUID_VALID_RANGE, "Valid Range" },
+	{ BLUETOOTH_UUID_EXTERNAL_REPORT_REFERENCE, "External Report Reference" },
+	{ BLUETOOTH_UUID_REPORT_REFERENCE, "Report Reference" },
+	{ BLUETOOTH_UUID_NUMBER_OF_DIGITALS, "Number of Digitals" },
+	{ BLUETOOTH_UUID_VALUE_TRIGGER_SETTING, "Value Trigger Setting" },
+	{ BLUETOOTH_UUID_ENVIRONMENTAL_SENSING_CONFIGURATION, "Environmental Sensing Configuration" },
+	{ BLUETOOTH_UUID_ENVIRONMENTAL_SENSING_MEASUREMENT, "Environmental Sensing Measurement" },
+	{ BLUETOOTH_UUID_ENVIRONMENTAL_SENSING_TRIGGER_SETTING, "Environmental Sensing Trigger Setting" },
+	{ BLUETOOTH_UUID_TIME_TRIGGER_SETTING, "Time Trigger Setting" },
+	{ BLUETOOTH_UUID_DEVICE_NAME, "Device Name" },
+	{ BLUETOOTH_UUID_APPEARANCE, "Appearance" },
+	{ BLUETOOTH_UUID_PERIPHERAL_PRIVACY_FLAG, "Peripheral Privacy Flag" },
+	{ BLUETOOTH_UUID_RECONNECTION_ADDRESS, "Reconnection Address" },
+	{ BLUETOOTH_UUID_PERIPHERAL_PREFERRED_CONNECTION_PARAMETERS, "Peripheral Preferred Connection Parameters" },
+	{ BLUETOOTH_UUID_SERVICE_CHANGED, "Service Changed" },
+	{ BLUETOOTH_UUID_ALERT_LEVEL, "Alert Level" },
+	{ BLUETOOTH_UUID_TX_POWER_LEVEL, "Tx Power Level" },
+	{ BLUETOOTH_UUID_BATTERY_LEVEL, "Battery Level" },
+	{ BLUETOOTH_UUID_SYSTEM_ID, "System ID" },
+	{ BLUETOOTH_UUID_MODEL_NUMBER_STRING, "Model Number String" },
+	{ BLUETOOTH_UUID_SERIAL_NUMBER_STRING, "Serial Number String" },
+	{ BLUETOOTH_UUID_FIRMWARE_REVISION_STRING, "Firmware Revision String" },
+	{ BLUETOOTH_UUID_HARDWARE_REVISION_STRING, "Hardware Revision String" },
+	{ BLUETOOTH_UUID_SOFTWARE_REVISION_STRING, "Software Revision String" },
+	{ BLUETOOTH_UUID_MANUFACTURER_NAME_STRING, "Manufacturer Name String" },
+	{ BLUETOOTH_UUID_HEART_RATE_MEASUREMENT, "Heart Rate Measurement" },
+	{ BLUETOOTH_UUID_BODY_SENSOR_LOCATION, "Body Sensor Location" },
+	{ BLUETOOTH_UUID_HID_INFORMATION, "HID Information" },
+	{ BLUETOOTH_UUID_REPORT_MAP, "Report Map" },
+	{ BLUETOOTH_UUID_HID_CONTROL_POINT, "HID Control Point" },
+	{ BLUETOOTH_UUID_REPORT, "Report" },
+	{ BLUETOOTH_UUID_PROTOCOL_MODE, "Protocol Mode" },
+	{ BLUETOOTH_UUID_PNP_ID, "PnP ID" },
+	{ BLUETOOTH_UUID_CENTRAL_ADDRESS_RESOLUTION, "Central Address Resolution" },
+	{ BLUETOOTH_UUID_RESOLVABLE_PRIVATE_ADDRESS_ONLY, "Resolvable Private Address Only" },
+	{ BLUETOOTH_UUID_CLIENT_SUPPORTED_FEATURES, "Client Supported Features" },
+	{ BLUETOOTH_UUID_DATABASE_HASH, "Database Hash" },
+	{ BLUETOOTH_UUID_SERVER_SUPPORTED_FEATURES, "Server Supported Features" }
+};
+
+/**
+ * @brief Number of entries in BLUETOOTH_SIG_UUIDS
+ */
+static constexpr size_t BLUETOOTH_SIG_UUIDS_COUNT = sizeof(BLUETOOTH_SIG_UUIDS) / sizeof(BLUETOOTH_SIG_UUIDS[0]);
+
+/**
+ * @brief Binary search within [first, last) of BLUETOOTH_SIG_UUIDS. Written as a
+ *        single expression to stay usable in constant expressions.
+ */
+constexpr const char* findBluetoothSigUuidName(uint32_t uuid, size_t first, size_t last)
+{
+	return first >= last ? nullptr :
+	       BLUETOOTH_SIG_UUIDS[(first + last) / 2].uuid == uuid ? BLUETOOTH_SIG_UUIDS[(first + last) / 2].name :
+	       BLUETOOTH_SIG_UUIDS[(first + last) / 2].uuid < uuid ? findBluetoothSigUuidName(uuid, (first + last) / 2 + 1, last) :
+	       findBluetoothSigUuidName(uuid, first, (first + last) / 2);
+}
+
+/**
+ * @brief Look up the name of an assigned number
+ * @param uuid 16 bit value of the UUID
+ * @return Name of the assigned number or nullptr if unknown.
+ */
+constexpr const char* getBluetoothSigUuidName(uint32_t uuid)
+{
+	return findBluetoothSigUuidName(uuid, 0, BLUETOOTH_SIG_UUIDS_COUNT);
+}
+
+/**
+ * @brief Look up the name of an assigned number
+ * @param uuid UUID in any of its 16, 32 or 128 bit forms
+ * @return Name of the assigned number or nullptr if unknown.
+ */
+inline const char* getBluetoothSigUuidName(const BluetoothUuid &uuid)
+{
+	return uuid.isBaseUuid() ? getBluetoothSigUuidName(uuid.toShortUuid()) : nullptr;
+}
+
+#endif // BLUETOOTH_SIL_SIGUUID_H_
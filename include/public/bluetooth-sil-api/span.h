@@ -0,0 +1,85 @@
+// Copyright (c) 2026 LG Electronics, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef BLUETOOTH_SIL_SPAN_H_
+#define BLUETOOTH_SIL_SPAN_H_
+
+#ifndef BLUETOOTH_SIL_H_
+	#error This header file should only be included by bluetooth-sil-api.h
+#endif
+
+#include <stdint.h>
+#include <cstddef>
+
+/**
+ * @brief Borrowed view on a sequence of bytes.
+ *
+ *        The span doesn't own the bytes it refers to. It is only valid as long
+ *        as the underlying buffer is alive and not modified.
+ */
+class BluetoothByteSpan
+{
+public:
+	/**
+	 * @brief Create an empty span
+	 */
+	constexpr BluetoothByteSpan() : bytes(nullptr), length(0) { }
+
+	/**
+	 * @brief Create a span over a buffer
+	 * @param data Pointer to the first byte
+	 * @param size Number of bytes
+	 */
+	constexpr BluetoothByteSpan(const uint8_t *data, size_t size) : bytes(data), length(size) { }
+
+	/**
+	 * @brief Create a span over the content of a byte vector
+	 * @param data Vector to refer to
+	 */
+	BluetoothByteSpan(const std::vector<uint8_t> &data) : bytes(data.data()), length(data.size()) { }
+
+	constexpr const uint8_t* data() const { return bytes; }
+	constexpr size_t size() const { return length; }
+	constexpr bool empty() const { return length == 0; }
+
+	constexpr const uint8_t* begin() const { return bytes; }
+	constexpr const uint8_t* end() const { return bytes + length; }
+
+	constexpr uint8_t operator[](size_t index) const { return bytes[index]; }
+
+	/**
+	 * @brief Create a span over a part of this span
+	 * @param offset Offset of the first byte. Must not exceed size().
+	 * @param count Maximum number of bytes
+	 * @return Span over the bytes in range
+	 */
+	constexpr BluetoothByteSpan subspan(size_t offset, size_t count = (size_t) -1) const
+	{
+		return BluetoothByteSpan(bytes + offset, count < length - offset ? count : length - offset);
+	}
+
+	/**
+	 * @brief Copy the bytes into a vector
+	 * @return Vector with a copy of all bytes
+	 */
+	std::vector<uint8_t> toVector() const { return std::vector<uint8_t>(begin(), end()); }
+
+private:
+	const uint8_t *bytes;
+	size_t length;
+};
+
+#endif
@@ -29,11 +29,33 @@
 #include <string>
 #include <vector>
 #include <algorithm>
+#include <mutex>
+#include <unordered_map>
+
+/*
+ * 128 bit UUIDs are decoded with SSE2 or NEON when available. Define
+ * BLUETOOTH_SIL_UUID_NO_SIMD to force the portable scalar decoder.
+ */
+#if !defined(BLUETOOTH_SIL_UUID_NO_SIMD) && defined(__SSE2__)
+	#include <emmintrin.h>
+	#define BLUETOOTH_SIL_UUID_SSE2
+#elif !defined(BLUETOOTH_SIL_UUID_NO_SIMD) && (defined(__ARM_NEON) || defined(__ARM_NEON__))
+	#include <arm_neon.h>
+	#define BLUETOOTH_SIL_UUID_NEON
+#endif
 
 #define BLUETOOTH_UUID_128_LENGTH	36
 #define BLUETOOTH_UUID_32_LENGTH	8
 #define BLUETOOTH_UUID_16_LENGTH	4
 
+/*
+ * Bluetooth base UUID 00000000-0000-1000-8000-00805f9b34fb which 16 and 32
+ * bit UUIDs are aliases of (see Bluetooth Core Specification vol 3 part B
+ * chapter 2.5.1).
+ */
+#define BLUETOOTH_BASE_UUID_MSB		0x0000000000001000ULL
+#define BLUETOOTH_BASE_UUID_LSB		0x800000805f9b34fbULL
+
 struct uint128_t
 {
     uint8_t data[16];
@@ -45,8 +67,21 @@ struct uint128_t
  *        This class is able to deal with 16, 32 or 128 bit long UUIDs. The origin
  *        of the UUID is always a string which is then parsed and handled accordingly.
  *
- *        Internally only the string is stored and when needed parsed and converted
- *        into the needed format.
+ *        The string is parsed once on construction and the UUID is stored as its
+ *        128 bit binary value, split into two 64 bit halves in big endian order.
+ *        Comparison and hashing work directly on these values; the string
+ *        representation is only formatted again when toString() is called.
+ *
+ *        16 and 32 bit UUIDs are stored expanded against the Bluetooth base
+ *        UUID. Therefore "180f" and "0000180f-0000-1000-8000-00805f9b34fb"
+ *        compare equal, sort next to each other and share the same hash. The
+ *        type is only kept to format the UUID in its original length. An
+ *        invalid UUID never equals a valid one, not even the nil UUID which
+ *        shares its binary value.
+ *
+ *        Input which can't be parsed is kept as is in a separately allocated
+ *        string so that toString() still returns it. Parsed UUIDs don't
+ *        allocate and only take the two halves and a tagged pointer.
  */
 class BluetoothUuid
 {
@@ -65,67 +100,166 @@ public:
 	/**
 	 * @brief Default c'tor
 	 */
-	BluetoothUuid() : type(UNKNOWN) { }
+	BluetoothUuid() : msb(0), lsb(0), tagged(UNKNOWN) { }
 
 	/**
 	 * @brief Create UUID from a string and determine its type automatically
 	 * @param uuid UUID to be set
 	 */
-	BluetoothUuid(const std::string &uuid) : uuid(uuid), type(UNKNOWN) { determineType(); }
+	BluetoothUuid(const std::string &uuid) : msb(0), lsb(0), tagged(UNKNOWN) { parse(uuid, UNKNOWN); }
 
 	/**
 	 * @brief Create UUID from a string and set its type manually
 	 * @param uuid UUID to be set
 	 * @param type Type of the UUID
 	 */
-	BluetoothUuid(const std::string &uuid, Type type) : uuid(uuid), type(type) { }
+	BluetoothUuid(const std::string &uuid, Type type) : msb(0), lsb(0), tagged(UNKNOWN) { parse(uuid, type); }
+
+	/**
+	 * @brief Create UUID from its binary value
+	 *
+	 *        16 and 32 bit UUIDs must already be expanded against the Bluetooth
+	 *        base UUID; prefer fromUInt16() and fromUInt32() for those.
+	 *
+	 * @param msb Most significant 64 bits of the UUID
+	 * @param lsb Least significant 64 bits of the UUID
+	 * @param type Type of the UUID which defines the format used by toString()
+	 */
+	BluetoothUuid(uint64_t msb, uint64_t lsb, Type type = UUID128) :
+	    msb(msb), lsb(lsb), tagged(type) { }
 
 	/**
 	 * @brief Copy c'tor
 	 * @param other Other object to copy values from
 	 */
-	BluetoothUuid(const BluetoothUuid &other) : uuid(other.uuid), type(other.type) { }
+	BluetoothUuid(const BluetoothUuid &other) : msb(other.msb), lsb(other.lsb), tagged(other.getType())
+	{
+		if (other.raw())
+			setRaw(*other.raw());
+	}
+
+	/**
+	 * @brief Move c'tor
+	 * @param other Other object to take the values from
+	 */
+	BluetoothUuid(BluetoothUuid &&other) : msb(other.msb), lsb(other.lsb), tagged(other.tagged)
+	{
+		other.tagged = other.getType();
+	}
+
+	~BluetoothUuid() { delete raw(); }
+
+	/**
+	 * @brief Assignment operator
+	 * @param other Other object to copy or move values from
+	 * @return Reference to this object
+	 */
+	BluetoothUuid& operator =(BluetoothUuid other)
+	{
+		std::swap(msb, other.msb);
+		std::swap(lsb, other.lsb);
+		std::swap(tagged, other.tagged);
+		return *this;
+	}
+
+	/**
+	 * @brief Create a 16 bit UUID
+	 * @param value 16 bit value of the UUID
+	 * @return UUID based on the Bluetooth base UUID
+	 */
+	static BluetoothUuid fromUInt16(uint16_t value)
+	{
+		return BluetoothUuid((static_cast<uint64_t>(value) << 32) | BLUETOOTH_BASE_UUID_MSB,
+		                     BLUETOOTH_BASE_UUID_LSB, UUID16);
+	}
+
+	/**
+	 * @brief Create a 32 bit UUID
+	 * @param value 32 bit value of the UUID
+	 * @return UUID based on the Bluetooth base UUID
+	 */
+	static BluetoothUuid fromUInt32(uint32_t value)
+	{
+		return BluetoothUuid((static_cast<uint64_t>(value) << 32) | BLUETOOTH_BASE_UUID_MSB,
+		                     BLUETOOTH_BASE_UUID_LSB, UUID32);
+	}
 
 	/**
 	 * @brief Operator implementation to support UUID comparison
 	 * @param rhs Right-hand side object to compare
 	 * @return Result of the comparison.
 	 */
-	bool operator <(const BluetoothUuid& rhs) const { return uuid < rhs.uuid; }
+	bool operator <(const BluetoothUuid& rhs) const
+	{
+		if (msb != rhs.msb)
+			return msb < rhs.msb;
+		if (lsb != rhs.lsb)
+			return lsb < rhs.lsb;
+		if (isValid() != rhs.isValid())
+			return !isValid();
+
+		const std::string *text = raw();
+		const std::string *otherText = rhs.raw();
+		if (!text || !otherText)
+			return !text && otherText;
+
+		return *text < *otherText;
+	}
 
 	/**
 	 * @brief Operator implementation to support UUID comparison
 	 * @param rhs Right-hand side object to compare
 	 * @return Result of the comparison.
 	 */
-	bool operator ==(const BluetoothUuid& rhs) const { return uuid == rhs.uuid; }
+	bool operator ==(const BluetoothUuid& rhs) const
+	{
+		if (msb != rhs.msb || lsb != rhs.lsb || isValid() != rhs.isValid())
+			return false;
+
+		const std::string *text = raw();
+		const std::string *otherText = rhs.raw();
+		return text == otherText || (text && otherText && *text == *otherText);
+	}
 
 	/**
 	 * @brief Operator implementation to support UUID comparison
 	 * @param rhs Right-hand side object to compare
 	 * @return Result of the comparison.
 	 */
-        bool operator !=(const BluetoothUuid& rhs) const { return uuid != rhs.uuid; }
+	bool operator !=(const BluetoothUuid& rhs) const { return !(*this == rhs); }
 
 	/**
 	 * @brief Operator implementation to support UUID comparison
 	 * @param rhs Right-hand side object to compare
 	 * @return Result of the comparison.
 	 */
-	bool operator ==(const std::string& rhs) const { return uuid == rhs; }
+	bool operator ==(const std::string& rhs) const { return *this == BluetoothUuid(rhs); }
 
 	/**
 	 * @brief Operator implementation to support UUID comparison
 	 * @param rhs Right-hand side object to compare
 	 * @return Result of the comparison.
 	 */
-	bool operator !=(const std::string& rhs) const { return uuid != rhs; }
+	bool operator !=(const std::string& rhs) const { return !(*this == rhs); }
 
 	/**
 	 * @brief Return UUID as string
+	 *
+	 *        Valid UUIDs are formatted from their binary value in lower case
+	 *        hex digits. Input which couldn't be parsed is returned unchanged.
+	 *
 	 * @return UUID as std::string
 	 */
-	std::string toString() const { return uuid; }
+	std::string toString() const
+	{
+		if (raw())
+			return *raw();
+		if (!isValid())
+			return std::string();
+
+		char buffer[BLUETOOTH_UUID_128_LENGTH + 1];
+		return std::string(buffer, format(buffer));
+	}
 
 	/**
 	 * @brief Convert UUID to a uint16 value
@@ -133,19 +267,10 @@ public:
 	 */
 	uint16_t toUInt16() const
 	{
-		if (!isValid())
-			return 0;
-
-		if (type == UUID128)
-			return 0;
-
-		char *endptr = nullptr;
-
-		uint16_t value = static_cast<uint16_t>(strtoull(uuid.c_str(), &endptr, 16));
-		if (!endptr || *endptr != '\0')
+		if (!isParsed() || getType() == UUID128)
 			return 0;
 
-		return value;
+		return static_cast<uint16_t>(msb >> 32);
 	}
 
 	/**
@@ -154,64 +279,42 @@ public:
 	 */
 	uint32_t toUInt32() const
 	{
-		if (!isValid())
-			return 0;
-
-		if (type == UUID128)
-			return 0;
-
-		char *endptr = nullptr;
-
-		uint32_t value = static_cast<uint32_t>(strtoull(uuid.c_str(), &endptr, 16));
-		if (!endptr || *endptr != '\0')
+		if (!isParsed() || getType() == UUID128)
 			return 0;
 
-		return value;
+		return static_cast<uint32_t>(msb >> 32);
 	}
 
 	/**
 	 * @brief Convert UUID to a uint128 value
+	 *
+	 *        For 16 and 32 bit UUIDs the value is stored in host byte order within
+	 *        the first four bytes.
+	 *
 	 * @return UUID converted to uint128 or 0 if conversion is not possible.
 	 */
 	uint128_t toUInt128() const
 	{
 		uint128_t value;
-		uint8_t *ptr = (uint8_t*) &value;
 
 		memset(&value, 0, sizeof(uint128_t));
 
-		if (!isValid())
+		if (!isParsed())
 			return value;
 
-		if (type != UUID128)
+		if (getType() != UUID128)
 		{
 			// Getting a 32 bit value will always work also when we have only a 16 bit UUID
 			uint32_t u32 = toUInt32();
-			memcpy(&ptr[0], &u32, 4);
+			memcpy(&value.data[0], &u32, 4);
 		}
 		else
 		{
-			uint32_t data0, data4;
-			uint16_t data1, data2, data3, data5;
-
-			auto ret = sscanf(uuid.c_str(), "%08x-%04hx-%04hx-%04hx-%08x%04hx",
-			       &data0, &data1, &data2, &data3, &data4, &data5);
-			if (ret != 6)
-				return value;
-
-			data0 = htonl(data0);
-			data1 = htons(data1);
-			data2 = htons(data2);
-			data3 = htons(data3);
-			data4 = htonl(data4);
-			data5 = htons(data5);
-
-			memcpy(&ptr[0], &data0, 4);
-			memcpy(&ptr[4], &data1, 2);
-			memcpy(&ptr[6], &data2, 2);
-			memcpy(&ptr[8], &data3, 2);
-			memcpy(&ptr[10], &data4, 4);
-			memcpy(&ptr[14], &data5, 2);
+			for (int n = 0; n < 8; n++)
+			{
+				value.data[n] = static_cast<uint8_t>(msb >> (56 - 8 * n));
+				value.data[n + 8] = static_cast<uint8_t>(lsb >> (56 - 8 * n));
+			}
 		}
 
 		return value;
@@ -221,64 +324,296 @@ public:
 	 * @brief Check if UUID is valid.
 	 * @return True if UUID is valid. False otherwise.
 	 */
-	bool isValid() const { return type != UNKNOWN; }
+	bool isValid() const { return getType() != UNKNOWN; }
 
 	/**
 	 * @brief Retrieve the type of the UUID
 	 * @return Type of the UUID
 	 */
-	Type getType() const { return type; }
+	Type getType() const { return static_cast<Type>(tagged & TYPE_MASK); }
+
+	/**
+	 * @brief Retrieve the most significant 64 bits of the UUID
+	 * @return Upper half of the binary UUID value
+	 */
+	uint64_t getMostSignificantBits() const { return msb; }
+
+	/**
+	 * @brief Retrieve the least significant 64 bits of the UUID
+	 * @return Lower half of the binary UUID value
+	 */
+	uint64_t getLeastSignificantBits() const { return lsb; }
+
+	/**
+	 * @brief Check if the UUID is an alias based on the Bluetooth base UUID
+	 *
+	 *        This is true for all 16 and 32 bit UUIDs but also for 128 bit UUIDs
+	 *        which are written in their expanded form.
+	 *
+	 * @return True if the UUID is based on the Bluetooth base UUID. False otherwise.
+	 */
+	bool isBaseUuid() const
+	{
+		return isValid() && !raw() && lsb == BLUETOOTH_BASE_UUID_LSB &&
+		       (msb & 0xffffffffULL) == BLUETOOTH_BASE_UUID_MSB;
+	}
+
+	/**
+	 * @brief Retrieve the 16 or 32 bit alias of a UUID based on the Bluetooth
+	 *        base UUID independent of the form it was created from.
+	 *
+	 *        Useful to dispatch on assigned numbers with a switch statement.
+	 *
+	 * @return Short value of the UUID or 0 if it isn't based on the Bluetooth base UUID.
+	 */
+	uint32_t toShortUuid() const
+	{
+		return isBaseUuid() ? static_cast<uint32_t>(msb >> 32) : 0;
+	}
 
 private:
-	void determineType()
+	// The type is kept in the low bits of the pointer to the unparsed text
+	static const uintptr_t TYPE_MASK = 3;
+
+	bool isParsed() const { return isValid() && !raw(); }
+
+	const std::string* raw() const { return reinterpret_cast<const std::string*>(tagged & ~TYPE_MASK); }
+
+	void setRaw(const std::string &text)
+	{
+		static_assert(alignof(std::string) > TYPE_MASK, "type doesn't fit next to the pointer");
+		tagged = reinterpret_cast<uintptr_t>(new std::string(text)) | getType();
+	}
+
+	static int hexValue(char c)
 	{
-		bool onlyAlNum = std::find_if(uuid.begin(), uuid.end(), [](char c) { return !isalnum(c); }) == uuid.end();
+		if (c >= '0' && c <= '9')
+			return c - '0';
+		if (c >= 'a' && c <= 'f')
+			return c - 'a' + 10;
+		if (c >= 'A' && c <= 'F')
+			return c - 'A' + 10;
+		return -1;
+	}
 
-		if (onlyAlNum)
+	static bool parseHex(const char *str, size_t length, uint64_t &value)
+	{
+		value = 0;
+
+		for (size_t n = 0; n < length; n++)
 		{
-			if (uuid.length() == BLUETOOTH_UUID_16_LENGTH)
-				type = UUID16;
-			else if (uuid.length() == BLUETOOTH_UUID_32_LENGTH)
-				type = UUID32;
+			int nibble = hexValue(str[n]);
+			if (nibble < 0)
+				return false;
+
+			value = (value << 4) | static_cast<uint64_t>(nibble);
 		}
-		else if (!onlyAlNum)
+
+		return true;
+	}
+
+#if defined(BLUETOOTH_SIL_UUID_SSE2)
+	/*
+	 * Validate 16 hex digits and convert them into their nibble values. Digits
+	 * and letters are matched with signed compares so any byte >= 0x80 fails.
+	 */
+	static bool decodeNibbles(__m128i chars, __m128i &nibbles)
+	{
+		const __m128i lower = _mm_or_si128(chars, _mm_set1_epi8(0x20));
+		const __m128i digit = _mm_and_si128(_mm_cmpgt_epi8(chars, _mm_set1_epi8('0' - 1)),
+		                                    _mm_cmplt_epi8(chars, _mm_set1_epi8('9' + 1)));
+		const __m128i alpha = _mm_and_si128(_mm_cmpgt_epi8(lower, _mm_set1_epi8('a' - 1)),
+		                                    _mm_cmplt_epi8(lower, _mm_set1_epi8('f' + 1)));
+
+		if (_mm_movemask_epi8(_mm_or_si128(digit, alpha)) != 0xffff)
+			return false;
+
+		nibbles = _mm_or_si128(_mm_and_si128(digit, _mm_sub_epi8(chars, _mm_set1_epi8('0'))),
+		                       _mm_andnot_si128(digit, _mm_sub_epi8(lower, _mm_set1_epi8('a' - 10))));
+		return true;
+	}
+
+	// Merge each pair of nibbles into the low byte of a 16 bit lane
+	static __m128i mergeNibbles(__m128i nibbles)
+	{
+		return _mm_or_si128(_mm_and_si128(_mm_slli_epi16(nibbles, 4), _mm_set1_epi16(0x00f0)),
+		                    _mm_srli_epi16(nibbles, 8));
+	}
+#elif defined(BLUETOOTH_SIL_UUID_NEON)
+	static bool decodeBytes(const char *digits, uint8x8_t &bytes)
+	{
+		const uint8x16_t chars = vld1q_u8(reinterpret_cast<const uint8_t*>(digits));
+		const uint8x16_t digitValue = vsubq_u8(chars, vdupq_n_u8('0'));
+		const uint8x16_t alphaValue = vsubq_u8(vorrq_u8(chars, vdupq_n_u8(0x20)), vdupq_n_u8('a'));
+		const uint8x16_t digit = vcltq_u8(digitValue, vdupq_n_u8(10));
+		const uint8x16_t valid = vorrq_u8(digit, vcltq_u8(alphaValue, vdupq_n_u8(6)));
+		const uint8x8_t folded = vand_u8(vget_low_u8(valid), vget_high_u8(valid));
+
+		if (vget_lane_u64(vreinterpret_u64_u8(folded), 0) != ~0ULL)
+			return false;
+
+		const uint16x8_t nibbles = vreinterpretq_u16_u8(vbslq_u8(digit, digitValue,
+		                                                         vaddq_u8(alphaValue, vdupq_n_u8(10))));
+		bytes = vmovn_u16(vorrq_u16(vandq_u16(vshlq_n_u16(nibbles, 4), vdupq_n_u16(0x00f0)),
+		                            vshrq_n_u16(nibbles, 8)));
+		return true;
+	}
+#endif
+
+	/*
+	 * Validate and decode 32 hex digits into 16 bytes in a single pass.
+	 */
+	static bool decodeHex32(const char *digits, uint8_t *bytes)
+	{
+#if defined(BLUETOOTH_SIL_UUID_SSE2)
+		__m128i first, second;
+
+		if (!decodeNibbles(_mm_loadu_si128(reinterpret_cast<const __m128i*>(&digits[0])), first) ||
+		    !decodeNibbles(_mm_loadu_si128(reinterpret_cast<const __m128i*>(&digits[16])), second))
+			return false;
+
+		_mm_storeu_si128(reinterpret_cast<__m128i*>(bytes),
+		                 _mm_packus_epi16(mergeNibbles(first), mergeNibbles(second)));
+		return true;
+#elif defined(BLUETOOTH_SIL_UUID_NEON)
+		uint8x8_t first, second;
+
+		if (!decodeBytes(&digits[0], first) || !decodeBytes(&digits[16], second))
+			return false;
+
+		vst1q_u8(bytes, vcombine_u8(first, second));
+		return true;
+#else
+		for (int n = 0; n < 16; n++)
 		{
-			if (uuid.length() != BLUETOOTH_UUID_128_LENGTH)
-				return;
-
-			auto validateUuid128 = [](std::string uuid) {
-				auto iter = uuid.begin();
-				unsigned int pos = 0;
-
-				while (iter != uuid.end())
-				{
-					// verify that hyphens are at the right place
-					if (pos == 8 || pos == 13 || pos == 18 || pos == 23)
-					{
-						if (*iter != '-')
-							return false;
-					}
-					// all other characters are allowed to be alpha-numeric only
-					else if(!isalnum(*iter))
-						return false;
-
-					pos++;
-					iter++;
-				}
-
-				return true;
-			};
-
-			if (!validateUuid128(uuid))
-				return;
-
-			type = UUID128;
+			int high = hexValue(digits[2 * n]);
+			int low = hexValue(digits[2 * n + 1]);
+
+			if (high < 0 || low < 0)
+				return false;
+
+			bytes[n] = static_cast<uint8_t>((high << 4) | low);
 		}
+
+		return true;
+#endif
+	}
+
+	static bool parseUuid128(const char *str, uint64_t &msb, uint64_t &lsb)
+	{
+		// verify that hyphens are at the right place
+		if (str[8] != '-' || str[13] != '-' || str[18] != '-' || str[23] != '-')
+			return false;
+
+		char digits[32];
+		uint8_t bytes[16];
+
+		memcpy(&digits[0], &str[0], 8);
+		memcpy(&digits[8], &str[9], 4);
+		memcpy(&digits[12], &str[14], 4);
+		memcpy(&digits[16], &str[19], 4);
+		memcpy(&digits[20], &str[24], 12);
+
+		if (!decodeHex32(digits, bytes))
+			return false;
+
+		msb = 0;
+		lsb = 0;
+
+		for (int n = 0; n < 8; n++)
+		{
+			msb = (msb << 8) | bytes[n];
+			lsb = (lsb << 8) | bytes[n + 8];
+		}
+
+		return true;
+	}
+
+	void parse(const std::string &uuid, Type expected)
+	{
+		Type detected = UNKNOWN;
+		uint64_t value = 0;
+
+		if (uuid.length() == BLUETOOTH_UUID_16_LENGTH)
+		{
+			if (parseHex(uuid.c_str(), BLUETOOTH_UUID_16_LENGTH, value))
+				detected = UUID16;
+		}
+		else if (uuid.length() == BLUETOOTH_UUID_32_LENGTH)
+		{
+			if (parseHex(uuid.c_str(), BLUETOOTH_UUID_32_LENGTH, value))
+				detected = UUID32;
+		}
+		else if (uuid.length() == BLUETOOTH_UUID_128_LENGTH)
+		{
+			if (parseUuid128(uuid.c_str(), msb, lsb))
+				detected = UUID128;
+		}
+
+		if (detected != UNKNOWN && (expected == UNKNOWN || expected == detected))
+		{
+			if (detected != UUID128)
+			{
+				msb = (value << 32) | BLUETOOTH_BASE_UUID_MSB;
+				lsb = BLUETOOTH_BASE_UUID_LSB;
+			}
+
+			tagged = detected;
+			return;
+		}
+
+		// Keep whatever we got so it can be handed back unchanged. A manually
+		// specified type is trusted as before.
+		msb = 0;
+		lsb = 0;
+		tagged = expected;
+		if (!uuid.empty())
+			setRaw(uuid);
+	}
+
+	static void formatHex(char *str, uint64_t value, int digits)
+	{
+		static const char hexDigits[] = "0123456789abcdef";
+
+		for (int n = digits - 1; n >= 0; n--)
+		{
+			str[n] = hexDigits[value & 0xf];
+			value >>= 4;
+		}
+	}
+
+	size_t format(char *str) const
+	{
+		if (getType() == UUID16)
+		{
+			formatHex(str, msb >> 32, BLUETOOTH_UUID_16_LENGTH);
+			return BLUETOOTH_UUID_16_LENGTH;
+		}
+
+		if (getType() == UUID32)
+		{
+			formatHex(str, msb >> 32, BLUETOOTH_UUID_32_LENGTH);
+			return BLUETOOTH_UUID_32_LENGTH;
+		}
+
+		formatHex(&str[0], msb >> 32, 8);
+		str[8] = '-';
+		formatHex(&str[9], msb >> 16, 4);
+		str[13] = '-';
+		formatHex(&str[14], msb, 4);
+		str[18] = '-';
+		formatHex(&str[19], lsb >> 48, 4);
+		str[23] = '-';
+		formatHex(&str[24], lsb, 12);
+
+		return BLUETOOTH_UUID_128_LENGTH;
 	}
 
 private:
-	std::string uuid;
-	Type type;
+	uint64_t msb;
+	uint64_t lsb;
+	// Type in the low bits, owned copy of the unparsed input above them
+	uintptr_t tagged;
 };
 
 typedef std::vector<BluetoothUuid> BluetoothUuidList;
@@ -290,9 +625,353 @@ namespace std
 	{
 		std::size_t operator()(const BluetoothUuid &uuid) const
 		{
-			return hash<string>()(uuid.toString());
+			if (!uuid.isValid())
+				return hash<string>()(uuid.toString());
+
+			uint64_t value = uuid.getMostSignificantBits() * 0x9e3779b97f4a7c15ULL ^ uuid.getLeastSignificantBits();
+			return hash<uint64_t>()(value ^ (value >> 32));
 		}
 	};
 }
 
+/**
+ * @brief Process-wide pool which maps UUIDs to compact 32 bit ids.
+ *
+ *        UUIDs based on the Bluetooth base UUID with a 16 bit alias use the alias
+ *        itself as id and never touch the pool. All other UUIDs are assigned
+ *        sequential ids starting at BLUETOOTH_UUID_POOL_FIRST_ID on first use.
+ *        Ids are never released and stay valid for the lifetime of the process
+ *        but must not be persisted or exchanged with other processes.
+ *
+ *        All methods are thread safe.
+ */
+class BluetoothUuidPool
+{
+public:
+	/**
+	 * @brief Id returned for UUIDs which are invalid or not part of the pool
+	 */
+	static const uint32_t INVALID_ID = 0xffffffff;
+
+	/**
+	 * @brief First id assigned to UUIDs without a 16 bit alias
+	 */
+	static const uint32_t FIRST_ID = 0x10000;
+
+	/**
+	 * @brief Retrieve the id of a UUID and add it to the pool if needed
+	 * @param uuid UUID to intern
+	 * @return Id of the UUID or INVALID_ID if the UUID isn't valid
+	 */
+	static uint32_t intern(const BluetoothUuid &uuid)
+	{
+		if (!uuid.isValid())
+			return INVALID_ID;
+
+		uint32_t alias = uuid.toShortUuid();
+		if (uuid.isBaseUuid() && alias <= 0xffff)
+			return alias;
+
+		Storage &storage = getStorage();
+		std::lock_guard<std::mutex> guard(storage.lock);
+
+		auto iter = storage.ids.find(uuid);
+		if (iter != storage.ids.end())
+			return iter->second;
+
+		uint32_t id = FIRST_ID + static_cast<uint32_t>(storage.uuids.size());
+		storage.uuids.push_back(uuid);
+		storage.ids.insert(std::make_pair(uuid, id));
+
+		return id;
+	}
+
+	/**
+	 * @brief Retrieve the id of a UUID without adding it to the pool
+	 * @param uuid UUID to look up
+	 * @return Id of the UUID or INVALID_ID if it was never interned
+	 */
+	static uint32_t find(const BluetoothUuid &uuid)
+	{
+		if (!uuid.isValid())
+			return INVALID_ID;
+
+		uint32_t alias = uuid.toShortUuid();
+		if (uuid.isBaseUuid() && alias <= 0xffff)
+			return alias;
+
+		Storage &storage = getStorage();
+		std::lock_guard<std::mutex> guard(storage.lock);
+
+		auto iter = storage.ids.find(uuid);
+		return iter == storage.ids.end() ? INVALID_ID : iter->second;
+	}
+
+	/**
+	 * @brief Retrieve the UUID for an id
+	 * @param id Id returned by intern()
+	 * @return UUID for the id or an invalid UUID if the id is unknown
+	 */
+	static BluetoothUuid lookup(uint32_t id)
+	{
+		if (id < FIRST_ID)
+			return BluetoothUuid::fromUInt16(static_cast<uint16_t>(id));
+
+		Storage &storage = getStorage();
+		std::lock_guard<std::mutex> guard(storage.lock);
+
+		if (id - FIRST_ID >= storage.uuids.size())
+			return BluetoothUuid();
+
+		return storage.uuids[id - FIRST_ID];
+	}
+
+	/**
+	 * @brief Retrieve the number of UUIDs stored in the pool
+	 * @return Number of UUIDs without a 16 bit alias which were interned so far
+	 */
+	static size_t size()
+	{
+		Storage &storage = getStorage();
+		std::lock_guard<std::mutex> guard(storage.lock);
+
+		return storage.uuids.size();
+	}
+
+private:
+	struct Storage
+	{
+		std::mutex lock;
+		std::unordered_map<BluetoothUuid, uint32_t> ids;
+		std::vector<BluetoothUuid> uuids;
+	};
+
+	// Never freed so the pool outlives any static object using it
+	static Storage& getStorage()
+	{
+		static Storage *storage = new Storage;
+		return *storage;
+	}
+};
+
+/**
+ * @brief Compact set of UUIDs
+ *
+ *        16 bit UUIDs assigned by the Bluetooth SIG are kept in a sparse bitmap
+ *        made of 64 bit blocks, so the UUIDs of a typical device only need one or
+ *        two blocks. All other UUIDs are interned with BluetoothUuidPool and their
+ *        ids are kept in a sorted vector.
+ *
+ *        A set doesn't remember in which form (16, 32 or 128 bit) a UUID was
+ *        inserted; toList() returns 16 bit UUIDs in their short form.
+ */
+class BluetoothUuidSet
+{
+public:
+	/**
+	 * @brief Default c'tor
+	 */
+	BluetoothUuidSet() { }
+
+	/**
+	 * @brief Create a set from a list of UUIDs
+	 * @param uuids UUIDs to insert. Invalid UUIDs are skipped.
+	 */
+	BluetoothUuidSet(const BluetoothUuidList &uuids)
+	{
+		for (auto &uuid : uuids)
+			insert(uuid);
+	}
+
+	/**
+	 * @brief Insert a UUID into the set
+	 * @param uuid UUID to insert
+	 * @return True if the UUID was added. False if it is invalid or already part of the set.
+	 */
+	bool insert(const BluetoothUuid &uuid)
+	{
+		uint32_t id = BluetoothUuidPool::intern(uuid);
+		if (id == BluetoothUuidPool::INVALID_ID)
+			return false;
+
+		if (id < BluetoothUuidPool::FIRST_ID)
+		{
+			auto iter = findBlock(id);
+			if (iter == blocks.end() || iter->index != id / 64)
+			{
+				Block block = { static_cast<uint16_t>(id / 64), 0 };
+				iter = blocks.insert(iter, block);
+			}
+
+			uint64_t bit = 1ULL << (id % 64);
+			if (iter->bits & bit)
+				return false;
+
+			iter->bits |= bit;
+			return true;
+		}
+
+		auto iter = std::lower_bound(ids.begin(), ids.end(), id);
+		if (iter != ids.end() && *iter == id)
+			return false;
+
+		ids.insert(iter, id);
+		return true;
+	}
+
+	/**
+	 * @brief Remove a UUID from the set
+	 * @param uuid UUID to remove
+	 * @return True if the UUID was part of the set. False otherwise.
+	 */
+	bool erase(const BluetoothUuid &uuid)
+	{
+		uint32_t id = BluetoothUuidPool::find(uuid);
+		if (id == BluetoothUuidPool::INVALID_ID)
+			return false;
+
+		if (id < BluetoothUuidPool::FIRST_ID)
+		{
+			auto iter = findBlock(id);
+			uint64_t bit = 1ULL << (id % 64);
+
+			if (iter == blocks.end() || iter->index != id / 64 || !(iter->bits & bit))
+				return false;
+
+			iter->bits &= ~bit;
+			if (!iter->bits)
+				blocks.erase(iter);
+
+			return true;
+		}
+
+		auto iter = std::lower_bound(ids.begin(), ids.end(), id);
+		if (iter == ids.end() || *iter != id)
+			return false;
+
+		ids.erase(iter);
+		return true;
+	}
+
+	/**
+	 * @brief Check if a UUID is part of the set
+	 * @param uuid UUID to check for
+	 * @return True if the UUID is part of the set. False otherwise.
+	 */
+	bool contains(const BluetoothUuid &uuid) const
+	{
+		uint32_t id = BluetoothUuidPool::find(uuid);
+		if (id == BluetoothUuidPool::INVALID_ID)
+			return false;
+
+		if (id < BluetoothUuidPool::FIRST_ID)
+		{
+			auto iter = findBlock(id);
+			return iter != blocks.end() && iter->index == id / 64 && (iter->bits & (1ULL << (id % 64)));
+		}
+
+		return std::binary_search(ids.begin(), ids.end(), id);
+	}
+
+	/**
+	 * @brief Retrieve the number of UUIDs in the set
+	 * @return Number of UUIDs
+	 */
+	size_t size() const
+	{
+		size_t count = ids.size();
+		for (auto &block : blocks)
+			count += __builtin_popcountll(block.bits);
+		return count;
+	}
+
+	/**
+	 * @brief Check if the set is empty
+	 * @return True if the set doesn't contain any UUID. False otherwise.
+	 */
+	bool empty() const { return blocks.empty() && ids.empty(); }
+
+	/**
+	 * @brief Remove all UUIDs from the set
+	 */
+	void clear()
+	{
+		blocks.clear();
+		ids.clear();
+	}
+
+	/**
+	 * @brief Convert the set into a list of UUIDs
+	 * @return List of all UUIDs; 16 bit UUIDs first, sorted by value.
+	 */
+	BluetoothUuidList toList() const
+	{
+		BluetoothUuidList result;
+		result.reserve(size());
+
+		for (auto &block : blocks)
+		{
+			for (unsigned int bit = 0; bit < 64; bit++)
+			{
+				if (block.bits & (1ULL << bit))
+					result.push_back(BluetoothUuid::fromUInt16(static_cast<uint16_t>(block.index * 64 + bit)));
+			}
+		}
+
+		for (auto id : ids)
+			result.push_back(BluetoothUuidPool::lookup(id));
+
+		return result;
+	}
+
+	/**
+	 * @brief Operator implementation to support set comparison
+	 * @param rhs Right-hand side object to compare
+	 * @return True if both sets contain the same UUIDs.
+	 */
+	bool operator ==(const BluetoothUuidSet &rhs) const
+	{
+		if (blocks.size() != rhs.blocks.size() || ids != rhs.ids)
+			return false;
+
+		for (size_t n = 0; n < blocks.size(); n++)
+		{
+			if (blocks[n].index != rhs.blocks[n].index || blocks[n].bits != rhs.blocks[n].bits)
+				return false;
+		}
+
+		return true;
+	}
+
+	/**
+	 * @brief Operator implementation to support set comparison
+	 * @param rhs Right-hand side object to compare
+	 * @return True if the sets differ.
+	 */
+	bool operator !=(const BluetoothUuidSet &rhs) const { return !(*this == rhs); }
+
+private:
+	struct Block
+	{
+		uint16_t index;
+		uint64_t bits;
+	};
+
+	std::vector<Block>::iterator findBlock(uint32_t id)
+	{
+		return std::lower_bound(blocks.begin(), blocks.end(), id / 64,
+		                        [](const Block &block, uint32_t index) { return block.index < index; });
+	}
+
+	std::vector<Block>::const_iterator findBlock(uint32_t id) const
+	{
+		return std::lower_bound(blocks.begin(), blocks.end(), id / 64,
+		                        [](const Block &block, uint32_t index) { return block.index < index; });
+	}
+
+private:
+	std::vector<Block> blocks;
+	std::vector<uint32_t> ids;
+};
+
 #endif // BLUETOOTH_SIL_UUID_H_
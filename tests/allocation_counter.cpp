@@ -0,0 +1,48 @@
+// Copyright (c) 2026 LG Electronics, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include <cstdlib>
+#include <new>
+
+#include "allocation_counter.h"
+
+/*
+ * Kept in a translation unit of its own so the compiler never sees the
+ * replacements inlined next to the standard library's own delete calls.
+ */
+
+size_t allocations = 0;
+
+void* operator new(size_t size)
+{
+	allocations++;
+
+	void *memory = std::malloc(size ? size : 1);
+	if (!memory)
+		throw std::bad_alloc();
+
+	return memory;
+}
+
+void operator delete(void *memory) noexcept
+{
+	std::free(memory);
+}
+
+void operator delete(void *memory, size_t) noexcept
+{
+	std::free(memory);
+}
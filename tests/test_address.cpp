@@ -0,0 +1,142 @@
+// Copyright (c) 2026 LG Electronics, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include <glib.h>
+
+#include <cstring>
+#include <map>
+#include <type_traits>
+#include <unordered_map>
+
+#include "bluetooth-sil-api.h"
+
+static_assert(std::is_trivially_copyable<BluetoothAddress>::value, "BluetoothAddress must be trivially copyable");
+static_assert(sizeof(BluetoothAddress) == sizeof(uint64_t), "BluetoothAddress must be packed into 64 bits");
+
+static void test_address_parse(void)
+{
+	BluetoothAddress address("AA:bb:CC:dd:EE:0f");
+	g_assert(address.isValid());
+	g_assert(address.toUInt64() == 0xaabbccddee0fULL);
+	g_assert(address.toString() == "aa:bb:cc:dd:ee:0f");
+
+	char buffer[18];
+	address.format(buffer);
+	g_assert(strcmp(buffer, "aa:bb:cc:dd:ee:0f") == 0);
+
+	g_assert(BluetoothAddress("00:00:00:00:00:00").isValid());
+	g_assert(BluetoothAddress("ff:ff:ff:ff:ff:ff").toUInt64() == 0xffffffffffffULL);
+
+	const char *invalid[] = {
+		"", "00:11:22:33:44", "00:11:22:33:44:55:", "00-11-22-33-44-55", "0g:11:22:33:44:55",
+		"00:11:22:33:44:5", " 00:11:22:33:44:5", "00:11:22:33:44::5"
+	};
+	for (const char *text : invalid)
+		g_assert(!BluetoothAddress(text).isValid());
+
+	g_assert(!BluetoothAddress().isValid());
+	g_assert(BluetoothAddress().toString().empty());
+
+	// A failed parse leaves the result untouched
+	BluetoothAddress result(0x1234);
+	g_assert(!BluetoothAddress::parse("invalid", result));
+	g_assert(result == BluetoothAddress(0x1234));
+	g_assert(BluetoothAddress::parse("00:00:00:00:12:35", result));
+	g_assert(result == BluetoothAddress(0x1235));
+
+	// Upper bits of the packed form are dropped
+	g_assert(BluetoothAddress(0xffff001122334455ULL) == BluetoothAddress("00:11:22:33:44:55"));
+
+	const uint8_t hci[] = { 0x55, 0x44, 0x33, 0x22, 0x11, 0x00 };
+	g_assert(BluetoothAddress::fromLittleEndian(hci) == BluetoothAddress("00:11:22:33:44:55"));
+}
+
+static void test_address_containers(void)
+{
+	BluetoothAddress low("00:11:22:33:44:55");
+	BluetoothAddress high("aa:11:22:33:44:55");
+
+	g_assert(low < high && high > low && low <= low && high >= high && low != high);
+
+	std::map<BluetoothAddress, int> ordered;
+	ordered[high] = 2;
+	ordered[low] = 1;
+	g_assert(ordered.begin()->first == low);
+
+	std::unordered_map<BluetoothAddress, int> unordered;
+	for (uint64_t n = 0; n < 1000; n++)
+		unordered[BluetoothAddress(0x001122330000ULL + n)] = n;
+
+	g_assert(unordered.size() == 1000);
+	g_assert(unordered[BluetoothAddress("00:11:22:33:01:00")] == 256);
+	g_assert(std::hash<BluetoothAddress>()(low) != std::hash<BluetoothAddress>()(high));
+}
+
+static void test_address_lookup_throughput(void)
+{
+	if (!g_test_perf())
+		return;
+
+	const int deviceCount = 2048;
+	const int iterations = 4000000;
+	std::unordered_map<std::string, int> byString;
+	std::unordered_map<BluetoothAddress, int> byAddress;
+	std::vector<std::string> strings;
+	std::vector<BluetoothAddress> addresses;
+
+	for (int n = 0; n < deviceCount; n++)
+	{
+		BluetoothAddress address(0xc01122000000ULL + n * 7919);
+		strings.push_back(address.toString());
+		addresses.push_back(address);
+		byString[strings.back()] = n;
+		byAddress[address] = n;
+	}
+
+	long sum = 0;
+
+	g_test_timer_start();
+	for (int n = 0; n < iterations; n++)
+		sum += byString.find(strings[n % deviceCount])->second;
+	double stringElapsed = g_test_timer_elapsed();
+
+	g_test_timer_start();
+	for (int n = 0; n < iterations; n++)
+		sum -= byAddress.find(addresses[n % deviceCount])->second;
+	double addressElapsed = g_test_timer_elapsed();
+
+	g_test_timer_start();
+	for (int n = 0; n < iterations; n++)
+		sum += BluetoothAddress(strings[n % deviceCount]).toUInt64() & 1;
+	double parseElapsed = g_test_timer_elapsed();
+
+	g_assert(sum >= 0);
+
+	g_test_maximized_result(iterations / stringElapsed, "%.0f lookups/s keyed by string", iterations / stringElapsed);
+	g_test_maximized_result(iterations / addressElapsed, "%.0f lookups/s keyed by BluetoothAddress", iterations / addressElapsed);
+	g_test_maximized_result(iterations / parseElapsed, "%.0f addresses parsed/s", iterations / parseElapsed);
+}
+
+int main(int argc, char **argv)
+{
+	g_test_init(&argc, &argv, nullptr);
+
+	g_test_add_func("/address/parse", test_address_parse);
+	g_test_add_func("/address/containers", test_address_containers);
+	g_test_add_func("/address/lookup-throughput", test_address_lookup_throughput);
+
+	return g_test_run();
+}
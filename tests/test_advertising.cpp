@@ -0,0 +1,231 @@
+// Copyright (c) 2026 LG Electronics, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include <glib.h>
+
+#include <cstring>
+
+#include "bluetooth-sil-api.h"
+
+// Advertising data of a heart rate sensor followed by padding
+static const uint8_t scanRecord[] = {
+	0x02, 0x01, 0x06,                                     // Flags
+	0x05, 0x03, 0x0d, 0x18, 0x0f, 0x18,                   // Complete list of 16 bit UUIDs
+	0x11, 0x06, 0xfb, 0x34, 0x9b, 0x5f, 0x80, 0x00,       // Incomplete list of 128 bit UUIDs
+	      0x00, 0x80, 0x00, 0x10, 0x00, 0x00, 0xaa, 0xbb, 0x00, 0x00,
+	0x05, 0x08, 'H', 'R', 'M', '1',                       // Shortened local name
+	0x02, 0x0a, 0xf4,                                     // TX power level -12 dBm
+	0x04, 0x16, 0x0f, 0x18, 0x55,                         // Service data of the battery service
+	0x05, 0xff, 0xc4, 0x00, 0x01, 0x02,                   // Manufacturer data of LG Electronics
+	0x00, 0x00, 0x00
+};
+
+static void test_advertising_parse(void)
+{
+	AdvertisingDataView view(BluetoothByteSpan(scanRecord, sizeof(scanRecord)));
+
+	g_assert(view.isValid());
+
+	int count = 0;
+	for (auto &structure : view)
+	{
+		g_assert(structure.data.begin() >= scanRecord);
+		g_assert(structure.data.end() <= scanRecord + sizeof(scanRecord));
+		count++;
+	}
+	g_assert(count == 7);
+
+	uint8_t flags = 0;
+	g_assert(view.getFlags(flags));
+	g_assert(flags == 0x06);
+
+	int8_t txPower = 0;
+	g_assert(view.getTxPower(txPower));
+	g_assert(txPower == -12);
+
+	BluetoothByteSpan name;
+	bool complete = true;
+	g_assert(view.getLocalName(name, &complete));
+	g_assert(!complete);
+	g_assert(name.size() == 4);
+	g_assert(memcmp(name.data(), "HRM1", 4) == 0);
+
+	AdvertisingDataView::UuidList uuids16 = view.getServiceUuids(2);
+	g_assert(uuids16.size() == 2);
+	g_assert(uuids16.isComplete());
+	g_assert(uuids16[0] == BluetoothUuid::fromUInt16(0x180d));
+	g_assert(uuids16[1] == BluetoothUuid("180f"));
+	g_assert(view.getServiceUuids(4).empty());
+
+	AdvertisingDataView::UuidList uuids128 = view.getServiceUuids(16);
+	g_assert(uuids128.size() == 1);
+	g_assert(!uuids128.isComplete());
+	g_assert(uuids128[0].toString() == "0000bbaa-0000-1000-8000-00805f9b34fb");
+
+	g_assert(view.hasServiceUuid(BluetoothUuid("180d")));
+	g_assert(view.hasServiceUuid(BluetoothUuid::fromUInt16(0xbbaa)));
+	g_assert(!view.hasServiceUuid(BluetoothUuid::fromUInt16(0x1800)));
+
+	BluetoothByteSpan serviceData;
+	g_assert(view.findServiceData(BluetoothUuid::fromUInt16(0x180f), serviceData));
+	g_assert(serviceData.size() == 1 && serviceData[0] == 0x55);
+	g_assert(!view.findServiceData(BluetoothUuid::fromUInt16(0x180d), serviceData));
+
+	AdvertisingDataView::ManufacturerData manufacturerData;
+	g_assert(view.getManufacturerData(manufacturerData));
+	g_assert(manufacturerData.companyId == 0x00c4);
+	g_assert(manufacturerData.data.toVector() == std::vector<uint8_t>({ 0x01, 0x02 }));
+}
+
+static void test_advertising_malformed(void)
+{
+	// Truncated structure: the length exceeds the buffer
+	const uint8_t truncated[] = { 0x02, 0x01, 0x06, 0x05, 0x09, 'a', 'b' };
+	AdvertisingDataView view(BluetoothByteSpan(truncated, sizeof(truncated)));
+
+	g_assert(!view.isValid());
+	uint8_t flags = 0;
+	g_assert(view.getFlags(flags));
+	BluetoothByteSpan name;
+	g_assert(!view.getLocalName(name));
+
+	// Garbage after the padding
+	const uint8_t garbage[] = { 0x02, 0x01, 0x06, 0x00, 0x01 };
+	g_assert(!AdvertisingDataView(BluetoothByteSpan(garbage, sizeof(garbage))).isValid());
+
+	// Structures which are too short for their type
+	const uint8_t tooShort[] = { 0x01, 0x01, 0x01, 0x0a, 0x02, 0x16, 0x0f, 0x02, 0xff, 0xc4, 0x02, 0x03, 0x0d };
+	AdvertisingDataView shortView(BluetoothByteSpan(tooShort, sizeof(tooShort)));
+	int8_t txPower = 0;
+	AdvertisingDataView::ManufacturerData manufacturerData;
+	BluetoothByteSpan serviceData;
+
+	g_assert(shortView.isValid());
+	g_assert(!shortView.getFlags(flags));
+	g_assert(!shortView.getTxPower(txPower));
+	g_assert(!shortView.findServiceData(BluetoothUuid::fromUInt16(0x180f), serviceData));
+	g_assert(!shortView.getManufacturerData(manufacturerData));
+	g_assert(shortView.getServiceUuids(2).empty());
+
+	AdvertisingDataView empty((BluetoothByteSpan()));
+	g_assert(empty.isValid());
+	g_assert(empty.begin() == empty.end());
+}
+
+static void test_advertising_fuzz(void)
+{
+	GRand *rand = g_rand_new_with_seed(0x5ca7);
+	uint8_t buffer[64];
+
+	for (int round = 0; round < 20000; round++)
+	{
+		size_t size = g_rand_int_range(rand, 0, sizeof(buffer) + 1);
+		for (size_t n = 0; n < size; n++)
+		{
+			// Bias towards small lengths and known types to get deep into the parser
+			buffer[n] = g_rand_boolean(rand) ? g_rand_int_range(rand, 0, 24) : g_rand_int_range(rand, 0, 256);
+		}
+
+		// Copy into an exactly sized heap buffer so overreads get noticed by sanitizers
+		std::vector<uint8_t> data(buffer, buffer + size);
+		AdvertisingDataView view(data);
+
+		size_t consumed = 0;
+		for (auto &structure : view)
+		{
+			g_assert(structure.data.begin() >= data.data() + 2);
+			g_assert(structure.data.end() <= data.data() + data.size());
+			consumed += structure.data.size() + 2;
+
+			AdvertisingDataView::ServiceData serviceData;
+			if (AdvertisingDataView::parseServiceData(structure, serviceData))
+				g_assert(serviceData.data.end() == structure.data.end());
+		}
+		g_assert(consumed <= size);
+
+		if (view.isValid())
+		{
+			for (size_t n = consumed; n < size; n++)
+				g_assert(data[n] == 0);
+		}
+
+		uint8_t flags;
+		int8_t txPower;
+		BluetoothByteSpan span;
+		AdvertisingDataView::ManufacturerData manufacturerData;
+		view.getFlags(flags);
+		view.getTxPower(txPower);
+		view.getLocalName(span);
+		view.getManufacturerData(manufacturerData);
+		view.findServiceData(BluetoothUuid::fromUInt16(0x180f), span);
+		view.hasServiceUuid(BluetoothUuid::fromUInt16(0x180d));
+
+		const size_t widths[] = { 2, 4, 16 };
+		for (size_t width : widths)
+		{
+			AdvertisingDataView::UuidList uuids = view.getServiceUuids(width);
+			for (size_t n = 0; n < uuids.size(); n++)
+				g_assert(uuids[n].isValid());
+		}
+	}
+
+	g_rand_free(rand);
+}
+
+static void test_advertising_parse_throughput(void)
+{
+	if (!g_test_perf())
+		return;
+
+	const int iterations = 2000000;
+	AdvertisingDataView view(BluetoothByteSpan(scanRecord, sizeof(scanRecord)));
+	size_t sum = 0;
+
+	g_test_timer_start();
+
+	for (int n = 0; n < iterations; n++)
+	{
+		uint8_t flags = 0;
+		int8_t txPower = 0;
+		BluetoothByteSpan name;
+		AdvertisingDataView::ManufacturerData manufacturerData;
+
+		view.getFlags(flags);
+		view.getTxPower(txPower);
+		view.getLocalName(name);
+		if (view.getManufacturerData(manufacturerData))
+			sum += manufacturerData.companyId;
+		sum += flags + txPower + name.size() + view.hasServiceUuid(BluetoothUuid::fromUInt16(0x180f));
+	}
+
+	double elapsed = g_test_timer_elapsed();
+	g_assert(sum != 0);
+
+	g_test_minimized_result(elapsed, "parsed %d scan records in %.3f s", iterations, elapsed);
+	g_test_maximized_result(iterations / elapsed, "%.0f scan records/s", iterations / elapsed);
+}
+
+int main(int argc, char **argv)
+{
+	g_test_init(&argc, &argv, nullptr);
+
+	g_test_add_func("/advertising/parse", test_advertising_parse);
+	g_test_add_func("/advertising/malformed", test_advertising_malformed);
+	g_test_add_func("/advertising/fuzz", test_advertising_fuzz);
+	g_test_add_func("/advertising/parse-throughput", test_advertising_parse_throughput);
+
+	return g_test_run();
+}
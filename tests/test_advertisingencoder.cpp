@@ -0,0 +1,267 @@
+// Copyright (c) 2026 LG Electronics, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+
+#include <glib.h>
+
+#include "bluetooth-sil-api.h"
+
+typedef std::vector<uint8_t> ByteList;
+
+static AdvertiseData createData()
+{
+	AdvertiseData data = AdvertiseData();
+
+	data.includeTxPower = true;
+	data.includeName = true;
+	data.manufacturerData = { 0x4c, 0x00, 0x02, 0x15 };
+	data.services["180f"] = BluetoothLowEnergyData();
+	data.services["0000fe95-0000-1000-8000-00805f9b34fb"] = { 0x01, 0x02 };
+
+	return data;
+}
+
+static void test_advertisingencoder_encode(void)
+{
+	AdvertiseData data = createData();
+	AdvertisingDataEncoder::Parameters parameters;
+	parameters.localName = "Speaker";
+	parameters.txPower = -8;
+	parameters.flags = 0x06;
+
+	ByteList pdu;
+	g_assert(AdvertisingDataEncoder::encode(data, parameters, pdu) == BLUETOOTH_ERROR_NONE);
+	g_assert(pdu.size() <= AdvertisingDataEncoder::LEGACY_MAX_LENGTH);
+
+	AdvertisingDataView view(pdu);
+	g_assert(view.isValid());
+
+	uint8_t flags;
+	g_assert(view.getFlags(flags) && flags == 0x06);
+
+	int8_t txPower;
+	g_assert(view.getTxPower(txPower) && txPower == -8);
+
+	AdvertisingDataView::UuidList uuids = view.getServiceUuids(2);
+	g_assert(uuids.size() == 1 && uuids.isComplete());
+	g_assert(uuids[0] == BluetoothUuid("180f"));
+	g_assert(view.getServiceUuids(16).size() == 0);
+
+	BluetoothByteSpan serviceData;
+	g_assert(view.findServiceData(BluetoothUuid("fe95"), serviceData));
+	g_assert(serviceData.size() == 2 && serviceData[0] == 0x01 && serviceData[1] == 0x02);
+
+	AdvertisingDataView::ManufacturerData manufacturerData;
+	g_assert(view.getManufacturerData(manufacturerData));
+	g_assert(manufacturerData.companyId == 0x004c && manufacturerData.data.size() == 2);
+
+	BluetoothByteSpan name;
+	bool complete = false;
+	g_assert(view.getLocalName(name, &complete) && complete);
+	g_assert(std::string(reinterpret_cast<const char*>(name.data()), name.size()) == "Speaker");
+
+	// 128 bit UUIDs are written in little endian byte order
+	AdvertiseData custom = AdvertiseData();
+	custom.services["12345678-9abc-def0-1234-56789abcdef0"] = BluetoothLowEnergyData();
+	g_assert(AdvertisingDataEncoder::encode(custom, AdvertisingDataEncoder::Parameters(), pdu) == BLUETOOTH_ERROR_NONE);
+	g_assert(pdu.size() == 18 && pdu[0] == 17 && pdu[1] == AdvertisingDataView::COMPLETE_UUID128_LIST);
+	g_assert(pdu[2] == 0xf0 && pdu[17] == 0x12);
+	g_assert(AdvertisingDataView(pdu).getServiceUuids(16)[0] == BluetoothUuid("12345678-9abc-def0-1234-56789abcdef0"));
+
+	// The order of the services doesn't change the payload
+	AdvertiseData reordered = AdvertiseData();
+	ByteList first, second;
+	for (int n = 0; n < 4; n++)
+		reordered.services[BluetoothUuid::fromUInt16(0x1800 + n).toString()] = BluetoothLowEnergyData();
+	g_assert(AdvertisingDataEncoder::encode(reordered, parameters, first) == BLUETOOTH_ERROR_NONE);
+	reordered.services.rehash(64);
+	g_assert(AdvertisingDataEncoder::encode(reordered, parameters, second) == BLUETOOTH_ERROR_NONE);
+	g_assert(first == second);
+}
+
+static void test_advertisingencoder_limits(void)
+{
+	AdvertiseData data = createData();
+	AdvertisingDataEncoder::Parameters parameters;
+	parameters.flags = 0x06;
+	parameters.localName = "A name which is too long for a legacy advertisement";
+
+	// The name is shortened to the remaining space
+	ByteList pdu;
+	g_assert(AdvertisingDataEncoder::encode(data, parameters, pdu) == BLUETOOTH_ERROR_NONE);
+	g_assert(pdu.size() == AdvertisingDataEncoder::LEGACY_MAX_LENGTH);
+
+	BluetoothByteSpan name;
+	bool complete = true;
+	g_assert(AdvertisingDataView(pdu).getLocalName(name, &complete) && !complete);
+
+	// Extended advertising has room for the complete name
+	parameters.maxLength = AdvertisingDataEncoder::EXTENDED_MAX_LENGTH;
+	g_assert(AdvertisingDataEncoder::encode(data, parameters, pdu) == BLUETOOTH_ERROR_NONE);
+	g_assert(AdvertisingDataView(pdu).getLocalName(name, &complete) && complete);
+	g_assert(name.size() == parameters.localName.size());
+
+	// Data which doesn't fit is rejected
+	parameters.maxLength = AdvertisingDataEncoder::LEGACY_MAX_LENGTH;
+	data.includeName = false;
+	data.manufacturerData.assign(30, 0xaa);
+	g_assert(AdvertisingDataEncoder::encode(data, parameters, pdu) == BLUETOOTH_ERROR_PARAM_INVALID);
+
+	parameters.maxLength = AdvertisingDataEncoder::EXTENDED_MAX_LENGTH;
+	g_assert(AdvertisingDataEncoder::encode(data, parameters, pdu) == BLUETOOTH_ERROR_NONE);
+
+	data.manufacturerData.assign(255, 0xaa);
+	g_assert(AdvertisingDataEncoder::encode(data, parameters, pdu) == BLUETOOTH_ERROR_PARAM_INVALID);
+
+	// UUID lists longer than a single AD structure are split
+	AdvertiseData uuids = AdvertiseData();
+	for (int n = 0; n < 20; n++)
+	{
+		char uuid[40];
+		snprintf(uuid, sizeof(uuid), "%08x-0000-1000-8000-00805f9b34fc", n);
+		uuids.services[uuid] = BluetoothLowEnergyData();
+	}
+
+	g_assert(AdvertisingDataEncoder::encode(uuids, parameters, pdu) == BLUETOOTH_ERROR_NONE);
+
+	int lists = 0;
+	size_t count = 0;
+	for (auto &structure : AdvertisingDataView(pdu))
+	{
+		if (structure.type != AdvertisingDataView::COMPLETE_UUID128_LIST)
+			continue;
+
+		g_assert(structure.data.size() % 16 == 0);
+		count += structure.data.size() / 16;
+		lists++;
+	}
+
+	g_assert(lists == 2);
+	g_assert(count == 20);
+	for (auto &service : uuids.services)
+		g_assert(AdvertisingDataView(pdu).hasServiceUuid(BluetoothUuid(service.first)));
+
+	AdvertiseData invalid = AdvertiseData();
+	invalid.services["not a uuid"] = BluetoothLowEnergyData();
+	g_assert(AdvertisingDataEncoder::encode(invalid, parameters, pdu) == BLUETOOTH_ERROR_PARAM_INVALID);
+}
+
+static void test_advertisingencoder_cache(void)
+{
+	AdvertisingDataEncoder encoder(2);
+	AdvertisingDataEncoder::Parameters parameters;
+	parameters.localName = "Speaker";
+
+	AdvertiseData first = createData();
+	AdvertiseData second = createData();
+	second.manufacturerData.push_back(0x01);
+	AdvertiseData third = createData();
+	third.includeTxPower = false;
+
+	g_assert(AdvertisingDataEncoder::hash(first, parameters) != AdvertisingDataEncoder::hash(second, parameters));
+
+	AdvertisingPduPtr pdu, cached;
+	g_assert(encoder.getPdu(first, parameters, pdu) == BLUETOOTH_ERROR_NONE);
+	g_assert(encoder.getPdu(createData(), parameters, cached) == BLUETOOTH_ERROR_NONE);
+	g_assert(pdu == cached);
+	g_assert(encoder.getCacheHits() == 1 && encoder.getCacheMisses() == 1);
+
+	ByteList expected;
+	AdvertisingDataEncoder::encode(first, parameters, expected);
+	g_assert(*pdu == expected);
+
+	// Different parameters produce a different payload
+	AdvertisingDataEncoder::Parameters renamed = parameters;
+	renamed.localName = "Headset";
+	g_assert(encoder.getPdu(first, renamed, cached) == BLUETOOTH_ERROR_NONE);
+	g_assert(pdu != cached && *pdu != *cached);
+
+	// Rotating between payloads which fit into the cache doesn't encode again
+	encoder.clear();
+	for (int n = 0; n < 10; n++)
+		encoder.getPdu(n % 2 ? first : second, parameters, cached);
+	g_assert(encoder.getCacheMisses() == 2 && encoder.getCacheHits() == 8);
+
+	// The least recently used payload is dropped
+	encoder.getPdu(third, parameters, cached);
+	encoder.getPdu(first, parameters, cached);
+	encoder.getPdu(second, parameters, cached);
+	g_assert(encoder.getCacheMisses() == 4 && encoder.getCacheHits() == 9);
+
+	// Errors aren't cached
+	AdvertiseData invalid = AdvertiseData();
+	invalid.manufacturerData.assign(40, 0);
+	g_assert(encoder.getPdu(invalid, parameters, cached) == BLUETOOTH_ERROR_PARAM_INVALID);
+	g_assert(encoder.getPdu(invalid, parameters, cached) == BLUETOOTH_ERROR_PARAM_INVALID);
+	g_assert(encoder.getCacheMisses() == 6);
+}
+
+static void test_advertisingencoder_throughput(void)
+{
+	if (!g_test_perf())
+		return;
+
+	const int iterations = 500000;
+	AdvertisingDataEncoder encoder;
+	AdvertisingDataEncoder::Parameters parameters;
+	parameters.localName = "Speaker";
+	parameters.flags = 0x06;
+
+	std::vector<AdvertiseData> rotation;
+	for (int n = 0; n < 4; n++)
+	{
+		rotation.push_back(createData());
+		rotation.back().manufacturerData.push_back(n);
+	}
+
+	size_t total = 0;
+	ByteList pdu;
+
+	g_test_timer_start();
+	for (int n = 0; n < iterations; n++)
+	{
+		AdvertisingDataEncoder::encode(rotation[n % rotation.size()], parameters, pdu);
+		total += pdu.size();
+	}
+	double encodeElapsed = g_test_timer_elapsed();
+
+	AdvertisingPduPtr cached;
+
+	g_test_timer_start();
+	for (int n = 0; n < iterations; n++)
+	{
+		encoder.getPdu(rotation[n % rotation.size()], parameters, cached);
+		total -= cached->size();
+	}
+	double cacheElapsed = g_test_timer_elapsed();
+
+	g_assert(total == 0);
+
+	g_test_maximized_result(iterations / encodeElapsed, "%.0f payloads/s encoded", iterations / encodeElapsed);
+	g_test_maximized_result(iterations / cacheElapsed, "%.0f payloads/s from cache", iterations / cacheElapsed);
+}
+
+int main(int argc, char **argv)
+{
+	g_test_init(&argc, &argv, nullptr);
+
+	g_test_add_func("/advertisingencoder/encode", test_advertisingencoder_encode);
+	g_test_add_func("/advertisingencoder/limits", test_advertisingencoder_limits);
+	g_test_add_func("/advertisingencoder/cache", test_advertisingencoder_cache);
+	g_test_add_func("/advertisingencoder/throughput", test_advertisingencoder_throughput);
+
+	return g_test_run();
+}
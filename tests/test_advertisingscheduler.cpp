@@ -0,0 +1,305 @@
+// Copyright (c) 2026 LG Electronics, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+
+#include <glib.h>
+
+#include <cmath>
+#include <map>
+
+#include "bluetooth-sil-api.h"
+
+/*
+ * Controller with a single advertising set which sends an advertising event
+ * every interval while enabled.
+ */
+class SimulatedController : public BluetoothAdvertisingController
+{
+public:
+	SimulatedController() : enabled(false), interval(0), nextEvent(0) { }
+
+	void setParameters(const AdvertiseSettings &settings)
+	{
+		g_assert(!enabled);
+		g_assert(settings.minInterval == settings.maxInterval);
+		interval = settings.minInterval;
+	}
+
+	void setData(bool isScanResponse, const AdvertisingPduPtr &pdu)
+	{
+		if (!isScanResponse)
+			data = pdu;
+	}
+
+	void setEnabled(bool value)
+	{
+		g_assert(enabled != value);
+		enabled = value;
+	}
+
+	/*
+	 * Advance the time by a millisecond and return the payload sent in an
+	 * advertising event, if any.
+	 */
+	AdvertisingPduPtr tick(uint64_t now)
+	{
+		if (!enabled || now < nextEvent)
+			return AdvertisingPduPtr();
+
+		nextEvent = now + interval;
+		return data;
+	}
+
+	bool enabled;
+	uint16_t interval;
+	uint64_t nextEvent;
+	AdvertisingPduPtr data;
+};
+
+static AdvertiseSettings createSettings(uint16_t interval, bool connectable = false)
+{
+	AdvertiseSettings settings = AdvertiseSettings();
+	settings.connectable = connectable;
+	settings.minInterval = interval;
+	settings.maxInterval = interval;
+	return settings;
+}
+
+static AdvertiseData createData(uint8_t tag)
+{
+	AdvertiseData data = AdvertiseData();
+	data.manufacturerData = { 0xff, 0xff, tag };
+	return data;
+}
+
+struct Simulation
+{
+	Simulation(BluetoothAdvertisingScheduler &scheduler, SimulatedController &controller) :
+		scheduler(scheduler),
+		controller(controller),
+		now(0),
+		wakeup(0),
+		scheduled(false)
+	{
+	}
+
+	// Call run() like a GMainLoop timer would after every change
+	void changed()
+	{
+		uint32_t delay;
+		scheduled = scheduler.run(now, delay);
+		wakeup = now + delay;
+	}
+
+	void advance(uint64_t duration)
+	{
+		for (uint64_t end = now + duration; now < end; now++)
+		{
+			if (scheduled && now >= wakeup)
+				changed();
+
+			AdvertisingPduPtr pdu = controller.tick(now);
+			if (!pdu)
+				continue;
+
+			std::vector<uint64_t> &times = events[(*pdu)[4]];
+			times.push_back(now);
+		}
+	}
+
+	// Average time between the advertising events of a payload
+	double achievedInterval(uint8_t tag)
+	{
+		std::vector<uint64_t> &times = events[tag];
+		g_assert(times.size() > 1);
+		return static_cast<double>(times.back() - times.front()) / (times.size() - 1);
+	}
+
+	BluetoothAdvertisingScheduler &scheduler;
+	SimulatedController &controller;
+	uint64_t now;
+	uint64_t wakeup;
+	bool scheduled;
+	std::map<uint8_t, std::vector<uint64_t>> events;
+};
+
+static void test_advertisingscheduler_intervals(void)
+{
+	SimulatedController controller;
+	BluetoothAdvertisingScheduler scheduler(&controller, 20);
+	Simulation simulation(scheduler, controller);
+
+	const uint16_t intervals[] = { 100, 100, 200, 400 };
+	uint8_t ids[4];
+
+	for (int n = 0; n < 4; n++)
+	{
+		g_assert(scheduler.registerAdvertiser(ids[n]) == BLUETOOTH_ERROR_NONE);
+		g_assert(scheduler.setParameters(ids[n], createSettings(intervals[n])) == BLUETOOTH_ERROR_NONE);
+		g_assert(scheduler.setData(ids[n], false, createData(n)) == BLUETOOTH_ERROR_NONE);
+	}
+
+	// A single advertiser runs with its own interval without any switching
+	g_assert(scheduler.enable(ids[0], 0, simulation.now) == BLUETOOTH_ERROR_NONE);
+	simulation.changed();
+	g_assert(!simulation.scheduled);
+	g_assert(controller.interval == 100);
+	simulation.advance(10000);
+	g_assert(std::fabs(simulation.achievedInterval(0) - 100) < 1);
+	g_assert(scheduler.getStatistics().parameterUpdates == 1);
+	g_assert(scheduler.getStatistics().dataUpdates == 2);
+
+	// 20/100 + 20/100 + 20/200 + 20/400 = 0.55 of the slots are requested, so
+	// every advertiser achieves at least its interval
+	for (int n = 1; n < 4; n++)
+		scheduler.enable(ids[n], 0, simulation.now);
+	simulation.changed();
+	simulation.events.clear();
+	simulation.advance(60000);
+
+	for (int n = 0; n < 4; n++)
+	{
+		double expected = scheduler.getExpectedInterval(ids[n]);
+		double achieved = simulation.achievedInterval(n);
+
+		g_test_message("advertiser %d: requested %u, expected %.1f, achieved %.1f", n, intervals[n], expected, achieved);
+
+		g_assert(expected <= intervals[n]);
+		g_assert(std::fabs(achieved - expected) < expected * 0.05);
+	}
+
+	// The relative shares follow the requested intervals
+	g_assert(std::fabs(simulation.achievedInterval(3) / simulation.achievedInterval(0) - 4) < 0.2);
+
+	// All advertisers use the same parameters, so rotating only loads payloads
+	const BluetoothAdvertisingScheduler::Statistics &statistics = scheduler.getStatistics();
+	g_assert(statistics.parameterUpdates == 2);
+	g_assert(statistics.enableUpdates == 3);
+
+	// Overbooked advertisers are slowed down proportionally
+	uint8_t extra[8];
+	for (int n = 0; n < 8; n++)
+	{
+		g_assert(scheduler.registerAdvertiser(extra[n]) == BLUETOOTH_ERROR_NONE);
+		scheduler.setParameters(extra[n], createSettings(100));
+		scheduler.setData(extra[n], false, createData(10 + n));
+		scheduler.enable(extra[n], 0, simulation.now);
+	}
+
+	simulation.changed();
+	simulation.events.clear();
+	simulation.advance(60000);
+
+	double expected = scheduler.getExpectedInterval(extra[0]);
+	g_assert(expected > 100);
+	g_assert(std::fabs(simulation.achievedInterval(10) - expected) < expected * 0.05);
+	g_assert(std::fabs(simulation.achievedInterval(0) - expected) < expected * 0.05);
+}
+
+static void test_advertisingscheduler_updates(void)
+{
+	SimulatedController controller;
+	BluetoothAdvertisingScheduler scheduler(&controller, 20);
+	Simulation simulation(scheduler, controller);
+	uint8_t first = 0, second = 0;
+
+	g_assert(scheduler.registerAdvertiser(first) == BLUETOOTH_ERROR_NONE);
+	g_assert(scheduler.registerAdvertiser(second) == BLUETOOTH_ERROR_NONE);
+	g_assert(first != second);
+	g_assert(scheduler.setParameters(0, createSettings(100)) == BLUETOOTH_ERROR_PARAM_INVALID);
+	g_assert(scheduler.enable(200, 0, 0) == BLUETOOTH_ERROR_PARAM_INVALID);
+
+	scheduler.setParameters(first, createSettings(100, true));
+	scheduler.setParameters(second, createSettings(100, false));
+	scheduler.setData(first, false, createData(1));
+	scheduler.setData(second, false, createData(1));
+
+	scheduler.enable(first, 0, 0);
+	scheduler.enable(second, 0, 0);
+	simulation.changed();
+	g_assert(simulation.scheduled);
+	simulation.advance(1000);
+
+	// Different parameters require an update per switch, equal payloads don't
+	const BluetoothAdvertisingScheduler::Statistics &statistics = scheduler.getStatistics();
+	g_assert(statistics.slots == 50);
+	g_assert(statistics.parameterUpdates == 50);
+	g_assert(statistics.dataUpdates == 2);
+
+	// Changing the loaded advertiser is applied immediately
+	uint64_t slots = statistics.slots;
+	uint64_t updates = statistics.parameterUpdates;
+	scheduler.setParameters(second, createSettings(100, true));
+	simulation.changed();
+	simulation.advance(1000);
+	g_assert(statistics.slots == slots + 50);
+	g_assert(statistics.parameterUpdates <= updates + 1);
+
+	// Payloads which don't fit are rejected
+	AdvertiseData large = AdvertiseData();
+	large.manufacturerData.assign(40, 0);
+	g_assert(scheduler.setData(first, false, large) == BLUETOOTH_ERROR_PARAM_INVALID);
+
+	g_assert(scheduler.disable(first) == BLUETOOTH_ERROR_NONE);
+	g_assert(scheduler.unregisterAdvertiser(second) == BLUETOOTH_ERROR_NONE);
+	g_assert(!scheduler.isEnabled(second));
+	simulation.changed();
+	g_assert(!simulation.scheduled);
+	g_assert(!controller.enabled);
+}
+
+static void test_advertisingscheduler_timeout(void)
+{
+	SimulatedController controller;
+	BluetoothAdvertisingScheduler scheduler(&controller, 20);
+	Simulation simulation(scheduler, controller);
+	std::vector<uint8_t> expired;
+	uint8_t first = 0, second = 0;
+
+	scheduler.setTimeoutCallback([&expired](uint8_t advertiserId) {
+		expired.push_back(advertiserId);
+	});
+
+	scheduler.registerAdvertiser(first);
+	scheduler.registerAdvertiser(second);
+	scheduler.setData(first, false, createData(1));
+	scheduler.setData(second, false, createData(2));
+	scheduler.enable(first, 2, 0);
+	scheduler.enable(second, 0, 0);
+	simulation.changed();
+	simulation.advance(1990);
+	g_assert(expired.empty());
+	g_assert(scheduler.getEnabledCount() == 2);
+
+	simulation.advance(20);
+	g_assert(expired == std::vector<uint8_t>({ first }));
+	g_assert(!scheduler.isEnabled(first) && scheduler.isEnabled(second));
+
+	// The remaining advertiser stays loaded without further wakeups
+	g_assert(!simulation.scheduled);
+	g_assert(controller.enabled && (*controller.data)[4] == 2);
+}
+
+int main(int argc, char **argv)
+{
+	g_test_init(&argc, &argv, nullptr);
+
+	g_test_add_func("/advertisingscheduler/intervals", test_advertisingscheduler_intervals);
+	g_test_add_func("/advertisingscheduler/updates", test_advertisingscheduler_updates);
+	g_test_add_func("/advertisingscheduler/timeout", test_advertisingscheduler_timeout);
+
+	return g_test_run();
+}
@@ -0,0 +1,209 @@
+// Copyright (c) 2026 LG Electronics, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include <glib.h>
+
+#include <cstdio>
+
+#include "bluetooth-sil-api.h"
+
+typedef std::vector<std::string> AddressList;
+
+struct Removals
+{
+	BluetoothDeviceTable::RemovedCallback callback()
+	{
+		return [this](const std::string &address, bool le) {
+			if (le)
+				leRemoved.push_back(address);
+			else
+				removed.push_back(address);
+		};
+	}
+
+	AddressList removed;
+	AddressList leRemoved;
+};
+
+static void test_devicetable_eviction(void)
+{
+	BluetoothDeviceTable table(3, 1000);
+	Removals removals;
+	BluetoothDeviceTable::RemovedCallback removed = removals.callback();
+
+	g_assert(table.capacity() == 3);
+	g_assert(table.touch(removed, "00:00:00:00:00:01", true, 0));
+	g_assert(table.touch(removed, "00:00:00:00:00:02", false, 1));
+	g_assert(table.touch(removed, "00:00:00:00:00:03", true, 2));
+	g_assert(!table.touch(removed, "invalid", true, 2));
+	g_assert(table.size() == 3);
+
+	// Seeing a device again makes it the most recently seen one
+	g_assert(!table.touch(removed, "00:00:00:00:00:01", true, 3));
+
+	// The least recently seen device is evicted
+	g_assert(table.touch(removed, "00:00:00:00:00:04", true, 4));
+	g_assert(table.size() == 3);
+	g_assert(removals.removed == AddressList({ "00:00:00:00:00:02" }));
+	g_assert(removals.leRemoved.empty());
+	g_assert(!table.contains("00:00:00:00:00:02"));
+
+	// Addresses are compared independent of the case
+	g_assert(table.touch(removed, "AA:BB:CC:DD:EE:FF", true, 5));
+	g_assert(table.contains("aa:bb:cc:dd:ee:ff"));
+	g_assert(removals.leRemoved == AddressList({ "00:00:00:00:00:03" }));
+
+	BluetoothDeviceTable::Statistics statistics = table.getStatistics();
+	g_assert(statistics.size == 3);
+	g_assert(statistics.capacity == 3);
+	g_assert(statistics.inserted == 5);
+	g_assert(statistics.evicted == 2);
+	g_assert(statistics.expired == 0);
+
+	// Removing doesn't report the device
+	g_assert(table.remove("00:00:00:00:00:04"));
+	g_assert(!table.remove("00:00:00:00:00:04"));
+	g_assert(table.size() == 2);
+	g_assert(removals.leRemoved.size() == 1);
+
+	table.clear();
+	g_assert(table.size() == 0);
+	g_assert(table.getStatistics().inserted == 0);
+	g_assert(table.touch(removed, "00:00:00:00:00:04", true, 6));
+}
+
+static void test_devicetable_aging(void)
+{
+	BluetoothDeviceTable table(16, 1000);
+	Removals removals;
+	BluetoothDeviceTable::RemovedCallback removed = removals.callback();
+
+	table.touch(removed, "00:00:00:00:00:01", true, 0);
+	table.touch(removed, "00:00:00:00:00:02", false, 100);
+	table.touch(removed, "00:00:00:00:00:03", true, 200);
+	table.touch(removed, "00:00:00:00:00:02", true, 500);
+
+	g_assert(table.expire(removed, 999) == 0);
+	g_assert(table.expire(removed, 1200) == 2);
+	g_assert(removals.leRemoved == AddressList({ "00:00:00:00:00:01", "00:00:00:00:00:03" }));
+	g_assert(removals.removed.empty());
+
+	// Devices seen through both transports are removed from both
+	g_assert(table.expire(removed, 1500) == 1);
+	g_assert(removals.removed == AddressList({ "00:00:00:00:00:02" }));
+	g_assert(removals.leRemoved.size() == 3);
+
+	g_assert(table.size() == 0);
+	g_assert(table.getStatistics().expired == 3);
+	g_assert(table.expire(removed, 5000) == 0);
+}
+
+static void test_devicetable_pruning(void)
+{
+	BluetoothDeviceTable table(2, 1000);
+	BluetoothDeviceStateCache states;
+	BluetoothLeScanDeduplicator deduplicator;
+	BluetoothProximityTracker tracker;
+	BluetoothPropertiesDelta delta;
+
+	// What a SIL does when the table drops a device: notifyLeDeviceRemoved()
+	// drops the cached state, the other per device stages are pruned as well
+	BluetoothDeviceTable::RemovedCallback removed = [&](const std::string &address, bool le) {
+		g_assert(le);
+		states.remove(address);
+		deduplicator.remove(address);
+		tracker.remove(address);
+	};
+
+	const AddressList addresses = { "00:00:00:00:00:01", "00:00:00:00:00:02", "00:00:00:00:00:03" };
+	for (size_t n = 0; n < addresses.size(); n++)
+	{
+		BluetoothPropertiesList properties = { BluetoothProperty(BluetoothProperty::Type::RSSI, -60) };
+		table.touch(removed, addresses[n], true, n);
+		tracker.apply(addresses[n], properties);
+		g_assert(deduplicator.shouldReport(addresses[n], properties, n));
+		states.update(addresses[n], properties, delta);
+	}
+
+	// The first device was evicted from the table and all caches
+	g_assert(table.size() == 2);
+	g_assert(states.size() == 2 && deduplicator.size() == 2 && tracker.size() == 2);
+	g_assert(!states.remove(addresses[0]) && !deduplicator.remove(addresses[0]) && !tracker.remove(addresses[0]));
+
+	// So were the expired ones
+	g_assert(table.expire(removed, 5000) == 2);
+	g_assert(states.size() == 0 && deduplicator.size() == 0 && tracker.size() == 0);
+}
+
+static void test_devicetable_random_addresses(void)
+{
+	GRand *rand = g_rand_new_with_seed(0x1e55);
+	BluetoothDeviceTable table(1024, 30000);
+	Removals removals;
+	BluetoothDeviceTable::RemovedCallback removed = removals.callback();
+	std::vector<std::string> addresses;
+
+	// A long session full of LE devices rotating their random addresses
+	const int count = g_test_perf() ? 1000000 : 50000;
+	for (int n = 0; n < 4096; n++)
+	{
+		char address[18];
+		snprintf(address, sizeof(address), "%02x:%02x:%02x:%02x:%02x:%02x",
+		         g_rand_int_range(rand, 0xc0, 0x100), g_rand_int_range(rand, 0, 256), g_rand_int_range(rand, 0, 256),
+		         g_rand_int_range(rand, 0, 256), g_rand_int_range(rand, 0, 256), g_rand_int_range(rand, 0, 256));
+		addresses.push_back(address);
+	}
+
+	g_test_timer_start();
+
+	for (int n = 0; n < count; n++)
+	{
+		// Mostly the same devices with new random ones every now and then
+		size_t device = g_rand_int_range(rand, 0, 8) ? g_rand_int_range(rand, 0, 512) : g_rand_int_range(rand, 0, addresses.size());
+		table.touch(removed, addresses[device], true, n);
+		g_assert(table.size() <= table.capacity());
+
+		if (n % 1000 == 0)
+			table.expire(removed, n);
+	}
+
+	double elapsed = g_test_timer_elapsed();
+	g_rand_free(rand);
+
+	BluetoothDeviceTable::Statistics statistics = table.getStatistics();
+	g_assert(statistics.inserted - statistics.evicted - statistics.expired == statistics.size);
+	g_assert(removals.leRemoved.size() == statistics.evicted + statistics.expired);
+
+	if (g_test_perf())
+	{
+		g_test_message("%zu of %zu entries used, %llu inserted, %llu evicted, %llu expired",
+		               statistics.size, statistics.capacity, (unsigned long long) statistics.inserted,
+		               (unsigned long long) statistics.evicted, (unsigned long long) statistics.expired);
+		g_test_maximized_result(count / elapsed, "%.0f reports/s", count / elapsed);
+	}
+}
+
+int main(int argc, char **argv)
+{
+	g_test_init(&argc, &argv, nullptr);
+
+	g_test_add_func("/devicetable/eviction", test_devicetable_eviction);
+	g_test_add_func("/devicetable/aging", test_devicetable_aging);
+	g_test_add_func("/devicetable/pruning", test_devicetable_pruning);
+	g_test_add_func("/devicetable/random-addresses", test_devicetable_random_addresses);
+
+	return g_test_run();
+}
@@ -0,0 +1,241 @@
+// Copyright (c) 2026 LG Electronics, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include <glib.h>
+
+#include <cstdio>
+
+#include "bluetooth-sil-api.h"
+
+class LegacyObserver : public BluetoothAdapterStatusObserver
+{
+public:
+	void deviceFound(BluetoothPropertiesList properties)
+	{
+		events.push_back("found");
+	}
+
+	void deviceFound(const std::string &address, BluetoothPropertiesList properties)
+	{
+		events.push_back("found " + address);
+	}
+
+	void devicePropertiesChanged(const std::string &address, BluetoothPropertiesList properties)
+	{
+		events.push_back("changed " + address);
+	}
+
+	void leDeviceFound(const std::string &address, BluetoothPropertiesList properties)
+	{
+		events.push_back("le-found " + address);
+	}
+
+	void leDevicePropertiesChanged(const std::string &address, BluetoothPropertiesList properties)
+	{
+		events.push_back("le-changed " + address);
+	}
+
+	void leDeviceRemoved(const std::string &address)
+	{
+		events.push_back("le-removed " + address);
+	}
+
+	std::vector<std::string> events;
+};
+
+class BatchObserver : public BluetoothAdapterStatusObserver
+{
+public:
+	BatchObserver() : batcher(nullptr) { }
+
+	void devicesUpdated(const BluetoothDeviceUpdateList &updates)
+	{
+		batches.push_back(updates);
+
+		// Updates queued while a batch is delivered go into the next one
+		if (batcher)
+		{
+			batcher->leDeviceFound("00:00:00:00:00:99", BluetoothPropertiesList());
+			batcher->flush();
+			batcher = nullptr;
+		}
+	}
+
+	std::vector<BluetoothDeviceUpdateList> batches;
+	BluetoothDeviceUpdateBatcher *batcher;
+};
+
+static BluetoothPropertiesList create_properties(int rssi, const std::string &name)
+{
+	BluetoothPropertiesList properties;
+	properties.push_back(BluetoothProperty(BluetoothProperty::Type::RSSI, rssi));
+	if (!name.empty())
+		properties.push_back(BluetoothProperty(BluetoothProperty::Type::NAME, name));
+	return properties;
+}
+
+typedef std::vector<std::string> EventList;
+
+static void test_deviceupdates_legacy(void)
+{
+	LegacyObserver observer;
+	BluetoothDeviceUpdateBatcher batcher(&observer, 100, 16);
+
+	batcher.deviceFound(create_properties(-50, "a"));
+	batcher.deviceFound("00:00:00:00:00:01", create_properties(-50, "b"));
+	batcher.devicePropertiesChanged("00:00:00:00:00:01", create_properties(-51, ""));
+	batcher.leDeviceFound("00:00:00:00:00:02", create_properties(-60, "c"));
+	batcher.leDevicePropertiesChanged("00:00:00:00:00:02", create_properties(-61, ""));
+	g_assert(batcher.size() == 5);
+	g_assert(observer.events.empty());
+
+	// The default implementation of devicesUpdated calls the single event methods in order
+	batcher.flush();
+	g_assert(batcher.size() == 0);
+	g_assert(observer.events == EventList({ "found", "found 00:00:00:00:00:01", "changed 00:00:00:00:00:01",
+	                                        "le-found 00:00:00:00:00:02", "le-changed 00:00:00:00:00:02" }));
+
+	// Pending updates are delivered before a removal
+	observer.events.clear();
+	batcher.leDevicePropertiesChanged("00:00:00:00:00:02", create_properties(-62, ""));
+	batcher.leDeviceRemoved("00:00:00:00:00:02");
+	g_assert(observer.events == EventList({ "le-changed 00:00:00:00:00:02", "le-removed 00:00:00:00:00:02" }));
+}
+
+static void test_deviceupdates_batching(void)
+{
+	BatchObserver observer;
+	BluetoothDeviceUpdateBatcher batcher(&observer, 250, 4);
+	std::vector<uint32_t> scheduled;
+
+	batcher.setScheduleCallback([&scheduled](uint32_t interval) { scheduled.push_back(interval); });
+
+	// The first update of a batch arms the flush timer
+	batcher.leDeviceFound("00:00:00:00:00:01", create_properties(-50, "a"));
+	g_assert(scheduled == std::vector<uint32_t>({ 250 }));
+	batcher.leDeviceFound("00:00:00:00:00:02", create_properties(-50, "b"));
+	g_assert(scheduled.size() == 1);
+
+	// Property changes of a device are merged within a batch
+	batcher.leDevicePropertiesChanged("00:00:00:00:00:01", create_properties(-55, ""));
+	batcher.leDevicePropertiesChanged("00:00:00:00:00:01", create_properties(-57, "renamed"));
+	g_assert(batcher.size() == 3);
+	g_assert(observer.batches.empty());
+
+	// A full batch is delivered right away
+	batcher.devicePropertiesChanged("00:00:00:00:00:01", create_properties(-40, ""));
+	g_assert(observer.batches.size() == 1);
+	const BluetoothDeviceUpdateList &batch = observer.batches[0];
+	g_assert(batch.size() == 4);
+	g_assert(batch[2].type == BluetoothDeviceUpdate::LE_DEVICE_PROPERTIES_CHANGED);
+	g_assert(batch[2].properties.size() == 2);
+	g_assert(batch[2].properties[0].getValue<int>() == -57);
+	g_assert(batch[2].properties[1].getValue<std::string>() == "renamed");
+	g_assert(batch[3].type == BluetoothDeviceUpdate::DEVICE_PROPERTIES_CHANGED);
+	g_assert(batcher.size() == 0);
+
+	// Changes after a delivered batch start a new one
+	batcher.leDevicePropertiesChanged("00:00:00:00:00:01", create_properties(-58, ""));
+	g_assert(scheduled.size() == 2);
+	observer.batcher = &batcher;
+	batcher.flush();
+	g_assert(observer.batches.size() == 2);
+	g_assert(observer.batches[1].size() == 1);
+	g_assert(batcher.size() == 1);
+	g_assert(scheduled.size() == 3);
+
+	batcher.flush();
+	g_assert(observer.batches.size() == 3);
+	g_assert(observer.batches[2][0].address == "00:00:00:00:00:99");
+
+	// Flushing an empty batcher does nothing
+	batcher.flush();
+	g_assert(observer.batches.size() == 3);
+}
+
+class CountingObserver : public BluetoothAdapterStatusObserver
+{
+public:
+	CountingObserver() : calls(0), updates(0) { }
+
+	void leDevicePropertiesChanged(const std::string &address, BluetoothPropertiesList properties)
+	{
+		calls++;
+		updates++;
+	}
+
+	void devicesUpdated(const BluetoothDeviceUpdateList &batch)
+	{
+		calls++;
+		updates += batch.size();
+	}
+
+	size_t calls;
+	size_t updates;
+};
+
+static void test_deviceupdates_burst(void)
+{
+	if (!g_test_perf())
+		return;
+
+	// An inquiry burst: 100 devices reporting 50 updates each
+	std::vector<std::string> addresses;
+	for (int n = 0; n < 100; n++)
+	{
+		char address[18];
+		snprintf(address, sizeof(address), "00:11:22:33:44:%02x", n);
+		addresses.push_back(address);
+	}
+
+	const int reports = 5000;
+	CountingObserver direct;
+	CountingObserver batched;
+	BluetoothDeviceUpdateBatcher batcher(&batched, 100, 64);
+
+	g_test_timer_start();
+	for (int n = 0; n < reports; n++)
+		direct.leDevicePropertiesChanged(addresses[n % 100], create_properties(-60 - n % 7, ""));
+	double directElapsed = g_test_timer_elapsed();
+
+	g_test_timer_start();
+	for (int n = 0; n < reports; n++)
+	{
+		batcher.leDevicePropertiesChanged(addresses[n % 100], create_properties(-60 - n % 7, ""));
+
+		// Timer firing every 500 reports
+		if (n % 500 == 499)
+			batcher.flush();
+	}
+	batcher.flush();
+	double batchedElapsed = g_test_timer_elapsed();
+
+	g_test_message("direct: %zu callbacks for %zu updates in %.4f s", direct.calls, direct.updates, directElapsed);
+	g_test_message("batched: %zu callbacks for %zu updates in %.4f s", batched.calls, batched.updates, batchedElapsed);
+	g_test_minimized_result(batched.calls, "%zu observer callbacks for %d reports", batched.calls, reports);
+	g_assert(batched.calls < direct.calls / 10);
+}
+
+int main(int argc, char **argv)
+{
+	g_test_init(&argc, &argv, nullptr);
+
+	g_test_add_func("/deviceupdates/legacy", test_deviceupdates_legacy);
+	g_test_add_func("/deviceupdates/batching", test_deviceupdates_batching);
+	g_test_add_func("/deviceupdates/burst", test_deviceupdates_burst);
+
+	return g_test_run();
+}
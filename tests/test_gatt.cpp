@@ -229,6 +229,11 @@ static void test_update_descriptor_value(void)
 
 	characteristic = service.getCharacteristic(BluetoothUuid("5678"));
 	g_assert(characteristic.getDescriptor(BluetoothUuid("1234")).getValue() == BluetoothGattValue( { 0x99, 0x88 }));
+
+	// 128 bit UUIDs based on the Bluetooth base UUID match their short form
+	characteristic = service.getCharacteristic(BluetoothUuid("00005678-0000-1000-8000-00805f9b34fb"));
+	g_assert(characteristic.isValid());
+	g_assert(characteristic.getDescriptor(BluetoothUuid("00001234-0000-1000-8000-00805f9b34fb")).getValue() == BluetoothGattValue( { 0x99, 0x88 }));
 }
 
 static void test_descriptor_permissions(void)
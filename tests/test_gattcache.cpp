@@ -0,0 +1,243 @@
+// Copyright (c) 2026 LG Electronics, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+
+#include <glib.h>
+
+#include <unistd.h>
+
+#include "bluetooth-sil-api.h"
+
+static BluetoothGattService createService(uint16_t uuid, int characteristicCount, uint16_t firstHandle)
+{
+	BluetoothGattService service(BluetoothGattService::PRIMARY, BluetoothUuid::fromUInt16(uuid));
+	uint16_t handle = firstHandle;
+
+	for (int n = 0; n < characteristicCount; n++)
+	{
+		BluetoothGattCharacteristic characteristic;
+		characteristic.setUuid(BluetoothUuid::fromUInt16(0x2a00 + n));
+		characteristic.setProperties(BluetoothGattCharacteristic::PROPERTY_READ | BluetoothGattCharacteristic::PROPERTY_INDICATE);
+		characteristic.setPermissions(PERMISSION_READ);
+		characteristic.setWriteType(NO_RESPONSE);
+		characteristic.setValue({ static_cast<uint8_t>(n), 0x42 });
+		characteristic.setHandle(handle++);
+
+		BluetoothGattDescriptor descriptor;
+		descriptor.setUuid(BluetoothUuid::fromUInt16(0x2902));
+		descriptor.setPermissions(PERMISSION_READ | PERMISSION_WRITE);
+		descriptor.setHandle(handle++);
+		characteristic.addDescriptor(descriptor);
+
+		service.addCharacteristic(characteristic);
+	}
+
+	return service;
+}
+
+static void createDatabase(BluetoothGattDatabase &db, int serviceCount)
+{
+	for (int n = 0; n < serviceCount; n++)
+		g_assert(db.addService(createService(0x1800 + n, 4, 0x10 + n * 0x10)).isValid());
+}
+
+static std::string createPath()
+{
+	return std::string(g_get_tmp_dir()) + "/test_gattcache-" + std::to_string(getpid());
+}
+
+static void test_gattcache_serialize(void)
+{
+	BluetoothGattDatabase db;
+	createDatabase(db, 3);
+
+	BluetoothGattService custom(BluetoothGattService::SECONDARY, BluetoothUuid("12345678-9abc-def0-1234-56789abcdef0"));
+	custom.includeService(BluetoothUuid::fromUInt16(0x1800));
+	g_assert(db.addService(custom).isValid());
+
+	std::vector<uint8_t> data;
+	g_assert(db.serialize(data));
+
+	BluetoothGattDatabase loaded;
+	g_assert(loaded.deserialize(data.data(), data.size()));
+	g_assert(loaded.size() == db.size());
+	g_assert(loaded.getServiceCount() == 4);
+
+	BluetoothGattServiceList original = db.toServices();
+	BluetoothGattServiceList restored = loaded.toServices();
+
+	for (size_t n = 0; n < original.size(); n++)
+	{
+		g_assert(restored[n].getUuid() == original[n].getUuid());
+		g_assert(restored[n].getUuid().toString() == original[n].getUuid().toString());
+		g_assert(restored[n].getType() == original[n].getType());
+		g_assert(restored[n].getIncludedServices() == original[n].getIncludedServices());
+		g_assert(restored[n].getCharacteristics().size() == original[n].getCharacteristics().size());
+	}
+
+	BluetoothGattDatabase::Characteristic characteristic = loaded.findCharacteristic(0x22);
+	g_assert(characteristic.getUuid() == BluetoothUuid::fromUInt16(0x2a01));
+	g_assert(characteristic.getValue() == BluetoothGattValue({ 0x01, 0x42 }));
+	g_assert(characteristic.getWriteType() == NO_RESPONSE);
+	g_assert(characteristic.getPermissions() == PERMISSION_READ);
+	g_assert(characteristic.getDescriptor(0).getPermissions() == (PERMISSION_READ | PERMISSION_WRITE));
+	g_assert(loaded.findService(custom.getUuid()).getType() == BluetoothGattService::SECONDARY);
+
+	// Truncated data is rejected at every position
+	for (size_t size = 0; size < data.size(); size++)
+	{
+		BluetoothGattDatabase truncated;
+		g_assert(!truncated.deserialize(data.data(), size));
+	}
+
+	std::vector<uint8_t> corrupted = data;
+	corrupted[8 + 17 + 4] = 7;
+	g_assert(!loaded.deserialize(corrupted.data(), corrupted.size()));
+	g_assert(loaded.size() == 0);
+
+	// UUIDs which only exist as text can't be serialized
+	BluetoothGattDatabase text;
+	g_assert(text.addService(BluetoothGattService(BluetoothGattService::PRIMARY, BluetoothUuid("not-a-uuid", BluetoothUuid::UUID128))).isValid());
+	std::vector<uint8_t> unchanged = { 0x01 };
+	g_assert(!text.serialize(unchanged));
+	g_assert(unchanged.size() == 1);
+}
+
+static void test_gattcache_file(void)
+{
+	std::string path = createPath();
+	unlink(path.c_str());
+
+	BluetoothGattDatabase db;
+	createDatabase(db, 4);
+	BluetoothGattValue hash(16, 0xab);
+
+	{
+		BluetoothGattCache cache(path);
+		g_assert(cache.open());
+		g_assert(cache.size() == 0);
+
+		g_assert(cache.store("00:11:22:33:44:55", db, hash));
+		g_assert(cache.store("00:11:22:33:44:01", db));
+		g_assert(!cache.store("invalid", db));
+		g_assert(!cache.store("00:11:22:33:44:02", db, BluetoothGattValue(17, 0)));
+		g_assert(cache.isModified());
+		g_assert(cache.size() == 2);
+		g_assert(cache.save());
+		g_assert(!cache.isModified());
+	}
+
+	BluetoothGattCache cache(path);
+	g_assert(cache.open());
+	g_assert(cache.size() == 2);
+
+	BluetoothGattDatabase loaded;
+	g_assert(cache.load("00:11:22:33:44:55", loaded));
+	g_assert(loaded.getServiceCount() == 4);
+	g_assert(loaded.findCharacteristic(BluetoothUuid::fromUInt16(0x1803), BluetoothUuid::fromUInt16(0x2a03)).getHandle() == 0x46);
+	g_assert(!cache.load("00:11:22:33:44:66", loaded));
+
+	BluetoothGattValue cachedHash;
+	g_assert(cache.getDatabaseHash(BluetoothAddress("00:11:22:33:44:55"), cachedHash) && cachedHash == hash);
+	g_assert(cache.getDatabaseHash(BluetoothAddress("00:11:22:33:44:01"), cachedHash) && cachedHash.empty());
+
+	// Matching hashes keep the database, a changed hash drops it
+	g_assert(cache.validate("00:11:22:33:44:55", hash));
+	g_assert(cache.validate("00:11:22:33:44:01", BluetoothGattValue()));
+	g_assert(!cache.validate("00:11:22:33:44:55", BluetoothGattValue(16, 0xcd)));
+	g_assert(!cache.contains(BluetoothAddress("00:11:22:33:44:55")));
+
+	// Service Changed only drops the affected services
+	cache.serviceChanged(BluetoothAddress("00:11:22:33:44:01"), 0x25, 0x2a);
+	g_assert(cache.load("00:11:22:33:44:01", loaded));
+	g_assert(loaded.getServiceCount() == 3);
+	g_assert(!loaded.findService(BluetoothUuid::fromUInt16(0x1801)).isValid());
+	g_assert(loaded.findService(BluetoothUuid::fromUInt16(0x1802)).getHandle() == 0x2f);
+
+	cache.serviceChanged(BluetoothAddress("00:11:22:33:44:01"), 0x0001, 0xffff);
+	g_assert(!cache.contains(BluetoothAddress("00:11:22:33:44:01")));
+
+	g_assert(cache.store("00:11:22:33:44:77", db));
+	g_assert(cache.save());
+	g_assert(cache.size() == 1);
+
+	BluetoothGattCache reopened(path);
+	g_assert(reopened.open());
+	g_assert(reopened.size() == 1 && reopened.contains(BluetoothAddress("00:11:22:33:44:77")));
+
+	// Unsaved changes are dropped when reopening
+	g_assert(reopened.remove("00:11:22:33:44:77"));
+	g_assert(!reopened.remove("00:11:22:33:44:77"));
+	g_assert(reopened.size() == 0);
+	g_assert(reopened.open());
+	g_assert(reopened.size() == 1);
+
+	// A damaged file results in an empty cache
+	g_assert(truncate(path.c_str(), 30) == 0);
+	g_assert(!reopened.open());
+	g_assert(reopened.size() == 0);
+
+	unlink(path.c_str());
+}
+
+static void test_gattcache_startup(void)
+{
+	if (!g_test_perf())
+		return;
+
+	const int deviceCount = 4000;
+	std::string path = createPath();
+
+	BluetoothGattDatabase db;
+	createDatabase(db, 8);
+
+	{
+		BluetoothGattCache cache(path);
+		cache.open();
+		for (int n = 0; n < deviceCount; n++)
+			cache.store(BluetoothAddress(0xc00000000000ULL + n * 7919), db);
+		g_assert(cache.save());
+	}
+
+	g_test_timer_start();
+	BluetoothGattCache cache(path);
+	g_assert(cache.open());
+	double openElapsed = g_test_timer_elapsed();
+
+	g_assert(cache.size() == deviceCount);
+
+	BluetoothGattDatabase loaded;
+	g_test_timer_start();
+	for (int n = 0; n < deviceCount; n++)
+		g_assert(cache.load(BluetoothAddress(0xc00000000000ULL + n * 7919), loaded));
+	double loadElapsed = g_test_timer_elapsed();
+
+	g_test_minimized_result(openElapsed, "%.2f ms to open a cache of %d devices", openElapsed * 1000, deviceCount);
+	g_test_maximized_result(deviceCount / loadElapsed, "%.0f databases loaded/s", deviceCount / loadElapsed);
+
+	unlink(path.c_str());
+}
+
+int main(int argc, char **argv)
+{
+	g_test_init(&argc, &argv, nullptr);
+
+	g_test_add_func("/gattcache/serialize", test_gattcache_serialize);
+	g_test_add_func("/gattcache/file", test_gattcache_file);
+	g_test_add_func("/gattcache/startup", test_gattcache_startup);
+
+	return g_test_run();
+}
@@ -0,0 +1,252 @@
+// Copyright (c) 2026 LG Electronics, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+
+#include <glib.h>
+
+#include "bluetooth-sil-api.h"
+
+static BluetoothGattService createService(uint16_t uuid, int characteristicCount, uint16_t firstHandle)
+{
+	BluetoothGattService service(BluetoothGattService::PRIMARY, BluetoothUuid::fromUInt16(uuid));
+	uint16_t handle = firstHandle;
+
+	for (int n = 0; n < characteristicCount; n++)
+	{
+		BluetoothGattCharacteristic characteristic;
+		characteristic.setUuid(BluetoothUuid::fromUInt16(0x2a00 + n));
+		characteristic.setProperties(BluetoothGattCharacteristic::PROPERTY_READ | BluetoothGattCharacteristic::PROPERTY_NOTIFY);
+		characteristic.setPermissions(PERMISSION_READ);
+		characteristic.setValue({ static_cast<uint8_t>(n) });
+		characteristic.setHandle(handle ? handle++ : 0);
+
+		BluetoothGattDescriptor descriptor;
+		descriptor.setUuid(BluetoothUuid::fromUInt16(0x2902));
+		descriptor.setPermissions(PERMISSION_READ | PERMISSION_WRITE);
+		descriptor.setValue({ 0x00, 0x00 });
+		descriptor.setHandle(handle ? handle++ : 0);
+		characteristic.addDescriptor(descriptor);
+
+		service.addCharacteristic(characteristic);
+	}
+
+	return service;
+}
+
+static void test_gattdb_import(void)
+{
+	BluetoothGattDatabase db;
+
+	BluetoothGattService battery = createService(0x180f, 1, 0);
+	battery.includeService(BluetoothUuid::fromUInt16(0x180a));
+
+	// Handles are assigned to locally registered services
+	BluetoothGattDatabase::Service service = db.addService(battery);
+	g_assert(service.isValid());
+	g_assert(service.getHandle() == 1 && service.getEndHandle() == 3);
+	g_assert(service.getType() == BluetoothGattService::PRIMARY);
+	g_assert(service.getCharacteristicCount() == 1);
+
+	BluetoothGattDatabase::Characteristic level = service.getCharacteristic(0);
+	g_assert(level.getHandle() == 2);
+	g_assert(level.getUuid() == BluetoothUuid::fromUInt16(0x2a00));
+	g_assert(level.isPropertySet(BluetoothGattCharacteristic::PROPERTY_NOTIFY));
+	g_assert(level.getService().getUuid() == battery.getUuid());
+	g_assert(level.getDescriptorCount() == 1);
+	g_assert(level.getDescriptor(0).getHandle() == 3);
+	g_assert(level.findDescriptor(BluetoothUuid::fromUInt16(0x2902)).getCharacteristic().getHandle() == 2);
+	g_assert(!level.findDescriptor(BluetoothUuid::fromUInt16(0x2901)).isValid());
+
+	// Discovered services keep their handles
+	BluetoothGattDatabase::Service heartRate = db.addService(createService(0x180d, 3, 0x20));
+	g_assert(heartRate.isValid());
+	g_assert(heartRate.getHandle() == 0x1f && heartRate.getEndHandle() == 0x25);
+	g_assert(db.getServiceCount() == 2 && db.size() == 10);
+
+	// Services with a handle which is already used are rejected as a whole
+	g_assert(!db.addService(createService(0x1810, 2, 0x24)).isValid());
+	g_assert(db.getServiceCount() == 2 && db.size() == 10);
+	g_assert(!db.findService(BluetoothUuid::fromUInt16(0x1810)).isValid());
+	g_assert(!db.addService(BluetoothGattService()).isValid());
+
+	// The next local service continues after the highest handle
+	g_assert(db.addService(createService(0x1811, 1, 0)).getHandle() == 0x26);
+
+	// Converting back yields the original services
+	BluetoothGattServiceList services = db.toServices();
+	g_assert(services.size() == 3);
+	g_assert(services[0].getUuid() == battery.getUuid());
+	g_assert(services[0].getIncludedServices() == battery.getIncludedServices());
+	g_assert(services[1].getCharacteristics().size() == 3);
+
+	const BluetoothGattCharacteristic *converted = services[1].findCharacteristic(BluetoothUuid::fromUInt16(0x2a01));
+	g_assert(converted && converted->getHandle() == 0x22);
+	g_assert(converted->getValue() == BluetoothGattValue({ 0x01 }));
+	g_assert(converted->getProperties() == (BluetoothGattCharacteristic::PROPERTY_READ | BluetoothGattCharacteristic::PROPERTY_NOTIFY));
+	g_assert(converted->findDescriptor(BluetoothUuid::fromUInt16(0x2902))->getHandle() == 0x23);
+
+	db.clear();
+	g_assert(db.size() == 0 && db.getServiceCount() == 0);
+	g_assert(!db.findCharacteristic(0x22).isValid());
+}
+
+static void test_gattdb_handles(void)
+{
+	BluetoothGattDatabase db;
+	g_assert(db.addServices({ createService(0x180f, 1, 0x10), createService(0x180d, 2, 0x20) }));
+
+	BluetoothGattDatabase::AttributeType type;
+	g_assert(db.getAttributeType(0x0f, type) && type == BluetoothGattDatabase::ATTRIBUTE_SERVICE);
+	g_assert(db.getAttributeType(0x22, type) && type == BluetoothGattDatabase::ATTRIBUTE_CHARACTERISTIC);
+	g_assert(db.getAttributeType(0x23, type) && type == BluetoothGattDatabase::ATTRIBUTE_DESCRIPTOR);
+	g_assert(!db.getAttributeType(0x15, type));
+	g_assert(!db.getAttributeType(0xffff, type));
+
+	BluetoothGattDatabase::Characteristic characteristic = db.findCharacteristic(0x22);
+	g_assert(characteristic.isValid() && characteristic.getUuid() == BluetoothUuid::fromUInt16(0x2a01));
+	g_assert(!db.findCharacteristic(0x23).isValid());
+	g_assert(db.findDescriptor(0x23).isValid());
+	g_assert(db.findServiceByHandle(0x23).getUuid() == BluetoothUuid::fromUInt16(0x180d));
+	g_assert(db.findServiceByHandle(0x1f).getHandle() == 0x1f);
+
+	// Values are updated in place and visible through existing views
+	g_assert(db.setValue(0x22, { 0xaa, 0xbb }));
+	g_assert(characteristic.getValue() == BluetoothGattValue({ 0xaa, 0xbb }));
+	g_assert(db.setValue(0x23, { 0x01, 0x00 }));
+	g_assert(db.findDescriptor(BluetoothUuid::fromUInt16(0x180d), BluetoothUuid::fromUInt16(0x2a01),
+	                           BluetoothUuid::fromUInt16(0x2902)).getValue() == BluetoothGattValue({ 0x01, 0x00 }));
+	g_assert(!db.setValue(0x1f, { 0x00 }));
+	g_assert(!db.setValue(0x50, { 0x00 }));
+
+	// Handles can be moved, e.g. after registering a local service
+	g_assert(db.setHandle(0x22, 0x40));
+	g_assert(!db.findCharacteristic(0x22).isValid());
+	g_assert(db.findCharacteristic(0x40).getUuid() == BluetoothUuid::fromUInt16(0x2a01));
+	g_assert(characteristic.getHandle() == 0x40);
+	g_assert(!db.setHandle(0x40, 0x10));
+	g_assert(!db.setHandle(0x22, 0x41));
+
+	BluetoothGattDatabase::Characteristic found = db.findCharacteristic(BluetoothUuid::fromUInt16(0x180d), BluetoothUuid::fromUInt16(0x2a01));
+	g_assert(found.getHandle() == 0x40);
+	g_assert(!db.findCharacteristic(BluetoothUuid::fromUInt16(0x180f), BluetoothUuid::fromUInt16(0x2a01)).isValid());
+	g_assert(!db.findCharacteristic(BluetoothUuid::fromUInt16(0x1800), BluetoothUuid::fromUInt16(0x2a00)).isValid());
+
+	// The end handle follows moved attributes
+	g_assert(db.findServiceByHandle(0x1f).getEndHandle() == 0x40);
+}
+
+static void test_gattdb_end_handle(void)
+{
+	BluetoothGattService service(BluetoothGattService::PRIMARY, BluetoothUuid::fromUInt16(0x180f));
+
+	BluetoothGattCharacteristic characteristic;
+	characteristic.setUuid(BluetoothUuid::fromUInt16(0x2a19));
+	characteristic.setHandle(4);
+
+	// Descriptors aren't necessarily added in handle order
+	BluetoothGattDescriptor description;
+	description.setUuid(BluetoothUuid::fromUInt16(0x2901));
+	description.setHandle(6);
+	characteristic.addDescriptor(description);
+
+	BluetoothGattDescriptor cccd;
+	cccd.setUuid(BluetoothUuid::fromUInt16(0x2902));
+	cccd.setHandle(5);
+	characteristic.addDescriptor(cccd);
+
+	service.addCharacteristic(characteristic);
+
+	BluetoothGattDatabase db;
+	BluetoothGattDatabase::Service added = db.addService(service);
+	g_assert(added.getHandle() == 3 && added.getEndHandle() == 6);
+
+	// The same holds for a restored database
+	std::vector<uint8_t> data;
+	g_assert(db.serialize(data));
+
+	BluetoothGattDatabase restored;
+	g_assert(restored.deserialize(data.data(), data.size()));
+	g_assert(restored.findServiceByHandle(6).getEndHandle() == 6);
+}
+
+static void test_gattdb_lookup_throughput(void)
+{
+	if (!g_test_perf())
+		return;
+
+	const int serviceCount = 16;
+	const int characteristicCount = 16;
+	const int iterations = 1000000;
+
+	BluetoothGattServiceList services;
+	BluetoothGattDatabase db;
+
+	for (int n = 0; n < serviceCount; n++)
+	{
+		services.push_back(createService(0x1800 + n, characteristicCount, 0x10 + n * 0x40));
+		g_assert(db.addService(services.back()).isValid());
+	}
+
+	BluetoothGattValue value = { 0x01, 0x02 };
+	size_t found = 0;
+
+	g_test_timer_start();
+	for (int n = 0; n < iterations; n++)
+	{
+		BluetoothUuid service = BluetoothUuid::fromUInt16(0x1800 + n % serviceCount);
+		BluetoothUuid characteristic = BluetoothUuid::fromUInt16(0x2a00 + (n / serviceCount) % characteristicCount);
+
+		for (auto &candidate : services)
+		{
+			if (candidate.getUuid() == service)
+			{
+				found += candidate.getCharacteristic(characteristic).getHandle() != 0;
+				candidate.updateCharacteristicValue(characteristic, value);
+				break;
+			}
+		}
+	}
+	double listElapsed = g_test_timer_elapsed();
+
+	g_test_timer_start();
+	for (int n = 0; n < iterations; n++)
+	{
+		BluetoothUuid service = BluetoothUuid::fromUInt16(0x1800 + n % serviceCount);
+		BluetoothUuid characteristic = BluetoothUuid::fromUInt16(0x2a00 + (n / serviceCount) % characteristicCount);
+
+		BluetoothGattDatabase::Characteristic entry = db.findCharacteristic(service, characteristic);
+		found -= entry.getHandle() != 0;
+		db.setValue(entry.getHandle(), value);
+	}
+	double databaseElapsed = g_test_timer_elapsed();
+
+	g_assert(found == 0);
+
+	g_test_maximized_result(iterations / listElapsed, "%.0f lookups/s in BluetoothGattServiceList", iterations / listElapsed);
+	g_test_maximized_result(iterations / databaseElapsed, "%.0f lookups/s in BluetoothGattDatabase", iterations / databaseElapsed);
+}
+
+int main(int argc, char **argv)
+{
+	g_test_init(&argc, &argv, nullptr);
+
+	g_test_add_func("/gattdb/import", test_gattdb_import);
+	g_test_add_func("/gattdb/handles", test_gattdb_handles);
+	g_test_add_func("/gattdb/end-handle", test_gattdb_end_handle);
+	g_test_add_func("/gattdb/lookup-throughput", test_gattdb_lookup_throughput);
+
+	return g_test_run();
+}
@@ -0,0 +1,261 @@
+// Copyright (c) 2026 LG Electronics, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+
+#include <glib.h>
+
+#include <chrono>
+
+#include "bluetooth-sil-api.h"
+#include "allocation_counter.h"
+
+class Observer : public BluetoothGattProfileStatusObserver
+{
+public:
+	Observer() : notified(0), batches(0), lastData(nullptr), dispatcher(nullptr) { }
+
+	void characteristicValueNotified(uint16_t connId, uint16_t handle, BluetoothByteSpan value) override
+	{
+		notified++;
+		lastConnId = connId;
+		lastHandle = handle;
+		lastData = value.data();
+		lastSize = value.size();
+	}
+
+	void characteristicValuesNotified(uint16_t connId, uint16_t handle, const BluetoothGattNotificationBatch &values) override
+	{
+		batches++;
+
+		if (record)
+		{
+			std::vector<BluetoothGattValue> batch;
+			for (size_t n = 0; n < values.size(); n++)
+			{
+				batch.push_back(BluetoothGattValue(values[n].data(), values[n].data() + values[n].size()));
+				timestamps.push_back(values.getTimestamp(n));
+			}
+
+			received.push_back(batch);
+		}
+
+		// Values arriving while a batch is processed
+		if (dispatcher)
+		{
+			uint8_t value = 0xee;
+			dispatcher->notify(connId, handle, BluetoothByteSpan(&value, 1), timestamps.empty() ? 0 : timestamps.back());
+			dispatcher->flush();
+			dispatcher = nullptr;
+		}
+
+		BluetoothGattProfileStatusObserver::characteristicValuesNotified(connId, handle, values);
+	}
+
+	size_t notified;
+	size_t batches;
+	uint16_t lastConnId;
+	uint16_t lastHandle;
+	const uint8_t *lastData;
+	size_t lastSize;
+	bool record = true;
+	std::vector<std::vector<BluetoothGattValue>> received;
+	std::vector<uint64_t> timestamps;
+	BluetoothGattNotificationDispatcher *dispatcher;
+};
+
+static void test_gattnotify_value(void)
+{
+	Observer observer;
+	BluetoothGattNotificationDispatcher dispatcher(&observer);
+	uint8_t value[] = { 1, 2, 3, 4, 5, 6 };
+
+	// Characteristics without a mode are reported by the SIL itself
+	g_assert(dispatcher.getDelivery(1, 0x10).mode == BluetoothGattNotificationDelivery::CHARACTERISTIC);
+	g_assert(!dispatcher.notify(1, 0x10, BluetoothByteSpan(value, sizeof(value)), 0));
+	g_assert(observer.notified == 0);
+
+	// The value isn't copied
+	dispatcher.setDelivery(1, 0x10, BluetoothGattNotificationDelivery(BluetoothGattNotificationDelivery::VALUE));
+	g_assert(dispatcher.getDelivery(1, 0x10).mode == BluetoothGattNotificationDelivery::VALUE);
+	g_assert(dispatcher.notify(1, 0x10, BluetoothByteSpan(value, sizeof(value)), 0));
+	g_assert(observer.notified == 1);
+	g_assert(observer.lastConnId == 1 && observer.lastHandle == 0x10);
+	g_assert(observer.lastData == value && observer.lastSize == sizeof(value));
+	g_assert(dispatcher.size() == 0);
+
+	// Modes are kept per connection
+	g_assert(!dispatcher.notify(2, 0x10, BluetoothByteSpan(value, sizeof(value)), 0));
+
+	dispatcher.setDelivery(1, 0x10, BluetoothGattNotificationDelivery());
+	g_assert(!dispatcher.notify(1, 0x10, BluetoothByteSpan(value, sizeof(value)), 0));
+	g_assert(observer.notified == 1);
+
+	// The default batch implementation falls back to single values
+	BluetoothGattProfileStatusObserver nullObserver;
+	uint32_t offsets[] = { 0, 2, 6 };
+	uint64_t timestamps[] = { 10, 20 };
+	BluetoothGattNotificationBatch batch(value, offsets, timestamps, 2);
+	g_assert(batch.size() == 2 && !batch.empty());
+	g_assert(batch[1].data() == value + 2 && batch[1].size() == 4);
+	g_assert(batch.getTimestamp(1) == 20);
+	nullObserver.characteristicValuesNotified(1, 0x10, batch);
+
+	observer.BluetoothGattProfileStatusObserver::characteristicValuesNotified(1, 0x10, batch);
+	g_assert(observer.notified == 3);
+	g_assert(observer.lastData == value + 2 && observer.lastSize == 4);
+}
+
+static void test_gattnotify_batch(void)
+{
+	Observer observer;
+	BluetoothGattNotificationDispatcher dispatcher(&observer);
+	uint32_t delay = 0;
+
+	dispatcher.setDelivery(1, 0x10, BluetoothGattNotificationDelivery(BluetoothGattNotificationDelivery::BATCH, 50, 4));
+	dispatcher.setDelivery(1, 0x20, BluetoothGattNotificationDelivery(BluetoothGattNotificationDelivery::BATCH, 100));
+	g_assert(!dispatcher.run(0, delay));
+
+	// Full batches are delivered right away
+	for (uint8_t n = 0; n < 5; n++)
+	{
+		BluetoothGattValue value(n + 1, n);
+		g_assert(dispatcher.notify(1, 0x10, value, n * 10));
+	}
+
+	g_assert(observer.batches == 1 && dispatcher.size() == 1);
+	g_assert(observer.received[0].size() == 4);
+	g_assert(observer.received[0][0] == BluetoothGattValue(1, 0));
+	g_assert(observer.received[0][3] == BluetoothGattValue(4, 3));
+	g_assert(observer.timestamps == std::vector<uint64_t>({ 0, 10, 20, 30 }));
+
+	// Others after their interval
+	g_assert(dispatcher.notify(1, 0x20, BluetoothGattValue({ 0x20 }), 45));
+	g_assert(dispatcher.run(45, delay) && delay == 45);
+	g_assert(dispatcher.run(90, delay) && delay == 55);
+	g_assert(observer.batches == 2);
+	g_assert(observer.received[1] == std::vector<BluetoothGattValue>({ BluetoothGattValue(5, 4) }));
+
+	g_assert(!dispatcher.run(145, delay));
+	g_assert(observer.batches == 3 && dispatcher.size() == 0);
+
+	// Empty values are kept
+	dispatcher.notify(1, 0x20, BluetoothByteSpan(), 150);
+	dispatcher.notify(1, 0x20, BluetoothGattValue({ 1 }), 150);
+	dispatcher.flush();
+	g_assert(observer.received.back() == std::vector<BluetoothGattValue>({ BluetoothGattValue(), BluetoothGattValue({ 1 }) }));
+
+	// Pending values are delivered before the mode changes
+	dispatcher.notify(1, 0x10, BluetoothGattValue({ 2 }), 160);
+	dispatcher.setDelivery(1, 0x10, BluetoothGattNotificationDelivery(BluetoothGattNotificationDelivery::VALUE));
+	g_assert(observer.received.back() == std::vector<BluetoothGattValue>({ BluetoothGattValue({ 2 }) }));
+	g_assert(dispatcher.size() == 0);
+
+	// The observer may receive values during a delivery
+	dispatcher.notify(1, 0x20, BluetoothGattValue({ 3 }), 170);
+	observer.dispatcher = &dispatcher;
+	dispatcher.flush();
+	g_assert(observer.received.back() == std::vector<BluetoothGattValue>({ BluetoothGattValue({ 3 }) }));
+	g_assert(dispatcher.size() == 1);
+	dispatcher.flush();
+	g_assert(observer.received.back() == std::vector<BluetoothGattValue>({ BluetoothGattValue({ 0xee }) }));
+
+	// Disconnection delivers the pending values and forgets the modes
+	dispatcher.setDelivery(2, 0x20, BluetoothGattNotificationDelivery(BluetoothGattNotificationDelivery::BATCH, 100));
+	dispatcher.notify(1, 0x20, BluetoothGattValue({ 4 }), 200);
+	dispatcher.notify(2, 0x20, BluetoothGattValue({ 5 }), 200);
+	dispatcher.disconnected(1);
+	g_assert(observer.received.back() == std::vector<BluetoothGattValue>({ BluetoothGattValue({ 4 }) }));
+	g_assert(dispatcher.getDelivery(1, 0x20).mode == BluetoothGattNotificationDelivery::CHARACTERISTIC);
+	g_assert(dispatcher.getDelivery(1, 0x10).mode == BluetoothGattNotificationDelivery::CHARACTERISTIC);
+	g_assert(dispatcher.getDelivery(2, 0x20).mode == BluetoothGattNotificationDelivery::BATCH);
+	g_assert(dispatcher.size() == 1);
+}
+
+static void test_gattnotify_allocations(void)
+{
+	const size_t count = 100000;
+	uint8_t sample[12] = { 0 };
+
+	Observer observer;
+	observer.record = false;
+	BluetoothGattNotificationDispatcher dispatcher(&observer);
+	dispatcher.setDelivery(1, 0x10, BluetoothGattNotificationDelivery(BluetoothGattNotificationDelivery::VALUE));
+	dispatcher.setDelivery(1, 0x20, BluetoothGattNotificationDelivery(BluetoothGattNotificationDelivery::BATCH, 100, 10));
+	dispatcher.setDelivery(1, 0x30, BluetoothGattNotificationDelivery(BluetoothGattNotificationDelivery::BATCH, 100, 10));
+
+	// Let the batch buffers grow to their final size
+	for (uint64_t now = 0; now < 100; now++)
+	{
+		dispatcher.notify(1, 0x20, BluetoothByteSpan(sample, sizeof(sample)), now);
+		dispatcher.notify(1, 0x30, BluetoothByteSpan(sample, sizeof(sample)), now);
+	}
+
+	size_t before = allocations;
+	auto start = std::chrono::steady_clock::now();
+
+	for (size_t n = 0; n < count; n++)
+	{
+		sample[0] = n & 0xff;
+		dispatcher.notify(1, 0x10, BluetoothByteSpan(sample, sizeof(sample)), n);
+		dispatcher.notify(1, 0x20 + (n & 1) * 0x10, BluetoothByteSpan(sample, sizeof(sample)), n);
+	}
+
+	double fastSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+	size_t fastAllocations = allocations - before;
+	g_assert(observer.notified == count + (count + 200) / 10 * 10);
+
+	// Reporting the same notifications through characteristicValueChanged
+	BluetoothGattProfileStatusObserver legacy;
+	BluetoothGattDescriptor descriptor;
+	descriptor.setUuid(BluetoothUuid::fromUInt16(0x2902));
+	descriptor.setValue({ 0x01, 0x00 });
+	BluetoothUuid service = BluetoothUuid::fromUInt16(0x1800);
+	std::string address = "00:11:22:33:44:55";
+
+	before = allocations;
+	start = std::chrono::steady_clock::now();
+
+	for (size_t n = 0; n < count; n++)
+	{
+		sample[0] = n & 0xff;
+		BluetoothGattCharacteristic characteristic;
+		characteristic.setUuid(BluetoothUuid::fromUInt16(0x2a37));
+		characteristic.setHandle(0x10);
+		characteristic.setValue(BluetoothGattValue(sample, sample + sizeof(sample)));
+		characteristic.addDescriptor(descriptor);
+		legacy.characteristicValueChanged(address, service, characteristic, address);
+	}
+
+	double legacySeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+	size_t legacyAllocations = allocations - before;
+
+	g_test_message("fast path: %zu allocations, %.0f notifications/s", fastAllocations, 2 * count / fastSeconds);
+	g_test_message("characteristic objects: %zu allocations, %.0f notifications/s", legacyAllocations, count / legacySeconds);
+
+	g_assert(fastAllocations == 0);
+	g_assert(legacyAllocations >= count);
+}
+
+int main(int argc, char **argv)
+{
+	g_test_init(&argc, &argv, nullptr);
+
+	g_test_add_func("/gattnotify/value", test_gattnotify_value);
+	g_test_add_func("/gattnotify/batch", test_gattnotify_batch);
+	g_test_add_func("/gattnotify/allocations", test_gattnotify_allocations);
+
+	return g_test_run();
+}
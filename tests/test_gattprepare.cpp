@@ -0,0 +1,221 @@
+// Copyright (c) 2026 LG Electronics, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+
+#include <glib.h>
+
+#include "bluetooth-sil-api.h"
+#include "allocation_counter.h"
+
+struct Write
+{
+	uint16_t serviceId;
+	uint16_t charId;
+	BluetoothGattValue value;
+};
+
+static const std::string CLIENT_ADDRESS = "00:11:22:33:44:55";
+static const std::string SECOND_ADDRESS = "66:77:88:99:AA:BB";
+
+static BluetoothGattValue makeValue(size_t length, uint8_t first)
+{
+	BluetoothGattValue value(length);
+	for (size_t n = 0; n < length; n++)
+		value[n] = first + n;
+
+	return value;
+}
+
+static void test_gattprepare_execute(void)
+{
+	BluetoothGattPreparedWriteQueue queue(512, 256);
+	std::vector<Write> writes;
+	auto record = [&](const BluetoothAddress &address, uint16_t serviceId, uint16_t charId, const BluetoothGattValue &value) {
+		g_assert(address == BluetoothAddress(CLIENT_ADDRESS));
+		writes.push_back({ serviceId, charId, value });
+	};
+
+	BluetoothGattValue first = makeValue(100, 0);
+	BluetoothGattValue second = makeValue(30, 0x80);
+
+	// Fragments of several characteristics interleaved
+	g_assert(queue.prepare(CLIENT_ADDRESS, 1, 2, 0, BluetoothByteSpan(first.data(), 40)) == BLUETOOTH_ERROR_NONE);
+	g_assert(queue.prepare(CLIENT_ADDRESS, 1, 5, 0, BluetoothByteSpan(second.data(), 20)) == BLUETOOTH_ERROR_NONE);
+	g_assert(queue.prepare(CLIENT_ADDRESS, 1, 2, 40, BluetoothByteSpan(first.data() + 40, 60)) == BLUETOOTH_ERROR_NONE);
+	g_assert(queue.prepare(CLIENT_ADDRESS, 1, 5, 20, BluetoothByteSpan(second.data() + 20, 10)) == BLUETOOTH_ERROR_NONE);
+	g_assert(queue.size(CLIENT_ADDRESS) == 130);
+
+	// Queues are kept per client
+	g_assert(queue.prepare(SECOND_ADDRESS, 1, 2, 0, BluetoothByteSpan(second)) == BLUETOOTH_ERROR_NONE);
+
+	g_assert(queue.execute(CLIENT_ADDRESS, record) == BLUETOOTH_ERROR_NONE);
+	g_assert(writes.size() == 2);
+	g_assert(writes[0].charId == 2 && writes[0].value == first);
+	g_assert(writes[1].charId == 5 && writes[1].value == second);
+	g_assert(queue.size(CLIENT_ADDRESS) == 0 && queue.size(SECOND_ADDRESS) == 30);
+
+	// Executing an empty queue does nothing
+	g_assert(queue.execute(CLIENT_ADDRESS, record) == BLUETOOTH_ERROR_NONE);
+	g_assert(writes.size() == 2);
+
+	// Later fragments overwrite earlier ones
+	writes.clear();
+	queue.prepare(CLIENT_ADDRESS, 1, 2, 0, BluetoothByteSpan(first.data(), 10));
+	queue.prepare(CLIENT_ADDRESS, 1, 2, 5, BluetoothByteSpan(second.data(), 2));
+	queue.execute(CLIENT_ADDRESS, record);
+	BluetoothGattValue expected(first.begin(), first.begin() + 10);
+	expected[5] = second[0];
+	expected[6] = second[1];
+	g_assert(writes.size() == 1 && writes[0].value == expected);
+
+	// Nothing is delivered if any value has a gap
+	writes.clear();
+	queue.prepare(CLIENT_ADDRESS, 1, 2, 0, BluetoothByteSpan(first.data(), 10));
+	queue.prepare(CLIENT_ADDRESS, 1, 5, 11, BluetoothByteSpan(first.data(), 10));
+	g_assert(queue.execute(CLIENT_ADDRESS, record) == BLUETOOTH_ERROR_PARAM_INVALID);
+	g_assert(writes.empty() && queue.size(CLIENT_ADDRESS) == 0);
+
+	// Limits of the attribute and the queue
+	g_assert(queue.prepare(CLIENT_ADDRESS, 1, 2, 500, BluetoothByteSpan(first.data(), 13)) == BLUETOOTH_ERROR_PARAM_INVALID);
+	g_assert(queue.prepare(CLIENT_ADDRESS, 1, 2, 0, BluetoothByteSpan(first)) == BLUETOOTH_ERROR_NONE);
+	g_assert(queue.prepare(CLIENT_ADDRESS, 1, 2, 100, BluetoothByteSpan(first)) == BLUETOOTH_ERROR_NONE);
+	g_assert(queue.prepare(CLIENT_ADDRESS, 1, 2, 200, BluetoothByteSpan(first)) == BLUETOOTH_ERROR_NOMEM);
+	g_assert(queue.size(CLIENT_ADDRESS) == 200);
+
+	queue.cancel(CLIENT_ADDRESS);
+	g_assert(queue.size(CLIENT_ADDRESS) == 0);
+	g_assert(queue.execute(CLIENT_ADDRESS, record) == BLUETOOTH_ERROR_NONE && writes.empty());
+
+	queue.disconnected(SECOND_ADDRESS);
+	g_assert(queue.size(SECOND_ADDRESS) == 0);
+
+	// The callback may prepare the next writes
+	queue.prepare(CLIENT_ADDRESS, 1, 2, 0, BluetoothByteSpan(first.data(), 10));
+	g_assert(queue.execute(CLIENT_ADDRESS, [&](const BluetoothAddress &address, uint16_t serviceId, uint16_t charId,
+	                                   const BluetoothGattValue &value) {
+		record(address, serviceId, charId, value);
+		queue.prepare(address, 1, 3, 0, BluetoothByteSpan(value));
+	}) == BLUETOOTH_ERROR_NONE);
+	g_assert(queue.size(CLIENT_ADDRESS) == 10);
+	queue.execute(CLIENT_ADDRESS, record);
+	g_assert(writes.size() == 2 && writes[1].charId == 3 && writes[1].value == writes[0].value);
+}
+
+static void test_gattprepare_continue_type(void)
+{
+	BluetoothGattPreparedWriteQueue queue(64);
+	std::vector<Write> writes;
+	auto record = [&](const BluetoothAddress &address, uint16_t serviceId, uint16_t charId, const BluetoothGattValue &value) {
+		writes.push_back({ serviceId, charId, value });
+	};
+
+	BluetoothGattValue value = makeValue(50, 0);
+
+	g_assert(queue.write(CLIENT_ADDRESS, 1, 2, BluetoothByteSpan(value.data(), 8), SHORT_VALUE, record) == BLUETOOTH_ERROR_NONE);
+	g_assert(writes.size() == 1 && writes[0].value == BluetoothGattValue(value.begin(), value.begin() + 8));
+
+	// Fragments without offsets follow each other
+	g_assert(queue.write(CLIENT_ADDRESS, 1, 2, BluetoothByteSpan(value.data(), 18), CONTINUE_VALUE, record) == BLUETOOTH_ERROR_NONE);
+	g_assert(queue.write(CLIENT_ADDRESS, 1, 2, BluetoothByteSpan(value.data() + 18, 18), CONTINUE_VALUE, record) == BLUETOOTH_ERROR_NONE);
+	g_assert(writes.size() == 1);
+	g_assert(queue.write(CLIENT_ADDRESS, 1, 2, BluetoothByteSpan(value.data() + 36, 14), END_VALUE, record) == BLUETOOTH_ERROR_NONE);
+	g_assert(writes.size() == 2 && writes[1].value == value);
+
+	// An empty end only executes
+	queue.write(CLIENT_ADDRESS, 1, 2, BluetoothByteSpan(value.data(), 18), CONTINUE_VALUE, record);
+	g_assert(queue.write(CLIENT_ADDRESS, 1, 2, BluetoothByteSpan(), END_VALUE, record) == BLUETOOTH_ERROR_NONE);
+	g_assert(writes.size() == 3 && writes[2].value.size() == 18);
+
+	queue.write(CLIENT_ADDRESS, 1, 2, BluetoothByteSpan(value.data(), 18), CONTINUE_VALUE, record);
+	g_assert(queue.write(CLIENT_ADDRESS, 1, 2, BluetoothByteSpan(), CANCEL_VALUE, record) == BLUETOOTH_ERROR_NONE);
+	g_assert(queue.size(CLIENT_ADDRESS) == 0);
+
+	// Values longer than the maximum attribute length are rejected
+	queue.write(CLIENT_ADDRESS, 1, 2, BluetoothByteSpan(value.data(), 40), CONTINUE_VALUE, record);
+	g_assert(queue.write(CLIENT_ADDRESS, 1, 2, BluetoothByteSpan(value.data(), 40), CONTINUE_VALUE, record) == BLUETOOTH_ERROR_PARAM_INVALID);
+	g_assert(queue.write(CLIENT_ADDRESS, 1, 2, BluetoothByteSpan(value.data(), 40), END_VALUE, record) == BLUETOOTH_ERROR_PARAM_INVALID);
+	g_assert(queue.size(CLIENT_ADDRESS) == 0 && writes.size() == 3);
+
+	BluetoothGattValue longValue(65, 0);
+	g_assert(queue.write(CLIENT_ADDRESS, 1, 2, BluetoothByteSpan(longValue), SHORT_VALUE, record) == BLUETOOTH_ERROR_PARAM_INVALID);
+}
+
+static void test_gattprepare_allocations(void)
+{
+	const int count = 10000;
+	BluetoothGattValue value = makeValue(512, 0);
+	size_t fragment = 18;
+	size_t delivered = 0;
+
+	BluetoothGattPreparedWriteQueue queue;
+	auto check = [&](const BluetoothAddress &address, uint16_t serviceId, uint16_t charId, const BluetoothGattValue &v) {
+		g_assert(v.size() == value.size());
+		delivered++;
+	};
+
+	auto writeValue = [&]() {
+		for (size_t offset = 0; offset < value.size(); offset += fragment)
+		{
+			size_t length = std::min(fragment, value.size() - offset);
+			queue.write(CLIENT_ADDRESS, 1, 2, BluetoothByteSpan(value.data() + offset, length), CONTINUE_VALUE, check);
+		}
+
+		queue.write(CLIENT_ADDRESS, 1, 2, BluetoothByteSpan(), END_VALUE, check);
+	};
+
+	// The first write reserves the arena of the client
+	writeValue();
+
+	size_t before = allocations;
+	for (int n = 0; n < count; n++)
+		writeValue();
+
+	size_t queueAllocations = allocations - before;
+
+	// Reassembling the fragments in the application
+	before = allocations;
+	for (int n = 0; n < count; n++)
+	{
+		BluetoothGattValue assembled;
+		for (size_t offset = 0; offset < value.size(); offset += fragment)
+		{
+			size_t length = std::min(fragment, value.size() - offset);
+			assembled.insert(assembled.end(), value.begin() + offset, value.begin() + offset + length);
+		}
+
+		g_assert(assembled == value);
+	}
+
+	size_t appAllocations = allocations - before;
+
+	g_test_message("prepared write queue: %zu allocations, reassembly in the application: %zu allocations for %d values",
+	               queueAllocations, appAllocations, count);
+
+	g_assert(delivered == count + 1);
+	g_assert(queueAllocations == 0);
+	g_assert(appAllocations > count);
+}
+
+int main(int argc, char **argv)
+{
+	g_test_init(&argc, &argv, nullptr);
+
+	g_test_add_func("/gattprepare/execute", test_gattprepare_execute);
+	g_test_add_func("/gattprepare/continue-type", test_gattprepare_continue_type);
+	g_test_add_func("/gattprepare/allocations", test_gattprepare_allocations);
+
+	return g_test_run();
+}
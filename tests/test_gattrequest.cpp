@@ -0,0 +1,661 @@
+// Copyright (c) 2026 LG Electronics, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+
+#include <glib.h>
+
+#include "bluetooth-sil-api.h"
+
+// ATT server at the other end of a simulated LE link. PDUs sent by the client
+// reach the server in the next connection event, the responses reach the
+// client in the event after that.
+class LoopbackServer : public BluetoothAttBearer
+{
+public:
+	LoopbackServer() :
+		engine(nullptr),
+		mtu(BluetoothGattRequestEngine::DEFAULT_MTU),
+		readMultipleVariable(true),
+		respond(true),
+		serverMtu(517),
+		corruptEcho(false)
+	{
+	}
+
+	void send(const std::vector<uint8_t> &pdu) override
+	{
+		pending.push_back(pdu);
+	}
+
+	void connectionEvent(uint64_t now)
+	{
+		std::vector<std::vector<uint8_t>> requests;
+		std::vector<std::vector<uint8_t>> delivered;
+		requests.swap(pending);
+		delivered.swap(responses);
+
+		for (auto &request : requests)
+			handle(request);
+
+		engine->packetsCompleted(requests.size(), now);
+
+		for (auto &response : delivered)
+			engine->receive(response.data(), response.size(), now);
+	}
+
+	BluetoothGattRequestEngine *engine;
+	uint16_t mtu;
+	bool readMultipleVariable;
+	bool respond;
+	uint16_t serverMtu;
+	bool corruptEcho;
+	std::map<uint16_t, BluetoothGattValue> attributes;
+	std::set<uint16_t> protectedHandles;
+	std::vector<uint8_t> opcodes;
+	std::vector<uint16_t> written;
+	std::vector<std::vector<uint8_t>> prepared;
+	int cancelled = 0;
+
+private:
+	void handle(const std::vector<uint8_t> &request)
+	{
+		opcodes.push_back(request[0]);
+
+		if (!respond)
+			return;
+
+		std::vector<uint8_t> response;
+
+		switch (request[0])
+		{
+		case BluetoothGattRequestEngine::READ_REQUEST:
+		{
+			uint16_t handle = request[1] | (request[2] << 8);
+			if (!check(request[0], handle, 0x02))
+				return;
+
+			const BluetoothGattValue &value = attributes[handle];
+			response.push_back(BluetoothGattRequestEngine::READ_RESPONSE);
+			response.insert(response.end(), value.begin(), value.begin() + std::min<size_t>(value.size(), mtu - 1));
+			break;
+		}
+		case BluetoothGattRequestEngine::READ_MULTIPLE_VARIABLE_REQUEST:
+		{
+			if (!readMultipleVariable)
+			{
+				error(request[0], 0, 0x06);
+				return;
+			}
+
+			response.push_back(BluetoothGattRequestEngine::READ_MULTIPLE_VARIABLE_RESPONSE);
+			for (size_t offset = 1; offset + 1 < request.size(); offset += 2)
+			{
+				uint16_t handle = request[offset] | (request[offset + 1] << 8);
+				if (!check(request[0], handle, 0x02))
+					return;
+
+				const BluetoothGattValue &value = attributes[handle];
+				response.push_back(value.size() & 0xff);
+				response.push_back(value.size() >> 8);
+				response.insert(response.end(), value.begin(), value.end());
+			}
+
+			if (response.size() > mtu)
+				response.resize(mtu);
+			break;
+		}
+		case BluetoothGattRequestEngine::WRITE_REQUEST:
+		case BluetoothGattRequestEngine::WRITE_COMMAND:
+		{
+			uint16_t handle = request[1] | (request[2] << 8);
+			if (request[0] == BluetoothGattRequestEngine::WRITE_COMMAND)
+			{
+				if (attributes.find(handle) != attributes.end() && !protectedHandles.count(handle))
+				{
+					attributes[handle].assign(request.begin() + 3, request.end());
+					written.push_back(handle);
+				}
+				return;
+			}
+
+			if (!check(request[0], handle, 0x03))
+				return;
+
+			attributes[handle].assign(request.begin() + 3, request.end());
+			written.push_back(handle);
+			response.push_back(BluetoothGattRequestEngine::WRITE_RESPONSE);
+			break;
+		}
+		case BluetoothGattRequestEngine::EXCHANGE_MTU_REQUEST:
+			mtu = std::min<uint16_t>(request[1] | (request[2] << 8), serverMtu);
+			response = { BluetoothGattRequestEngine::EXCHANGE_MTU_RESPONSE,
+			             static_cast<uint8_t>(serverMtu & 0xff), static_cast<uint8_t>(serverMtu >> 8) };
+			break;
+		case BluetoothGattRequestEngine::PREPARE_WRITE_REQUEST:
+		{
+			uint16_t handle = request[1] | (request[2] << 8);
+			if (!check(request[0], handle, 0x03))
+				return;
+
+			prepared.push_back(request);
+			response = request;
+			response[0] = BluetoothGattRequestEngine::PREPARE_WRITE_RESPONSE;
+			if (corruptEcho)
+				response.back() ^= 0xff;
+			break;
+		}
+		case BluetoothGattRequestEngine::EXECUTE_WRITE_REQUEST:
+			if (request[1] == 0x01)
+			{
+				for (auto &part : prepared)
+				{
+					uint16_t handle = part[1] | (part[2] << 8);
+					size_t offset = part[3] | (part[4] << 8);
+					BluetoothGattValue &value = attributes[handle];
+					value.resize(std::max(value.size(), offset + part.size() - 5));
+					std::copy(part.begin() + 5, part.end(), value.begin() + offset);
+				}
+
+				if (!prepared.empty())
+					written.push_back(prepared[0][1] | (prepared[0][2] << 8));
+			}
+
+			cancelled += request[1] == 0x00;
+			prepared.clear();
+			response.push_back(BluetoothGattRequestEngine::EXECUTE_WRITE_RESPONSE);
+			break;
+		default:
+			error(request[0], 0, 0x06);
+			return;
+		}
+
+		responses.push_back(response);
+	}
+
+	bool check(uint8_t opcode, uint16_t handle, uint8_t notPermitted)
+	{
+		if (attributes.find(handle) == attributes.end())
+		{
+			error(opcode, handle, 0x01);
+			return false;
+		}
+
+		if (protectedHandles.count(handle))
+		{
+			error(opcode, handle, notPermitted);
+			return false;
+		}
+
+		return true;
+	}
+
+	void error(uint8_t opcode, uint16_t handle, uint8_t code)
+	{
+		responses.push_back({ BluetoothGattRequestEngine::ERROR_RESPONSE, opcode,
+		                      static_cast<uint8_t>(handle & 0xff), static_cast<uint8_t>(handle >> 8), code });
+	}
+
+	std::vector<std::vector<uint8_t>> pending;
+	std::vector<std::vector<uint8_t>> responses;
+};
+
+static const uint32_t CONNECTION_INTERVAL = 30;
+
+// Run connection events until the engine is idle and return their number
+static unsigned int runUntilIdle(LoopbackServer &server, BluetoothGattRequestEngine &engine, uint64_t &now)
+{
+	unsigned int events = 0;
+
+	while ((engine.size() > 0 || engine.isBusy()) && events < 10000)
+	{
+		now += CONNECTION_INTERVAL;
+		server.connectionEvent(now);
+		events++;
+	}
+
+	// Let the controller report the last packets
+	now += CONNECTION_INTERVAL;
+	server.connectionEvent(now);
+
+	return events;
+}
+
+static void fillAttributes(LoopbackServer &server, uint16_t first, uint16_t count, size_t length)
+{
+	for (uint16_t handle = first; handle < first + count; handle++)
+		server.attributes[handle] = BluetoothGattValue(length, static_cast<uint8_t>(handle));
+}
+
+static void test_gattrequest_read(void)
+{
+	LoopbackServer server;
+	BluetoothGattRequestEngine engine(&server);
+	server.engine = &engine;
+	engine.setReadMultipleVariableSupported(true);
+	uint64_t now = 0;
+
+	fillAttributes(server, 0x10, 8, 4);
+	server.attributes[0x20] = BluetoothGattValue(40, 0x20);
+	server.protectedHandles.insert(0x13);
+
+	// Reads queued back to back share a request
+	std::vector<BluetoothGattValue> values;
+	BluetoothError result = BLUETOOTH_ERROR_FAIL;
+	engine.read({ 0x10, 0x11, 0x12 }, 1000, now, [&](BluetoothError error, const std::vector<BluetoothGattValue> &v) {
+		result = error;
+		values = v;
+	});
+	g_assert(engine.isBusy() && engine.size() == 0);
+
+	runUntilIdle(server, engine, now);
+	g_assert(result == BLUETOOTH_ERROR_NONE);
+	g_assert(values.size() == 3);
+	g_assert(values[0] == BluetoothGattValue(4, 0x10));
+	g_assert(values[2] == BluetoothGattValue(4, 0x12));
+	g_assert(server.opcodes == std::vector<uint8_t>({ BluetoothGattRequestEngine::READ_MULTIPLE_VARIABLE_REQUEST }));
+	g_assert(engine.getStatistics().coalescedReads == 3);
+
+	// A value which doesn't fit into the response is read on its own,
+	// the failing read doesn't fail the others
+	server.opcodes.clear();
+	std::map<uint16_t, BluetoothError> errors;
+	std::map<uint16_t, BluetoothGattValue> read;
+	for (uint16_t handle : { 0x14, 0x20, 0x15, 0x13, 0x16 })
+	{
+		engine.read(handle, 1000, now, [&, handle](BluetoothError error, const BluetoothGattValue &value) {
+			errors[handle] = error;
+			read[handle] = value;
+		});
+	}
+
+	runUntilIdle(server, engine, now);
+	g_assert(errors.size() == 5);
+	g_assert(errors[0x13] == BLUETOOTH_ERROR_NOT_ALLOWED);
+	g_assert(errors[0x14] == BLUETOOTH_ERROR_NONE && read[0x14] == BluetoothGattValue(4, 0x14));
+	g_assert(errors[0x15] == BLUETOOTH_ERROR_NONE && read[0x15] == BluetoothGattValue(4, 0x15));
+	g_assert(errors[0x16] == BLUETOOTH_ERROR_NONE && read[0x16] == BluetoothGattValue(4, 0x16));
+	g_assert(errors[0x20] == BLUETOOTH_ERROR_NONE && read[0x20] == BluetoothGattValue(22, 0x20));
+	// The first read went out before the others were queued
+	g_assert(server.opcodes[0] == BluetoothGattRequestEngine::READ_REQUEST);
+	g_assert(std::count(server.opcodes.begin(), server.opcodes.end(), BluetoothGattRequestEngine::READ_REQUEST) == 2);
+
+	// The first error of the reads is reported
+	engine.read({ 0x10, 0x99 }, 1000, now, [&](BluetoothError error, const std::vector<BluetoothGattValue> &v) {
+		result = error;
+		values = v;
+	});
+	runUntilIdle(server, engine, now);
+	g_assert(result == BLUETOOTH_ERROR_PARAM_INVALID && values.empty());
+
+	// Servers without support get single reads
+	server.opcodes.clear();
+	server.readMultipleVariable = false;
+	engine.read({ 0x10, 0x11, 0x12 }, 1000, now, [&](BluetoothError error, const std::vector<BluetoothGattValue> &v) {
+		result = error;
+		values = v;
+	});
+	runUntilIdle(server, engine, now);
+	g_assert(result == BLUETOOTH_ERROR_NONE && values.size() == 3 && values[1] == BluetoothGattValue(4, 0x11));
+	g_assert(server.opcodes.size() == 4);
+	g_assert(server.opcodes[0] == BluetoothGattRequestEngine::READ_MULTIPLE_VARIABLE_REQUEST);
+	g_assert(server.opcodes[3] == BluetoothGattRequestEngine::READ_REQUEST);
+
+	engine.read({}, 1000, now, [&](BluetoothError error, const std::vector<BluetoothGattValue> &v) { result = error; });
+	g_assert(result == BLUETOOTH_ERROR_PARAM_INVALID);
+}
+
+static void test_gattrequest_write(void)
+{
+	LoopbackServer server;
+	BluetoothGattRequestEngine engine(&server, 4);
+	server.engine = &engine;
+	uint64_t now = 0;
+
+	fillAttributes(server, 0x10, 16, 2);
+
+	// Commands are limited by the credits only
+	int completed = 0;
+	for (uint16_t n = 0; n < 10; n++)
+	{
+		engine.write(0x10 + n, { 0xaa, static_cast<uint8_t>(n) }, false, 1000, now, [&](BluetoothError error) {
+			g_assert(error == BLUETOOTH_ERROR_NONE);
+			completed++;
+		});
+	}
+	g_assert(engine.getCredits() == 0 && engine.size() == 6);
+	g_assert(completed == 0);
+
+	now += CONNECTION_INTERVAL;
+	server.connectionEvent(now);
+	g_assert(completed == 4 && engine.size() == 2);
+
+	runUntilIdle(server, engine, now);
+	g_assert(completed == 10 && engine.getCredits() == 4);
+
+	// Packets the engine didn't send return no credits
+	engine.packetsCompleted(3, now);
+	g_assert(engine.getCredits() == 4);
+	g_assert(server.attributes[0x19] == BluetoothGattValue({ 0xaa, 9 }));
+
+	// Requests keep their order with the commands around them
+	server.written.clear();
+	std::vector<BluetoothError> results;
+	engine.write(0x10, { 1 }, true, 1000, now, [&](BluetoothError error) { results.push_back(error); });
+	engine.write(0x11, { 2 }, false, 1000, now, nullptr);
+	engine.write(0x12, { 3 }, true, 1000, now, [&](BluetoothError error) { results.push_back(error); });
+	// The command follows the first request without waiting for its response
+	g_assert(engine.isBusy() && engine.size() == 1);
+
+	server.protectedHandles.insert(0x12);
+	runUntilIdle(server, engine, now);
+	g_assert(server.written == std::vector<uint16_t>({ 0x10, 0x11 }));
+	g_assert(results == std::vector<BluetoothError>({ BLUETOOTH_ERROR_NONE, BLUETOOTH_ERROR_NOT_ALLOWED }));
+
+	// Commands have to fit into a single PDU, requests into an attribute
+	BluetoothError result = BLUETOOTH_ERROR_NONE;
+	engine.write(0x10, BluetoothGattValue(21, 0), false, 1000, now, [&](BluetoothError error) { result = error; });
+	g_assert(result == BLUETOOTH_ERROR_PARAM_INVALID);
+
+	result = BLUETOOTH_ERROR_NONE;
+	engine.write(0x10, BluetoothGattValue(513, 0), true, 1000, now, [&](BluetoothError error) { result = error; });
+	g_assert(result == BLUETOOTH_ERROR_PARAM_INVALID);
+
+	engine.setMtu(64);
+	engine.write(0x10, BluetoothGattValue(21, 0), false, 1000, now, [&](BluetoothError error) { result = error; });
+	runUntilIdle(server, engine, now);
+	g_assert(result == BLUETOOTH_ERROR_NONE);
+}
+
+static void test_gattrequest_long_write(void)
+{
+	LoopbackServer server;
+	BluetoothGattRequestEngine engine(&server);
+	server.engine = &engine;
+	uint64_t now = 0;
+
+	fillAttributes(server, 0x10, 4, 2);
+
+	BluetoothGattValue value(100);
+	for (size_t n = 0; n < value.size(); n++)
+		value[n] = n;
+
+	// Long values are split into parts of MTU - 5 bytes
+	BluetoothError result = BLUETOOTH_ERROR_FAIL;
+	engine.write(0x10, value, true, 1000, now, [&](BluetoothError error) { result = error; });
+	engine.read(0x11, 1000, now, nullptr);
+	runUntilIdle(server, engine, now);
+	g_assert(result == BLUETOOTH_ERROR_NONE);
+	g_assert(server.attributes[0x10] == value);
+	g_assert(engine.getStatistics().prepareWriteRequests == 6);
+	g_assert(engine.getStatistics().writeRequests == 0);
+
+	// Other requests wait until the write was executed
+	std::vector<uint8_t> expected(6, BluetoothGattRequestEngine::PREPARE_WRITE_REQUEST);
+	expected.push_back(BluetoothGattRequestEngine::EXECUTE_WRITE_REQUEST);
+	expected.push_back(BluetoothGattRequestEngine::READ_REQUEST);
+	g_assert(server.opcodes == expected);
+
+	// Values are written with fewer parts after an MTU exchange
+	uint16_t mtu = 0;
+	engine.exchangeMtu(64, 1000, now, [&](BluetoothError error, uint16_t m) {
+		g_assert(error == BLUETOOTH_ERROR_NONE);
+		mtu = m;
+	});
+	runUntilIdle(server, engine, now);
+	g_assert(mtu == 64 && engine.getMtu() == 64);
+
+	// Only a single exchange is sent
+	server.opcodes.clear();
+	engine.exchangeMtu(128, 1000, now, [&](BluetoothError error, uint16_t m) { mtu = m; });
+	g_assert(mtu == 64 && server.opcodes.empty());
+
+	value.resize(150, 0x55);
+	engine.write(0x11, value, true, 1000, now, [&](BluetoothError error) { result = error; });
+	runUntilIdle(server, engine, now);
+	g_assert(result == BLUETOOTH_ERROR_NONE && server.attributes[0x11] == value);
+	g_assert(engine.getStatistics().prepareWriteRequests == 6 + 3);
+
+	// Failed parts cancel the write
+	server.corruptEcho = true;
+	engine.write(0x12, value, true, 1000, now, [&](BluetoothError error) { result = error; });
+	runUntilIdle(server, engine, now);
+	g_assert(result == BLUETOOTH_ERROR_FAIL);
+	g_assert(server.cancelled == 1);
+	g_assert(server.attributes[0x12] == BluetoothGattValue(2, 0x12));
+
+	server.corruptEcho = false;
+	server.protectedHandles.insert(0x13);
+	engine.write(0x13, value, true, 1000, now, [&](BluetoothError error) { result = error; });
+	runUntilIdle(server, engine, now);
+	g_assert(result == BLUETOOTH_ERROR_NOT_ALLOWED);
+	g_assert(server.cancelled == 1);
+}
+
+class CaptureBearer : public BluetoothAttBearer
+{
+public:
+	void send(const std::vector<uint8_t> &pdu) override
+	{
+		sent.push_back(pdu);
+	}
+
+	std::vector<std::vector<uint8_t>> sent;
+};
+
+static void test_gattrequest_long_write_deadline(void)
+{
+	CaptureBearer bearer;
+	BluetoothGattRequestEngine engine(&bearer, 1);
+	uint32_t delay = 0;
+
+	BluetoothGattValue value(60, 0x42);
+	BluetoothError result = BLUETOOTH_ERROR_FAIL;
+	BluetoothError queued = BLUETOOTH_ERROR_NONE;
+	engine.write(0x10, value, true, 50, 0, [&](BluetoothError error) { result = error; });
+	engine.write(0x11, { 1 }, true, 50, 0, [&](BluetoothError error) { queued = error; });
+	g_assert(bearer.sent.size() == 1);
+
+	// The first part is confirmed while the controller still holds the buffer
+	std::vector<uint8_t> response = bearer.sent[0];
+	response[0] = BluetoothGattRequestEngine::PREPARE_WRITE_RESPONSE;
+	g_assert(engine.receive(response.data(), response.size(), 10));
+	g_assert(!engine.isBusy() && engine.size() == 2);
+
+	// Only the write which didn't start expires
+	g_assert(!engine.run(100, delay));
+	g_assert(queued == BLUETOOTH_ERROR_ABORTED);
+	g_assert(result == BLUETOOTH_ERROR_FAIL);
+	g_assert(engine.size() == 1);
+
+	// The long write continues up to its Execute Write
+	for (uint64_t now = 100; engine.size() > 0 || engine.isBusy(); now += 10)
+	{
+		size_t count = bearer.sent.size();
+		engine.packetsCompleted(1, now);
+		g_assert(bearer.sent.size() == count + 1);
+
+		response = bearer.sent.back();
+		if (response[0] == BluetoothGattRequestEngine::PREPARE_WRITE_REQUEST)
+			response[0] = BluetoothGattRequestEngine::PREPARE_WRITE_RESPONSE;
+		else
+			response = { BluetoothGattRequestEngine::EXECUTE_WRITE_RESPONSE };
+
+		g_assert(engine.receive(response.data(), response.size(), now));
+	}
+
+	g_assert(bearer.sent.back() == std::vector<uint8_t>({ BluetoothGattRequestEngine::EXECUTE_WRITE_REQUEST, 0x01 }));
+	g_assert(result == BLUETOOTH_ERROR_NONE);
+}
+
+static void test_gattrequest_link_defaults(void)
+{
+	// Values of the Core specification for maximum sized PDUs
+	g_assert(BluetoothLeDataLength::txTime(BluetoothLeDataLength::maxOctets(), LE_PHY_1M) == 2120);
+	g_assert(BluetoothLeDataLength::txTime(BluetoothLeDataLength::maxOctets(), LE_PHY_2M) == 1064);
+	g_assert(BluetoothLeDataLength::txTime(BluetoothLeDataLength::maxOctets(), LE_PHY_CODED) == 17040);
+	g_assert(BluetoothLeDataLength::txTime(BluetoothLeDataLength::minOctets(), LE_PHY_1M) == 328);
+	g_assert(BluetoothLeDataLength::mtuForOctets(BluetoothLeDataLength::maxOctets()) == 247);
+	g_assert(BluetoothLeDataLength::mtuForOctets(BluetoothLeDataLength::minOctets()) == BluetoothLeDataLength::minMtu());
+
+	// Connection intervals needed for a firmware image written with long writes
+	const size_t image = 16 * 1024;
+	unsigned int events[2];
+
+	for (int negotiated = 0; negotiated < 2; negotiated++)
+	{
+		LoopbackServer server;
+		BluetoothGattRequestEngine engine(&server);
+		server.engine = &engine;
+		server.attributes[0x10] = BluetoothGattValue();
+		uint64_t now = 0;
+
+		if (negotiated)
+		{
+			engine.exchangeMtu(BluetoothLeDataLength::mtuForOctets(BluetoothLeDataLength::maxOctets()), 1000, now, nullptr);
+			runUntilIdle(server, engine, now);
+		}
+
+		unsigned int written = 0;
+		for (size_t offset = 0; offset < image; offset += BluetoothGattRequestEngine::MAX_ATTRIBUTE_LENGTH)
+		{
+			engine.write(0x10, BluetoothGattValue(BluetoothGattRequestEngine::MAX_ATTRIBUTE_LENGTH, 0xa5), true, 60000, now,
+			             [&](BluetoothError error) {
+				g_assert(error == BLUETOOTH_ERROR_NONE);
+				written++;
+			});
+		}
+
+		events[negotiated] = runUntilIdle(server, engine, now);
+		g_assert(written == image / BluetoothGattRequestEngine::MAX_ATTRIBUTE_LENGTH);
+		g_test_message("MTU %u: %u connection intervals for %zu bytes", engine.getMtu(), events[negotiated], image);
+	}
+
+	g_assert(events[1] * 5 < events[0]);
+}
+
+static void test_gattrequest_deadlines(void)
+{
+	LoopbackServer server;
+	BluetoothGattRequestEngine engine(&server);
+	server.engine = &engine;
+	uint64_t now = 0;
+	uint32_t delay = 0;
+
+	fillAttributes(server, 0x10, 4, 2);
+	g_assert(!engine.run(now, delay));
+
+	// Queued operations expire, the outstanding request waits for the ATT timeout
+	server.respond = false;
+	std::vector<BluetoothError> results;
+	engine.write(0x10, { 1 }, true, 100, now, [&](BluetoothError error) { results.push_back(error); });
+	engine.write(0x11, { 1 }, true, 100, now, [&](BluetoothError error) { results.push_back(error); });
+	engine.read(0x12, 500, now, [&](BluetoothError error, const BluetoothGattValue &) { results.push_back(error); });
+
+	g_assert(engine.run(now, delay) && delay == 100);
+	now += 100;
+	g_assert(engine.run(now, delay) && delay == 400);
+	g_assert(results == std::vector<BluetoothError>({ BLUETOOTH_ERROR_ABORTED }));
+	g_assert(engine.size() == 1);
+
+	now += 400;
+	g_assert(engine.run(now, delay) && delay == BluetoothGattRequestEngine::ATT_TIMEOUT - 500);
+	g_assert(results.size() == 2 && engine.size() == 0);
+
+	// The bearer is closed after a timeout
+	now += delay;
+	g_assert(!engine.run(now, delay));
+	g_assert(results.size() == 3 && results[2] == BLUETOOTH_ERROR_ABORTED);
+
+	engine.read(0x12, 500, now, [&](BluetoothError error, const BluetoothGattValue &) { results.push_back(error); });
+	g_assert(results.size() == 4 && results[3] == BLUETOOTH_ERROR_NOT_READY);
+
+	// Everything fails on disconnection, the engine starts over afterwards
+	engine.disconnected(4);
+	engine.write(0x10, { 1 }, true, 100, now, [&](BluetoothError error) { results.push_back(error); });
+	engine.read(0x12, 500, now, [&](BluetoothError error, const BluetoothGattValue &) { results.push_back(error); });
+	engine.disconnected(4);
+	g_assert(results.size() == 6);
+	g_assert(results[4] == BLUETOOTH_ERROR_DEVICE_NOT_CONNECTED && results[5] == BLUETOOTH_ERROR_DEVICE_NOT_CONNECTED);
+
+	// Operations may be queued from callbacks
+	server.respond = true;
+	BluetoothGattValue value;
+	engine.read(0x10, 500, now, [&](BluetoothError error, const BluetoothGattValue &) {
+		engine.read(0x11, 500, now, [&](BluetoothError error, const BluetoothGattValue &v) { value = v; });
+	});
+	runUntilIdle(server, engine, now);
+	g_assert(value == BluetoothGattValue(2, 0x11));
+}
+
+static void test_gattrequest_throughput(void)
+{
+	const uint16_t count = 240;
+	double reads[2];
+	double writes[2];
+
+	// Operations per connection interval against one operation per round trip
+	for (int pipelined = 0; pipelined < 2; pipelined++)
+	{
+		LoopbackServer server;
+		BluetoothGattRequestEngine engine(&server, 8);
+		server.engine = &engine;
+		server.mtu = 247;
+		engine.setMtu(247);
+		engine.setReadMultipleVariableSupported(pipelined);
+		uint64_t now = 0;
+
+		fillAttributes(server, 1, count, 4);
+
+		unsigned int completed = 0;
+		for (uint16_t handle = 1; handle <= count; handle++)
+			engine.read(handle, 60000, now, [&](BluetoothError error, const BluetoothGattValue &) { completed++; });
+
+		unsigned int readEvents = runUntilIdle(server, engine, now);
+		g_assert(completed == count);
+
+		for (uint16_t handle = 1; handle <= count; handle++)
+			engine.write(handle, { 1, 2 }, !pipelined, 60000, now, [&](BluetoothError error) { completed++; });
+
+		unsigned int writeEvents = runUntilIdle(server, engine, now);
+		g_assert(completed == 2 * count);
+
+		reads[pipelined] = static_cast<double>(count) / readEvents;
+		writes[pipelined] = static_cast<double>(count) / writeEvents;
+		g_test_message("%s: %.1f reads and %.1f writes per connection interval", pipelined ? "pipelined" : "sequential",
+		               reads[pipelined], writes[pipelined]);
+	}
+
+	// A round trip takes two connection events
+	g_assert(reads[0] <= 0.5 && writes[0] <= 0.5);
+	g_assert(reads[1] > 10 * reads[0]);
+	// Eight credits allow eight Write Commands per connection event
+	g_assert(writes[1] > 7);
+}
+
+int main(int argc, char **argv)
+{
+	g_test_init(&argc, &argv, nullptr);
+
+	g_test_add_func("/gattrequest/read", test_gattrequest_read);
+	g_test_add_func("/gattrequest/write", test_gattrequest_write);
+	g_test_add_func("/gattrequest/long-write", test_gattrequest_long_write);
+	g_test_add_func("/gattrequest/long-write-deadline", test_gattrequest_long_write_deadline);
+	g_test_add_func("/gattrequest/link-defaults", test_gattrequest_link_defaults);
+	g_test_add_func("/gattrequest/deadlines", test_gattrequest_deadlines);
+	g_test_add_func("/gattrequest/throughput", test_gattrequest_throughput);
+
+	return g_test_run();
+}
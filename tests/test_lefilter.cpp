@@ -0,0 +1,479 @@
+// Copyright (c) 2026 LG Electronics, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include <glib.h>
+
+#include <cstdio>
+#include <map>
+
+#include "bluetooth-sil-api.h"
+
+static void append_structure(std::vector<uint8_t> &record, uint8_t type, const std::vector<uint8_t> &data)
+{
+	record.push_back(data.size() + 1);
+	record.push_back(type);
+	record.insert(record.end(), data.begin(), data.end());
+}
+
+static std::vector<uint8_t> create_advert(uint16_t serviceUuid, const std::string &name, uint16_t companyId,
+                                          const std::vector<uint8_t> &manufacturerData)
+{
+	std::vector<uint8_t> record;
+
+	append_structure(record, AdvertisingDataView::FLAGS, { 0x06 });
+	append_structure(record, AdvertisingDataView::COMPLETE_UUID16_LIST,
+	                 { (uint8_t) (serviceUuid & 0xff), (uint8_t) (serviceUuid >> 8) });
+	append_structure(record, AdvertisingDataView::COMPLETE_LOCAL_NAME, std::vector<uint8_t>(name.begin(), name.end()));
+
+	std::vector<uint8_t> data({ (uint8_t) (companyId & 0xff), (uint8_t) (companyId >> 8) });
+	data.insert(data.end(), manufacturerData.begin(), manufacturerData.end());
+	append_structure(record, AdvertisingDataView::MANUFACTURER_SPECIFIC_DATA, data);
+
+	append_structure(record, AdvertisingDataView::SERVICE_DATA_UUID16,
+	                 { (uint8_t) (serviceUuid & 0xff), (uint8_t) (serviceUuid >> 8), 0x42, 0x17 });
+
+	return record;
+}
+
+static std::vector<uint32_t> match(BluetoothLeFilterMatcher &matcher, const std::string &address,
+                                   const std::vector<uint8_t> &record)
+{
+	std::vector<uint32_t> scanIds;
+	matcher.match(address, AdvertisingDataView(record), scanIds);
+	return scanIds;
+}
+
+static void test_lefilter_criteria(void)
+{
+	BluetoothLeFilterMatcher matcher;
+	std::vector<uint8_t> advert = create_advert(0x180d, "HRM", 0x00c4, { 0x10, 0x20, 0x30 });
+
+	g_assert(match(matcher, "00:11:22:33:44:55", advert).empty());
+
+	BluetoothLeDiscoveryFilter all;
+	g_assert(matcher.add(1, all));
+
+	BluetoothLeDiscoveryFilter address;
+	address.setAddress("AA:bb:CC:dd:EE:ff");
+	g_assert(matcher.add(2, address));
+
+	BluetoothLeDiscoveryFilter name;
+	name.setName("HRM");
+	g_assert(matcher.add(3, name));
+
+	BluetoothLeDiscoveryFilter uuid;
+	BluetoothLeServiceUuid serviceUuid;
+	serviceUuid.setUuid("0000180d-0000-1000-8000-00805f9b34fb");
+	uuid.setServiceUuid(serviceUuid);
+	g_assert(matcher.add(4, uuid));
+
+	// Matches any 16 bit UUID of the 0x18xx range
+	BluetoothLeDiscoveryFilter maskedUuid;
+	serviceUuid.setUuid("1800");
+	serviceUuid.setMask("ffffff00-ffff-ffff-ffff-ffffffffffff");
+	maskedUuid.setServiceUuid(serviceUuid);
+	g_assert(matcher.add(5, maskedUuid));
+
+	BluetoothLeDiscoveryFilter manufacturer;
+	BluetoothManufacturerData manufacturerData;
+	manufacturerData.setId(0x00c4);
+	manufacturerData.setData({ 0x10, 0x2f });
+	manufacturerData.setMask({ 0xff, 0xf0 });
+	manufacturer.setManufacturerData(manufacturerData);
+	g_assert(matcher.add(6, manufacturer));
+
+	BluetoothLeDiscoveryFilter serviceData;
+	BluetoothLeServiceData data;
+	data.setUuid("180d");
+	data.setData({ 0x42 });
+	serviceData.setServiceData(data);
+	serviceData.setName("HRM");
+	g_assert(matcher.add(7, serviceData));
+
+	BluetoothLeDiscoveryFilter combined;
+	combined.setName("HRM");
+	combined.setAddress("00:11:22:33:44:55");
+	g_assert(matcher.add(8, combined));
+
+	g_assert(matcher.add(9, BluetoothBleDiscoveryUuidFilterList({ "180f", "180d" })));
+	g_assert(matcher.add(10, BluetoothBleDiscoveryUuidFilterList({ "180f" })));
+	g_assert(matcher.size() == 10);
+
+	g_assert(match(matcher, "00:11:22:33:44:55", advert) == std::vector<uint32_t>({ 1, 3, 4, 5, 6, 7, 8, 9 }));
+	g_assert(match(matcher, "aa:bb:cc:dd:ee:ff", advert) == std::vector<uint32_t>({ 1, 2, 3, 4, 5, 6, 7, 9 }));
+
+	std::vector<uint8_t> other = create_advert(0x2a00, "HRM2", 0x00c4, { 0x11, 0x20 });
+	g_assert(match(matcher, "00:11:22:33:44:55", other) == std::vector<uint32_t>({ 1 }));
+	g_assert(match(matcher, "invalid", other) == std::vector<uint32_t>({ 1 }));
+
+	// Replacing and removing filters recompiles the program
+	g_assert(matcher.add(10, BluetoothBleDiscoveryUuidFilterList({ "2a00" })));
+	g_assert(matcher.size() == 10);
+	g_assert(match(matcher, "00:11:22:33:44:55", other) == std::vector<uint32_t>({ 1, 10 }));
+	g_assert(matcher.remove(1));
+	g_assert(!matcher.remove(1));
+	g_assert(match(matcher, "00:11:22:33:44:55", other) == std::vector<uint32_t>({ 10 }));
+
+	BluetoothLeDiscoveryFilter invalid;
+	invalid.setAddress("00:11:22:33:44");
+	g_assert(!matcher.add(11, invalid));
+	g_assert(!matcher.add(11, BluetoothBleDiscoveryUuidFilterList({ "not a uuid" })));
+	g_assert(matcher.size() == 9);
+
+	matcher.clear();
+	g_assert(match(matcher, "00:11:22:33:44:55", advert).empty());
+
+	// Service data filters without data only need the UUID
+	BluetoothLeDiscoveryFilter uuidOnly;
+	BluetoothLeServiceData uuidOnlyData;
+	uuidOnlyData.setUuid("180d");
+	uuidOnly.setServiceData(uuidOnlyData);
+	g_assert(matcher.add(12, uuidOnly));
+	g_assert(match(matcher, "00:11:22:33:44:55", advert) == std::vector<uint32_t>({ 12 }));
+	g_assert(match(matcher, "00:11:22:33:44:55", other).empty());
+}
+
+static void test_lefilter_many(void)
+{
+	BluetoothLeFilterMatcher matcher;
+
+	// More filters than fit into a single bitset word
+	for (uint32_t n = 0; n < 200; n++)
+	{
+		BluetoothLeDiscoveryFilter filter;
+		BluetoothManufacturerData manufacturerData;
+		manufacturerData.setId(0x0100 + n);
+		manufacturerData.setData({ (uint8_t) n });
+		filter.setManufacturerData(manufacturerData);
+		g_assert(matcher.add(n + 1, filter));
+	}
+
+	std::vector<uint8_t> advert = create_advert(0x180d, "dev", 0x0100 + 150, { 150 });
+	g_assert(match(matcher, "00:11:22:33:44:55", advert) == std::vector<uint32_t>({ 151 }));
+
+	advert = create_advert(0x180d, "dev", 0x0100 + 150, { 151 });
+	g_assert(match(matcher, "00:11:22:33:44:55", advert).empty());
+}
+
+class RecordingObserver : public BluetoothAdapterStatusObserver
+{
+public:
+	void leDeviceFoundByScanId(uint32_t scanId, BluetoothPropertiesList properties)
+	{
+		found.push_back(scanId);
+	}
+
+	void leDeviceRemovedByScanId(uint32_t scanId, const std::string &address)
+	{
+		removed.push_back(scanId);
+	}
+
+	void leDevicePropertiesChangedByScanId(uint32_t scanId, const std::string &address,
+	                                       BluetoothPropertiesList properties)
+	{
+		changed.push_back(scanId);
+	}
+
+	std::vector<uint32_t> found;
+	std::vector<uint32_t> removed;
+	std::vector<uint32_t> changed;
+};
+
+class SharingObserver : public BluetoothAdapterStatusObserver
+{
+public:
+	void leDeviceFoundByScanIds(const std::vector<uint32_t> &scanIds, const BluetoothLeScanResultPtr &result)
+	{
+		for (uint32_t scanId : scanIds)
+			results[scanId] = result;
+	}
+
+	std::map<uint32_t, BluetoothLeScanResultPtr> results;
+};
+
+static BluetoothPropertiesList create_properties(const std::vector<uint8_t> &advert)
+{
+	BluetoothPropertiesList properties;
+	properties.push_back(BluetoothProperty(BluetoothProperty::Type::RSSI, -60));
+	properties.push_back(BluetoothProperty(BluetoothProperty::Type::SCAN_RECORD, advert));
+	return properties;
+}
+
+static void test_lefilter_dispatch(void)
+{
+	BluetoothLeScanDispatcher dispatcher;
+	RecordingObserver observer;
+	std::vector<uint8_t> advert = create_advert(0x180d, "HRM", 0x00c4, { 0x10 });
+
+	// Nothing is allocated or delivered without a matching scan
+	g_assert(!dispatcher.deviceFound(&observer, "00:11:22:33:44:55", create_properties(advert)));
+	g_assert(observer.found.empty());
+
+	g_assert(dispatcher.addScan(1, BluetoothBleDiscoveryUuidFilterList()));
+	g_assert(dispatcher.addScan(2, BluetoothBleDiscoveryUuidFilterList({ "180d" })));
+	g_assert(dispatcher.addScan(3, BluetoothBleDiscoveryUuidFilterList({ "180f" })));
+	BluetoothLeDiscoveryFilter filter;
+	filter.setName("HRM");
+	g_assert(dispatcher.addScan(4, filter));
+	g_assert(dispatcher.size() == 4);
+
+	// The default implementation falls back to the per scan callbacks
+	BluetoothLeScanResultPtr result = dispatcher.deviceFound(&observer, "00:11:22:33:44:55", create_properties(advert));
+	g_assert(result);
+	g_assert(result->getAddress() == "00:11:22:33:44:55");
+	g_assert(result->getProperties().size() == 2);
+	g_assert(observer.found == std::vector<uint32_t>({ 1, 2, 4 }));
+	g_assert(dispatcher.getMatchedScanIds() == observer.found);
+
+	g_assert(dispatcher.devicePropertiesChanged(&observer, "00:11:22:33:44:55", create_properties(advert)));
+	g_assert(observer.changed == std::vector<uint32_t>({ 1, 2, 4 }));
+
+	// Changes without a scan record reach all scans which found the device
+	BluetoothPropertiesList rssiOnly;
+	rssiOnly.push_back(BluetoothProperty(BluetoothProperty::Type::RSSI, -70));
+	observer.changed.clear();
+	g_assert(dispatcher.devicePropertiesChanged(&observer, "00:11:22:33:44:55", rssiOnly));
+	g_assert(observer.changed == std::vector<uint32_t>({ 1, 2, 4 }));
+
+	// Name changes are matched again together with the latest advertisement
+	BluetoothPropertiesList nameOnly;
+	nameOnly.push_back(BluetoothProperty(BluetoothProperty::Type::NAME, std::string("HRM")));
+	observer.changed.clear();
+	g_assert(dispatcher.devicePropertiesChanged(&observer, "00:11:22:33:44:55", nameOnly));
+	g_assert(observer.changed == std::vector<uint32_t>({ 1, 2, 4 }));
+
+	// A new advertisement and name change the matching scans
+	std::vector<uint8_t> battery = create_advert(0x180f, "BAT", 0x00c4, { 0x10 });
+	BluetoothPropertiesList batteryProperties = create_properties(battery);
+	batteryProperties.push_back(BluetoothProperty(BluetoothProperty::Type::NAME, std::string("BAT")));
+	observer.changed.clear();
+	g_assert(dispatcher.devicePropertiesChanged(&observer, "00:11:22:33:44:55", batteryProperties));
+	g_assert(observer.changed == std::vector<uint32_t>({ 1, 3 }));
+	observer.changed.clear();
+	g_assert(dispatcher.devicePropertiesChanged(&observer, "00:11:22:33:44:55", rssiOnly));
+	g_assert(observer.changed == std::vector<uint32_t>({ 1, 3 }));
+
+	// Only scans which found the device are told about its removal
+	dispatcher.deviceRemoved(&observer, "00:11:22:33:44:55");
+	g_assert(observer.removed == std::vector<uint32_t>({ 1, 3 }));
+	observer.removed.clear();
+	dispatcher.deviceRemoved(&observer, "00:11:22:33:44:55");
+	g_assert(observer.removed.empty());
+
+	g_assert(dispatcher.deviceFound(&observer, "00:11:22:33:44:55", create_properties(advert)));
+	g_assert(dispatcher.removeScan(2));
+	dispatcher.deviceRemoved(&observer, "00:11:22:33:44:55");
+	g_assert(observer.removed == std::vector<uint32_t>({ 1, 4 }));
+	g_assert(dispatcher.addScan(2, BluetoothBleDiscoveryUuidFilterList({ "180d" })));
+
+	// All matching scans share a single result
+	SharingObserver sharing;
+	g_assert(dispatcher.removeScan(1));
+	g_assert(!dispatcher.removeScan(1));
+	result = dispatcher.deviceFound(&sharing, "00:11:22:33:44:55", create_properties(advert));
+	g_assert(sharing.results.size() == 2);
+	g_assert(sharing.results[2] == result && sharing.results[4] == result);
+	g_assert(result.use_count() == 3);
+
+	// Devices are known by their address independent of the case, e.g. when
+	// BluetoothDeviceTable reports an eviction
+	observer.removed.clear();
+	g_assert(dispatcher.deviceFound(&observer, "AA:BB:CC:DD:EE:FF", create_properties(advert)));
+	dispatcher.deviceRemoved(&observer, BluetoothAddress("AA:BB:CC:DD:EE:FF").toString());
+	g_assert(observer.removed == std::vector<uint32_t>({ 4, 2 }));
+
+	dispatcher.clear();
+	g_assert(dispatcher.size() == 0);
+}
+
+static void test_lefilter_dispatch_properties(void)
+{
+	BluetoothLeScanDispatcher dispatcher;
+	RecordingObserver observer;
+
+	g_assert(dispatcher.addScan(1, BluetoothBleDiscoveryUuidFilterList({ "180f" })));
+	BluetoothLeDiscoveryFilter filter;
+	filter.setName("sensor");
+	g_assert(dispatcher.addScan(2, filter));
+	g_assert(dispatcher.addScan(3, BluetoothBleDiscoveryUuidFilterList({ "180d" })));
+
+	// Stacks may report the name and UUIDs without a scan record
+	BluetoothPropertiesList properties;
+	properties.push_back(BluetoothProperty(BluetoothProperty::Type::NAME, std::string("sensor")));
+	properties.push_back(BluetoothProperty(BluetoothProperty::Type::UUIDS, std::vector<std::string>({ "180f" })));
+	properties.push_back(BluetoothProperty(BluetoothProperty::Type::RSSI, -60));
+	g_assert(dispatcher.deviceFound(&observer, "00:11:22:33:44:55", properties));
+	g_assert(observer.found == std::vector<uint32_t>({ 1, 2 }));
+
+	// The cached name is kept when only the UUIDs change
+	BluetoothPropertiesList uuidsOnly;
+	uuidsOnly.push_back(BluetoothProperty(BluetoothProperty::Type::UUIDS,
+	                                      std::vector<std::string>({ "0000180d-0000-1000-8000-00805f9b34fb" })));
+	g_assert(dispatcher.devicePropertiesChanged(&observer, "00:11:22:33:44:55", uuidsOnly));
+	g_assert(observer.changed == std::vector<uint32_t>({ 2, 3 }));
+
+	dispatcher.deviceRemoved(&observer, "00:11:22:33:44:55");
+	g_assert(observer.removed == std::vector<uint32_t>({ 2, 3 }));
+}
+
+static void run_benchmark(int filterCount)
+{
+	BluetoothLeFilterMatcher matcher;
+
+	for (int n = 0; n < filterCount; n++)
+	{
+		BluetoothLeDiscoveryFilter filter;
+		BluetoothLeServiceUuid serviceUuid;
+		BluetoothManufacturerData manufacturerData;
+		char address[18];
+
+		switch (n % 4)
+		{
+		case 0:
+			snprintf(address, sizeof(address), "00:11:22:33:%02x:%02x", (n >> 8) & 0xff, n & 0xff);
+			filter.setAddress(address);
+			break;
+		case 1:
+			serviceUuid.setUuid(BluetoothUuid::fromUInt16(0x1800 + n).toString());
+			filter.setServiceUuid(serviceUuid);
+			break;
+		case 2:
+			manufacturerData.setId(0x0100 + n);
+			manufacturerData.setData({ (uint8_t) n, 0x00 });
+			manufacturerData.setMask({ 0xff, 0x00 });
+			filter.setManufacturerData(manufacturerData);
+			break;
+		default:
+			filter.setName("device-" + std::to_string(n));
+			break;
+		}
+
+		g_assert(matcher.add(n + 1, filter));
+	}
+
+	// Synthetic adverts of which some hit a filter
+	const int advertCount = 256;
+	std::vector<std::vector<uint8_t>> adverts;
+	std::vector<std::string> addresses;
+	for (int n = 0; n < advertCount; n++)
+	{
+		char address[18];
+		snprintf(address, sizeof(address), "00:11:22:33:%02x:%02x", (n >> 8) & 0xff, (n * 7) & 0xff);
+		addresses.push_back(address);
+		adverts.push_back(create_advert(0x1800 + n * 3, "device-" + std::to_string(n * 5), 0x0100 + n * 2, { (uint8_t) (n * 2), 0x55 }));
+	}
+
+	std::vector<uint32_t> scanIds;
+	const int iterations = 400000;
+	size_t matches = 0;
+
+	g_test_timer_start();
+
+	for (int n = 0; n < iterations; n++)
+	{
+		matcher.match(addresses[n % advertCount], AdvertisingDataView(adverts[n % advertCount]), scanIds);
+		matches += scanIds.size();
+	}
+
+	double elapsed = g_test_timer_elapsed();
+
+	g_test_minimized_result(elapsed, "matched %d adverts against %d filters in %.3f s (%zu matches)",
+	                        iterations, filterCount, elapsed, matches);
+	g_test_maximized_result(iterations / elapsed, "%.0f adverts/s with %d filters", iterations / elapsed, filterCount);
+}
+
+static void test_lefilter_throughput(void)
+{
+	if (!g_test_perf())
+		return;
+
+	run_benchmark(1);
+	run_benchmark(32);
+	run_benchmark(512);
+}
+
+class CountingObserver : public BluetoothAdapterStatusObserver
+{
+public:
+	CountingObserver() : deliveries(0) { }
+
+	void leDeviceFoundByScanId(uint32_t scanId, BluetoothPropertiesList properties)
+	{
+		deliveries += properties.size();
+	}
+
+	size_t deliveries;
+};
+
+class SharedCountingObserver : public CountingObserver
+{
+public:
+	void leDeviceFoundByScanIds(const std::vector<uint32_t> &scanIds, const BluetoothLeScanResultPtr &result)
+	{
+		deliveries += scanIds.size() * result->getProperties().size();
+	}
+};
+
+static double run_fanout(BluetoothAdapterStatusObserver *observer, int scanCount)
+{
+	BluetoothLeScanDispatcher dispatcher;
+	for (int n = 0; n < scanCount; n++)
+		dispatcher.addScan(n + 1, BluetoothBleDiscoveryUuidFilterList({ "180d" }));
+
+	std::vector<uint8_t> advert = create_advert(0x180d, "HRM", 0x00c4, { 0x10, 0x20, 0x30 });
+	BluetoothPropertiesList properties = create_properties(advert);
+	properties.push_back(BluetoothProperty(BluetoothProperty::Type::NAME, std::string("HRM")));
+
+	const int iterations = 200000;
+
+	g_test_timer_start();
+
+	for (int n = 0; n < iterations; n++)
+		dispatcher.deviceFound(observer, "00:11:22:33:44:55", properties);
+
+	return iterations / g_test_timer_elapsed();
+}
+
+static void test_lefilter_fanout_throughput(void)
+{
+	if (!g_test_perf())
+		return;
+
+	const int scanCount = 16;
+	CountingObserver legacy;
+	SharedCountingObserver shared;
+
+	double legacyRate = run_fanout(&legacy, scanCount);
+	double sharedRate = run_fanout(&shared, scanCount);
+	g_assert(legacy.deliveries == shared.deliveries);
+
+	g_test_maximized_result(legacyRate, "%.0f adverts/s to %d scans with per scan copies", legacyRate, scanCount);
+	g_test_maximized_result(sharedRate, "%.0f adverts/s to %d scans with a shared result", sharedRate, scanCount);
+}
+
+int main(int argc, char **argv)
+{
+	g_test_init(&argc, &argv, nullptr);
+
+	g_test_add_func("/lefilter/criteria", test_lefilter_criteria);
+	g_test_add_func("/lefilter/many", test_lefilter_many);
+	g_test_add_func("/lefilter/dispatch", test_lefilter_dispatch);
+	g_test_add_func("/lefilter/dispatch-properties", test_lefilter_dispatch_properties);
+	g_test_add_func("/lefilter/throughput", test_lefilter_throughput);
+	g_test_add_func("/lefilter/fanout-throughput", test_lefilter_fanout_throughput);
+
+	return g_test_run();
+}
@@ -0,0 +1,302 @@
+// Copyright (c) 2026 LG Electronics, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include <glib.h>
+
+#include <map>
+
+#include "bluetooth-sil-api.h"
+
+typedef std::map<std::string, std::vector<std::string>> MessageTypeMap;
+
+static void test_property_values(void)
+{
+	BluetoothProperty name(BluetoothProperty::Type::NAME, std::string("Test device"));
+	g_assert(name.getType() == BluetoothProperty::Type::NAME);
+	g_assert(name.getValue<std::string>() == "Test device");
+
+	BluetoothProperty cod(BluetoothProperty::Type::CLASS_OF_DEVICE, (uint32_t) 0x240404);
+	g_assert(cod.getValue<uint32_t>() == 0x240404);
+
+	BluetoothProperty rssi(BluetoothProperty::Type::RSSI, -67);
+	g_assert(rssi.getValue<int>() == -67);
+
+	BluetoothProperty paired(BluetoothProperty::Type::PAIRED, true);
+	g_assert(paired.getValue<bool>());
+
+	BluetoothProperty scanRecord(BluetoothProperty::Type::SCAN_RECORD, std::vector<uint8_t>({ 0x02, 0x01, 0x06 }));
+	g_assert(scanRecord.getValue<std::vector<uint8_t>>() == std::vector<uint8_t>({ 0x02, 0x01, 0x06 }));
+
+	BluetoothProperty uuids(BluetoothProperty::Type::UUIDS, std::vector<std::string>({ "1101", "110a" }));
+	g_assert(uuids.getValue<std::vector<std::string>>().size() == 2);
+
+	// Reads hand out a reference to the stored value
+	g_assert(&name.getValue<std::string>() == &name.getValue<std::string>());
+
+	name.setValue<uint32_t>(5);
+	g_assert(name.getValue<uint32_t>() == 5);
+}
+
+static void test_property_type_mismatch(void)
+{
+	BluetoothProperty rssi(BluetoothProperty::Type::RSSI, -67);
+	bool thrown = false;
+
+	try
+	{
+		rssi.getValue<uint32_t>();
+	}
+	catch (const std::logic_error &)
+	{
+		thrown = true;
+	}
+
+	g_assert(thrown);
+
+	thrown = false;
+
+	try
+	{
+		BluetoothProperty().getValue<std::string>();
+	}
+	catch (const std::logic_error &)
+	{
+		thrown = true;
+	}
+
+	g_assert(thrown);
+}
+
+static void test_property_other_types(void)
+{
+	MessageTypeMap types;
+	types["MAS0"] = { "EMAIL", "SMS_GSM" };
+
+	BluetoothProperty messageTypes(BluetoothProperty::Type::MAP_SUPPORTED_MESSAGE_TYPE, types);
+	g_assert(messageTypes.getValue<MessageTypeMap>() == types);
+
+	BluetoothProperty deviceType(BluetoothProperty::Type::TYPE_OF_DEVICE, BLUETOOTH_DEVICE_TYPE_BLE);
+	g_assert(deviceType.getValue<BluetoothDeviceType>() == BLUETOOTH_DEVICE_TYPE_BLE);
+
+	bool thrown = false;
+
+	try
+	{
+		deviceType.getValue<BluetoothDeviceRole>();
+	}
+	catch (const std::logic_error &)
+	{
+		thrown = true;
+	}
+
+	g_assert(thrown);
+}
+
+static void test_property_copy(void)
+{
+	BluetoothPropertiesList properties;
+	properties.push_back(BluetoothProperty(BluetoothProperty::Type::BDADDR, std::string("00:11:22:33:44:55")));
+	properties.push_back(BluetoothProperty(BluetoothProperty::Type::RSSI, -42));
+	properties.push_back(BluetoothProperty(BluetoothProperty::Type::MAP_INSTANCES_NAME, std::vector<std::string>({ "MAS0" })));
+
+	BluetoothPropertiesList copy = properties;
+	properties.clear();
+
+	g_assert(copy[0].getValue<std::string>() == "00:11:22:33:44:55");
+	g_assert(copy[1].getValue<int>() == -42);
+	g_assert(copy[2].getValue<std::vector<std::string>>().at(0) == "MAS0");
+
+	BluetoothProperty assigned;
+	assigned = copy[0];
+	assigned = assigned;
+	g_assert(assigned.getType() == BluetoothProperty::Type::BDADDR);
+	g_assert(assigned.getValue<std::string>() == "00:11:22:33:44:55");
+
+	assigned = BluetoothProperty(BluetoothProperty::Type::PAIRED);
+	g_assert(assigned.getType() == BluetoothProperty::Type::PAIRED);
+}
+
+static void test_property_bag(void)
+{
+	BluetoothPropertiesList properties;
+	properties.push_back(BluetoothProperty(BluetoothProperty::Type::NAME, std::string("first")));
+	properties.push_back(BluetoothProperty(BluetoothProperty::Type::EMPTY));
+	properties.push_back(BluetoothProperty(BluetoothProperty::Type::RSSI, -60));
+	properties.push_back(BluetoothProperty(BluetoothProperty::Type::PAIRED, true));
+	properties.push_back(BluetoothProperty(BluetoothProperty::Type::NAME, std::string("second")));
+
+	BluetoothPropertyBag bag(properties);
+
+	g_assert(bag.size() == 3);
+	g_assert(!bag.has(BluetoothProperty::Type::EMPTY));
+	g_assert(!bag.has(BluetoothProperty::Type::BDADDR));
+	g_assert(bag.find(BluetoothProperty::Type::BDADDR) == nullptr);
+	g_assert(bag.has(BluetoothProperty::Type::RSSI));
+	g_assert(bag.find(BluetoothProperty::Type::NAME)->getValue<std::string>() == "second");
+	g_assert(bag.getValue<int>(BluetoothProperty::Type::RSSI, 0) == -60);
+	g_assert(bag.getValue<int>(BluetoothProperty::Type::TXPOWER, 7) == 7);
+	g_assert(bag.getMask() == ((1ULL << BluetoothProperty::Type::NAME) |
+	                           (1ULL << BluetoothProperty::Type::RSSI) |
+	                           (1ULL << BluetoothProperty::Type::PAIRED)));
+
+	// Erasing keeps the remaining properties reachable and densely stored
+	g_assert(bag.erase(BluetoothProperty::Type::NAME));
+	g_assert(!bag.erase(BluetoothProperty::Type::NAME));
+	g_assert(bag.size() == 2);
+	g_assert(bag.find(BluetoothProperty::Type::PAIRED)->getValue<bool>());
+	g_assert(bag.find(BluetoothProperty::Type::RSSI)->getValue<int>() == -60);
+
+	bag.set(BluetoothProperty(BluetoothProperty::Type::RSSI, -70));
+	bag.set(BluetoothProperty(BluetoothProperty::Type::BDADDR, std::string("00:11:22:33:44:55")));
+	g_assert(bag.size() == 3);
+
+	int count = 0;
+	for (auto &property : bag)
+	{
+		g_assert(bag.find(property.getType()) == &property);
+		count++;
+	}
+	g_assert(count == 3);
+
+	const BluetoothPropertiesList &list = bag;
+	g_assert(list.size() == 3);
+	g_assert(BluetoothPropertyBag(list).getValue<int>(BluetoothProperty::Type::RSSI, 0) == -70);
+
+	bag.clear();
+	g_assert(bag.empty());
+	g_assert(bag.getMask() == 0);
+	g_assert(!bag.has(BluetoothProperty::Type::RSSI));
+}
+
+static void test_property_equality(void)
+{
+	BluetoothProperty name(BluetoothProperty::Type::NAME, std::string("device"));
+	BluetoothProperty alias(BluetoothProperty::Type::ALIAS, std::string("device"));
+
+	g_assert(name == BluetoothProperty(BluetoothProperty::Type::NAME, std::string("device")));
+	g_assert(name != BluetoothProperty(BluetoothProperty::Type::NAME, std::string("other")));
+	g_assert(name != alias);
+	g_assert(BluetoothProperty(BluetoothProperty::Type::RSSI, -50) != BluetoothProperty(BluetoothProperty::Type::RSSI, -51));
+	g_assert(BluetoothProperty(BluetoothProperty::Type::PAIRED) == BluetoothProperty(BluetoothProperty::Type::PAIRED));
+
+	// Equal properties have equal hashes
+	g_assert(name.hash() == BluetoothProperty(BluetoothProperty::Type::NAME, std::string("device")).hash());
+	g_assert(name.hash() != alias.hash());
+	g_assert(BluetoothProperty(BluetoothProperty::Type::UUIDS, std::vector<std::string>({ "ab", "c" })).hash() !=
+	         BluetoothProperty(BluetoothProperty::Type::UUIDS, std::vector<std::string>({ "a", "bc" })).hash());
+
+	// Values of other types only compare equal when shared
+	BluetoothProperty types(BluetoothProperty::Type::MAP_SUPPORTED_MESSAGE_TYPE, MessageTypeMap());
+	BluetoothProperty copy(types);
+	g_assert(types == copy);
+	g_assert(types.hash() == copy.hash());
+	g_assert(types != BluetoothProperty(BluetoothProperty::Type::MAP_SUPPORTED_MESSAGE_TYPE, MessageTypeMap()));
+}
+
+class DeltaObserver : public BluetoothAdapterStatusObserver
+{
+public:
+	DeltaObserver() : calls(0) { }
+
+	void devicePropertiesChanged(const std::string &address, BluetoothPropertiesList properties)
+	{
+		calls++;
+		lastAddress = address;
+		lastProperties = properties;
+	}
+
+	int calls;
+	std::string lastAddress;
+	BluetoothPropertiesList lastProperties;
+};
+
+static void test_property_delta(void)
+{
+	BluetoothDeviceStateCache cache;
+	BluetoothPropertiesDelta delta;
+
+	BluetoothPropertiesList found;
+	found.push_back(BluetoothProperty(BluetoothProperty::Type::NAME, std::string("sensor")));
+	found.push_back(BluetoothProperty(BluetoothProperty::Type::RSSI, -60));
+	found.push_back(BluetoothProperty(BluetoothProperty::Type::PAIRED, false));
+
+	g_assert(cache.update("00:11:22:33:44:55", found, delta));
+	g_assert(delta.getChanged().size() == 3);
+	g_assert(cache.size() == 1);
+
+	// Repeating the same values doesn't produce a delta
+	g_assert(!cache.update("00:11:22:33:44:55", found, delta));
+	g_assert(delta.empty());
+	g_assert(delta.getChangedMask() == 0);
+
+	BluetoothPropertiesList update;
+	update.push_back(BluetoothProperty(BluetoothProperty::Type::NAME, std::string("sensor")));
+	update.push_back(BluetoothProperty(BluetoothProperty::Type::RSSI, -72));
+	update.push_back(BluetoothProperty(BluetoothProperty::Type::EMPTY));
+
+	g_assert(cache.update("00:11:22:33:44:55", update, delta));
+	g_assert(delta.getChangedMask() == (1ULL << BluetoothProperty::Type::RSSI));
+	g_assert(delta.hasChanged(BluetoothProperty::Type::RSSI));
+	g_assert(!delta.hasChanged(BluetoothProperty::Type::NAME));
+	g_assert(delta.getValue<int>(BluetoothProperty::Type::RSSI, 0) == -72);
+
+	const BluetoothPropertyBag *state = cache.find("00:11:22:33:44:55");
+	g_assert(state != nullptr);
+	g_assert(state->size() == 3);
+	g_assert(state->getValue<int>(BluetoothProperty::Type::RSSI, 0) == -72);
+	g_assert(cache.find("66:77:88:99:aa:bb") == nullptr);
+
+	// Observers which don't handle deltas get the changed properties only
+	DeltaObserver observer;
+	BluetoothAdapterStatusObserver *base = &observer;
+	base->devicePropertiesDelta("00:11:22:33:44:55", delta);
+	g_assert(observer.calls == 1);
+	g_assert(observer.lastAddress == "00:11:22:33:44:55");
+	g_assert(observer.lastProperties.size() == 1);
+	g_assert(observer.lastProperties[0].getValue<int>() == -72);
+
+	// A removed device is reported completely again
+	g_assert(cache.remove("00:11:22:33:44:55"));
+	g_assert(!cache.remove("00:11:22:33:44:55"));
+	g_assert(cache.update("00:11:22:33:44:55", update, delta));
+	g_assert(delta.getChanged().size() == 2);
+
+	// Addresses are compared in their packed form
+	g_assert(cache.find("00:11:22:33:44:55") == cache.find(BluetoothAddress("00:11:22:33:44:55")));
+	g_assert(!cache.update("00:11:22:33:44:55", update, delta));
+	g_assert(!cache.update(BluetoothAddress(0x001122334455ULL), update, delta));
+
+	// Updates of malformed addresses are reported completely and not cached
+	g_assert(cache.update("invalid", update, delta));
+	g_assert(cache.update("invalid", update, delta));
+	g_assert(delta.getChanged().size() == 2);
+	g_assert(cache.size() == 1);
+}
+
+int main(int argc, char **argv)
+{
+	g_test_init(&argc, &argv, nullptr);
+
+	g_test_add_func("/properties/values", test_property_values);
+	g_test_add_func("/properties/type-mismatch", test_property_type_mismatch);
+	g_test_add_func("/properties/other-types", test_property_other_types);
+	g_test_add_func("/properties/copy", test_property_copy);
+	g_test_add_func("/properties/bag", test_property_bag);
+	g_test_add_func("/properties/equality", test_property_equality);
+	g_test_add_func("/properties/delta", test_property_delta);
+
+	return g_test_run();
+}
@@ -0,0 +1,142 @@
+// Copyright (c) 2026 LG Electronics, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include <glib.h>
+
+#include <cmath>
+
+#include "bluetooth-sil-api.h"
+
+static void test_proximity_filter(void)
+{
+	BluetoothRssiFilter filter;
+	g_assert(!filter.hasSamples());
+
+	g_assert(filter.addSample(-60) == -60);
+	g_assert(filter.hasSamples());
+
+	// A single spike is removed by the median of the window
+	for (int n = 0; n < 6; n++)
+		filter.addSample(-60);
+	g_assert(filter.addSample(-20) == -60);
+
+	// A real change is followed
+	for (int n = 0; n < 20; n++)
+		filter.addSample(-80);
+	g_assert(fabs(filter.getRssi() + 80) < 1);
+
+	filter.reset();
+	g_assert(!filter.hasSamples());
+	g_assert(filter.addSample(-40) == -40);
+}
+
+static void test_proximity_noise(void)
+{
+	GRand *rand = g_rand_new_with_seed(0x7551);
+	BluetoothRssiFilter filter;
+	double rawError = 0;
+	double smoothedError = 0;
+
+	// Gaussian-ish noise of a few dB around -70 dBm with occasional deep fades
+	for (int n = 0; n < 2000; n++)
+	{
+		int noise = g_rand_int_range(rand, -3, 4) + g_rand_int_range(rand, -3, 4);
+		if (g_rand_int_range(rand, 0, 20) == 0)
+			noise -= 15;
+
+		int sample = -70 + noise;
+		double smoothed = filter.addSample(sample);
+
+		if (n >= 100)
+		{
+			rawError += fabs(sample + 70);
+			smoothedError += fabs(smoothed + 70);
+		}
+	}
+
+	g_rand_free(rand);
+
+	g_test_message("mean error raw %.2f dB, smoothed %.2f dB", rawError / 1900, smoothedError / 1900);
+	g_assert(smoothedError * 3 < rawError);
+}
+
+static BluetoothPropertiesList create_report(int rssi, int txPower)
+{
+	BluetoothPropertiesList properties;
+	properties.push_back(BluetoothProperty(BluetoothProperty::Type::NAME, std::string("beacon")));
+	properties.push_back(BluetoothProperty(BluetoothProperty::Type::RSSI, rssi));
+	if (txPower != 127)
+		properties.push_back(BluetoothProperty(BluetoothProperty::Type::TXPOWER, txPower));
+	return properties;
+}
+
+static void test_proximity_tracker(void)
+{
+	BluetoothProximityTracker tracker;
+	const std::string address = "00:11:22:33:44:55";
+	double rssi = 0;
+	double distance = 0;
+
+	g_assert(!tracker.getRssi(address, rssi));
+	g_assert(!tracker.getDistance(address, distance));
+
+	BluetoothPropertiesList name;
+	name.push_back(BluetoothProperty(BluetoothProperty::Type::NAME, std::string("beacon")));
+	g_assert(!tracker.apply(address, name));
+	g_assert(tracker.size() == 0);
+
+	// The RSSI is replaced by the smoothed value
+	BluetoothPropertiesList report = create_report(-61, 127);
+	g_assert(tracker.apply(address, report));
+	g_assert(report[1].getValue<int>() == -61);
+	g_assert(tracker.getRssi(address, rssi) && rssi == -61);
+	g_assert(!tracker.getDistance(address, distance));
+
+	report = create_report(-100, 127);
+	g_assert(tracker.apply(address, report));
+	g_assert(report[1].getValue<int>() > -100);
+
+	// With the TX power known the distance follows the path loss model
+	tracker.clear();
+	report = create_report(-41, 0);
+	g_assert(tracker.apply(address, report));
+	g_assert(tracker.getDistance(address, distance));
+	g_assert(fabs(distance - 1) < 0.001);
+
+	g_assert(fabs(tracker.estimateDistance(-61, 0) - 10) < 0.001);
+	BluetoothProximityTracker indoor(3.0);
+	g_assert(fabs(indoor.estimateDistance(-71, 0) - 10) < 0.001);
+
+	// The TX power is remembered if only the RSSI is reported
+	report = create_report(-41, 127);
+	g_assert(tracker.apply(address, report));
+	g_assert(tracker.getDistance(address, distance));
+
+	g_assert(tracker.remove(address));
+	g_assert(!tracker.remove(address));
+	g_assert(!tracker.getRssi(address, rssi));
+}
+
+int main(int argc, char **argv)
+{
+	g_test_init(&argc, &argv, nullptr);
+
+	g_test_add_func("/proximity/filter", test_proximity_filter);
+	g_test_add_func("/proximity/noise", test_proximity_noise);
+	g_test_add_func("/proximity/tracker", test_proximity_tracker);
+
+	return g_test_run();
+}
@@ -0,0 +1,137 @@
+// Copyright (c) 2026 LG Electronics, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include <glib.h>
+
+#include <cstdio>
+
+#include "bluetooth-sil-api.h"
+
+static BluetoothPropertiesList create_report(int rssi, const std::vector<uint8_t> &scanRecord)
+{
+	BluetoothPropertiesList properties;
+	properties.push_back(BluetoothProperty(BluetoothProperty::Type::RSSI, rssi));
+	properties.push_back(BluetoothProperty(BluetoothProperty::Type::SCAN_RECORD, scanRecord));
+	properties.push_back(BluetoothProperty(BluetoothProperty::Type::NAME, std::string("sensor")));
+	return properties;
+}
+
+static void test_scandedup_report(void)
+{
+	BluetoothLeScanDeduplicator dedup(100, 5);
+	const std::string address = "00:11:22:33:44:55";
+	std::vector<uint8_t> record = { 0x02, 0x01, 0x06 };
+
+	// The first report of a device always passes
+	g_assert(dedup.shouldReport(address, create_report(-60, record), 1000));
+	g_assert(dedup.size() == 1);
+
+	// Repetitions with small RSSI changes are dropped
+	g_assert(!dedup.shouldReport(address, create_report(-60, record), 1010));
+	g_assert(!dedup.shouldReport(address, create_report(-63, record), 2000));
+
+	// Larger RSSI changes are reported but not within the minimum interval
+	g_assert(!dedup.shouldReport(address, create_report(-70, record), 1050));
+	g_assert(dedup.shouldReport(address, create_report(-70, record), 1100));
+	g_assert(!dedup.shouldReport(address, create_report(-66, record), 1300));
+
+	// Payload changes are reported once the interval has elapsed
+	std::vector<uint8_t> changed = { 0x02, 0x01, 0x04 };
+	g_assert(!dedup.shouldReport(address, create_report(-70, changed), 1150));
+	g_assert(dedup.shouldReport(address, create_report(-70, changed), 1300));
+	g_assert(!dedup.shouldReport(address, create_report(-70, changed), 5000));
+
+	// The order of the properties doesn't matter
+	BluetoothPropertiesList reversed = create_report(-70, changed);
+	std::reverse(reversed.begin(), reversed.end());
+	g_assert(!dedup.shouldReport(address, reversed, 6000));
+
+	// Devices are tracked separately
+	g_assert(dedup.shouldReport("00:11:22:33:44:66", create_report(-70, changed), 6000));
+	g_assert(dedup.size() == 2);
+
+	g_assert(dedup.getReportedCount() == 4);
+	g_assert(dedup.getSuppressedCount() == 7);
+
+	g_assert(dedup.remove(address));
+	g_assert(!dedup.remove(address));
+	g_assert(dedup.shouldReport(address, create_report(-70, changed), 6001));
+
+	dedup.clear();
+	g_assert(dedup.size() == 0);
+	g_assert(dedup.getReportedCount() == 0 && dedup.getSuppressedCount() == 0);
+
+	// Without an interval and threshold only exact repetitions are dropped
+	dedup.setMinReportInterval(0);
+	dedup.setRssiThreshold(1);
+	g_assert(dedup.shouldReport(address, create_report(-70, record), 0));
+	g_assert(!dedup.shouldReport(address, create_report(-70, record), 0));
+	g_assert(dedup.shouldReport(address, create_report(-71, record), 0));
+}
+
+static void test_scandedup_throughput(void)
+{
+	if (!g_test_perf())
+		return;
+
+	GRand *rand = g_rand_new_with_seed(0xd3d0);
+	BluetoothLeScanDeduplicator dedup;
+
+	// 200 devices advertising every 100 ms with jittering RSSI for a minute of
+	// simulated time. Every 50th report carries a new payload.
+	const int deviceCount = 200;
+	const int reports = deviceCount * 10 * 60;
+	std::vector<std::string> addresses;
+	for (int n = 0; n < deviceCount; n++)
+	{
+		char address[18];
+		snprintf(address, sizeof(address), "00:11:22:33:%02x:%02x", n >> 8, n & 0xff);
+		addresses.push_back(address);
+	}
+
+	std::vector<BluetoothPropertiesList> input;
+	for (int n = 0; n < reports; n++)
+	{
+		int device = n % deviceCount;
+		uint8_t counter = (n / deviceCount) / 50;
+		input.push_back(create_report(-60 - device % 30 + g_rand_int_range(rand, -4, 5),
+		                              { 0x02, 0x01, 0x06, 0x03, 0xff, (uint8_t) device, counter }));
+	}
+
+	g_test_timer_start();
+
+	for (int n = 0; n < reports; n++)
+		dedup.shouldReport(addresses[n % deviceCount], input[n], (uint64_t) n * 100 / deviceCount);
+
+	double elapsed = g_test_timer_elapsed();
+	g_rand_free(rand);
+
+	g_assert(dedup.getReportedCount() + dedup.getSuppressedCount() == (uint64_t) reports);
+
+	g_test_minimized_result(dedup.getReportedCount(), "%llu of %d reports passed on",
+	                        (unsigned long long) dedup.getReportedCount(), reports);
+	g_test_maximized_result(reports / elapsed, "%.0f reports/s", reports / elapsed);
+}
+
+int main(int argc, char **argv)
+{
+	g_test_init(&argc, &argv, nullptr);
+
+	g_test_add_func("/scandedup/report", test_scandedup_report);
+	g_test_add_func("/scandedup/throughput", test_scandedup_throughput);
+
+	return g_test_run();
+}
@@ -16,8 +16,11 @@
 
 #include <glib.h>
 
+#include <algorithm>
+#include <cstring>
 #include <iostream>
 #include <typeinfo>
+#include <map>
 #include <unordered_map>
 
 #include "bluetooth-sil-api.h"
@@ -111,11 +114,310 @@ static void test_uuid_comparison(void)
 	g_assert(!(uuid != "abc3fff0-c71f-11e4-8731-1681e6b88ec1"));
 }
 
+static void test_uuid_to_string(void)
+{
+	g_assert(BluetoothUuid("1eef").toString() == "1eef");
+	g_assert(BluetoothUuid("11dd3344").toString() == "11dd3344");
+	g_assert(BluetoothUuid("abc3fff0-c71f-11e4-8731-1681e6b88ec1").toString() == "abc3fff0-c71f-11e4-8731-1681e6b88ec1");
+	g_assert(BluetoothUuid("ABC3FFF0-C71F-11E4-8731-1681E6B88EC1").toString() == "abc3fff0-c71f-11e4-8731-1681e6b88ec1");
+
+	// Input which can't be parsed is handed back unchanged
+	g_assert(BluetoothUuid("0").toString() == "0");
+	g_assert(BluetoothUuid().toString() == "");
+
+	BluetoothUuid copy;
+	copy = BluetoothUuid("abc3fff0-c71f-11e4-8731-1681e6b88ec1");
+	g_assert(copy.getMostSignificantBits() == 0xabc3fff0c71f11e4ULL);
+	g_assert(copy.getLeastSignificantBits() == 0x87311681e6b88ec1ULL);
+}
+
+static void test_uuid_base_uuid(void)
+{
+	BluetoothUuid uuid16("180f");
+	BluetoothUuid uuid32("0000180f");
+	BluetoothUuid uuid128("0000180f-0000-1000-8000-00805f9b34fb");
+
+	g_assert(uuid16 == uuid128);
+	g_assert(uuid32 == uuid128);
+	g_assert(uuid16 == uuid32);
+	g_assert(!(uuid16 < uuid128) && !(uuid128 < uuid16));
+	g_assert(uuid16 == "0000180F-0000-1000-8000-00805F9B34FB");
+	g_assert(uuid16 != BluetoothUuid("0000180f-0000-1000-8000-00805f9b34fc"));
+
+	// Every representation keeps its own format
+	g_assert(uuid16.toString() == "180f");
+	g_assert(uuid32.toString() == "0000180f");
+	g_assert(uuid128.toString() == "0000180f-0000-1000-8000-00805f9b34fb");
+
+	std::hash<BluetoothUuid> hasher;
+	g_assert(hasher(uuid16) == hasher(uuid128));
+
+	std::unordered_map<BluetoothUuid, int> map;
+	map.insert({ uuid128, 10 });
+	g_assert(map.find(uuid16) != map.end());
+
+	std::map<BluetoothUuid, int> ordered;
+	ordered[uuid16] = 1;
+	ordered[uuid128] = 2;
+	g_assert(ordered.size() == 1);
+}
+
+static void test_uuid_strict_hex(void)
+{
+	// Alpha-numeric characters which aren't hex digits are rejected
+	g_assert(!BluetoothUuid("zzzz").isValid());
+	g_assert(!BluetoothUuid("1eeg").isValid());
+	g_assert(!BluetoothUuid("11dd334z").isValid());
+	g_assert(!BluetoothUuid("-1eef").isValid());
+
+	const std::string valid = "abc3fff0-c71f-11e4-8731-1681e6b88ec1";
+	const char invalidChars[] = { 'g', 'z', 'G', 'Z', ' ', '/', ':', '@', '`', '-', '\x80', '\xff', '\0' };
+
+	g_assert(BluetoothUuid(valid).isValid());
+
+	for (size_t pos = 0; pos < valid.length(); pos++)
+	{
+		for (char c : invalidChars)
+		{
+			if (valid[pos] == '-' && c == '-')
+				continue;
+
+			std::string uuid = valid;
+			uuid[pos] = c;
+			g_assert(!BluetoothUuid(uuid).isValid());
+		}
+	}
+}
+
+static void test_uuid_decode_128(void)
+{
+	static const char hexDigits[] = "0123456789abcdef0123456789ABCDEF";
+	GRand *rand = g_rand_new_with_seed(0x1eef);
+
+	for (int iteration = 0; iteration < 10000; iteration++)
+	{
+		uint8_t bytes[16];
+		std::string uuid;
+
+		for (int n = 0; n < 16; n++)
+		{
+			bytes[n] = static_cast<uint8_t>(g_rand_int_range(rand, 0, 256));
+
+			if (n == 4 || n == 6 || n == 8 || n == 10)
+				uuid += '-';
+
+			// Randomly mix upper and lower case digits
+			int upper = g_rand_boolean(rand) ? 16 : 0;
+			uuid += hexDigits[(bytes[n] >> 4) + upper];
+			uuid += hexDigits[(bytes[n] & 0xf) + upper];
+		}
+
+		BluetoothUuid parsed(uuid);
+		g_assert(parsed.getType() == BluetoothUuid::UUID128);
+
+		uint128_t value = parsed.toUInt128();
+		g_assert(memcmp(value.data, bytes, sizeof(bytes)) == 0);
+
+		std::string lower = uuid;
+		std::transform(lower.begin(), lower.end(), lower.begin(), ::tolower);
+		g_assert(parsed.toString() == lower);
+	}
+
+	g_rand_free(rand);
+}
+
+static void test_uuid_parse_throughput(void)
+{
+	if (!g_test_perf())
+		return;
+
+	const std::string input[] = {
+		"abc3fff0-c71f-11e4-8731-1681e6b88ec1",
+		"0000180F-0000-1000-8000-00805F9B34FB",
+		"6b504fa0-c71f-11e4-8731-1681e6b88ec1",
+		"852c02ec-c720-11e4-8731-1681e6b88ec1"
+	};
+	const int iterations = 4000000;
+	uint64_t sum = 0;
+
+	g_test_timer_start();
+
+	for (int n = 0; n < iterations; n++)
+	{
+		BluetoothUuid uuid(input[n & 3]);
+		sum += uuid.getLeastSignificantBits();
+	}
+
+	double elapsed = g_test_timer_elapsed();
+	g_assert(sum != 0);
+
+	g_test_minimized_result(elapsed, "parsed %d 128 bit UUIDs in %.3f s", iterations, elapsed);
+	g_test_maximized_result(iterations / elapsed, "%.0f UUIDs/s", iterations / elapsed);
+}
+
+static_assert(getBluetoothSigUuidName(0x2902) != nullptr, "CCCD is part of the assigned numbers table");
+
+static const char* dispatch(const BluetoothUuid &uuid)
+{
+	switch (uuid.toShortUuid())
+	{
+	case BLUETOOTH_UUID_BATTERY_SERVICE:
+		return "battery";
+	case BLUETOOTH_UUID_CLIENT_CHARACTERISTIC_CONFIGURATION:
+		return "cccd";
+	default:
+		return "other";
+	}
+}
+
+static void test_uuid_constexpr(void)
+{
+	const BluetoothUuid batteryService = BluetoothUuid::fromUInt16(BLUETOOTH_UUID_BATTERY_SERVICE);
+	g_assert(batteryService.getType() == BluetoothUuid::UUID16);
+	g_assert(batteryService.toShortUuid() == 0x180f);
+	g_assert(BluetoothUuid(0x0000180f00001000ULL, 0x800000805f9b34fbULL).isBaseUuid());
+	g_assert(!BluetoothUuid(0xabc3fff0c71f11e4ULL, 0x87311681e6b88ec1ULL).isBaseUuid());
+
+	g_assert(batteryService == BluetoothUuid("180f"));
+	g_assert(batteryService == BluetoothUuid("0000180f-0000-1000-8000-00805f9b34fb"));
+	g_assert(batteryService.toString() == "180f");
+	g_assert(BluetoothUuid::fromUInt32(0x11dd3344).toString() == "11dd3344");
+	g_assert(BluetoothUuid::fromUInt32(0x11dd3344).toUInt32() == 0x11dd3344);
+	g_assert(BluetoothUuid(0xabc3fff0c71f11e4ULL, 0x87311681e6b88ec1ULL) == BluetoothUuid("abc3fff0-c71f-11e4-8731-1681e6b88ec1"));
+
+	g_assert(std::string(dispatch(BluetoothUuid("0000180F-0000-1000-8000-00805F9B34FB"))) == "battery");
+	g_assert(std::string(dispatch(BluetoothUuid("2902"))) == "cccd");
+	g_assert(std::string(dispatch(BluetoothUuid("abc3fff0-c71f-11e4-8731-1681e6b88ec1"))) == "other");
+	g_assert(std::string(dispatch(BluetoothUuid("0"))) == "other");
+
+	g_assert(std::string(getBluetoothSigUuidName(BluetoothUuid("2a19"))) == "Battery Level");
+	g_assert(std::string(getBluetoothSigUuidName(BLUETOOTH_UUID_GENERIC_ACCESS_SERVICE)) == "Generic Access Service");
+	g_assert(getBluetoothSigUuidName(0xfffe) == nullptr);
+	g_assert(getBluetoothSigUuidName(BluetoothUuid("abc3fff0-c71f-11e4-8731-1681e6b88ec1")) == nullptr);
+
+	for (size_t n = 1; n < BLUETOOTH_SIG_UUIDS_COUNT; n++)
+		g_assert(BLUETOOTH_SIG_UUIDS[n - 1].uuid < BLUETOOTH_SIG_UUIDS[n].uuid);
+
+	// Unparseable input keeps working as before
+	BluetoothUuid invalid("0");
+	BluetoothUuid other = invalid;
+	g_assert(other == invalid);
+	g_assert(other.toString() == "0");
+	g_assert(!(invalid < other) && !(other < invalid));
+	g_assert(BluetoothUuid("0") != BluetoothUuid("1"));
+	g_assert(BluetoothUuid("0") < BluetoothUuid("00") && BluetoothUuid("00") < BluetoothUuid("1"));
+
+	// Unparseable input of any length is handed back unchanged
+	std::string text(100, 'x');
+	BluetoothUuid longText(text);
+	g_assert(longText.toString() == text);
+	g_assert(BluetoothUuid(text + "y") != longText);
+
+	BluetoothUuid copied(longText);
+	BluetoothUuid moved(std::move(copied));
+	g_assert(moved == longText && moved.toString() == text);
+	copied = moved;
+	moved = BluetoothUuid("180f");
+	g_assert(copied.toString() == text);
+	g_assert(moved.toString() == "180f" && moved.isBaseUuid());
+
+	// Parsed UUIDs only need the two halves and a tagged pointer
+	g_assert(sizeof(BluetoothUuid) <= 24);
+}
+
+static void test_uuid_pool(void)
+{
+	BluetoothUuid vendor("6b504fa0-c71f-11e4-8731-1681e6b88ec1");
+
+	// 16 bit UUIDs don't need the pool at all
+	g_assert(BluetoothUuidPool::intern(BluetoothUuid("180f")) == 0x180f);
+	g_assert(BluetoothUuidPool::intern(BluetoothUuid("0000180f-0000-1000-8000-00805f9b34fb")) == 0x180f);
+	g_assert(BluetoothUuidPool::intern(BluetoothUuid("ad,2")) == BluetoothUuidPool::INVALID_ID);
+
+	g_assert(BluetoothUuidPool::find(vendor) == BluetoothUuidPool::INVALID_ID);
+
+	uint32_t id = BluetoothUuidPool::intern(vendor);
+	g_assert(id >= BluetoothUuidPool::FIRST_ID);
+	g_assert(BluetoothUuidPool::intern(BluetoothUuid("6B504FA0-C71F-11E4-8731-1681E6B88EC1")) == id);
+	g_assert(BluetoothUuidPool::find(vendor) == id);
+	g_assert(BluetoothUuidPool::lookup(id) == vendor);
+	g_assert(BluetoothUuidPool::lookup(0x2902).toString() == "2902");
+	g_assert(!BluetoothUuidPool::lookup(0xfffffff0).isValid());
+
+	// 32 bit aliases don't fit the 16 bit id range
+	g_assert(BluetoothUuidPool::intern(BluetoothUuid("11dd3344")) >= BluetoothUuidPool::FIRST_ID);
+}
+
+static void test_uuid_set(void)
+{
+	BluetoothUuidList list = {
+		BluetoothUuid("1101"),
+		BluetoothUuid("110a"),
+		BluetoothUuid("0000111e-0000-1000-8000-00805f9b34fb"),
+		BluetoothUuid("1800"),
+		BluetoothUuid("abc3fff0-c71f-11e4-8731-1681e6b88ec1"),
+		BluetoothUuid("1101"),
+		BluetoothUuid("zz")
+	};
+
+	BluetoothUuidSet set(list);
+	g_assert(set.size() == 5);
+	g_assert(!set.empty());
+	g_assert(set.contains(BluetoothUuid("111e")));
+	g_assert(set.contains(BluetoothUuid("00001101-0000-1000-8000-00805f9b34fb")));
+	g_assert(set.contains(BluetoothUuid("ABC3FFF0-C71F-11E4-8731-1681E6B88EC1")));
+	g_assert(!set.contains(BluetoothUuid("1801")));
+	g_assert(!set.contains(BluetoothUuid("11111111-2222-3333-4444-555555555555")));
+
+	g_assert(!set.insert(BluetoothUuid("1800")));
+	g_assert(set.insert(BluetoothUuid("1801")));
+	g_assert(set.erase(BluetoothUuid("1801")));
+	g_assert(!set.erase(BluetoothUuid("1801")));
+
+	BluetoothUuidList result = set.toList();
+	g_assert(result.size() == 5);
+	g_assert(result[0].toString() == "1101");
+	g_assert(result[1].toString() == "110a");
+	g_assert(result[2].toString() == "111e");
+	g_assert(result[3].toString() == "1800");
+	g_assert(result[4].toString() == "abc3fff0-c71f-11e4-8731-1681e6b88ec1");
+
+	g_assert(BluetoothUuidSet(result) == set);
+
+	set.erase(BluetoothUuid("abc3fff0-c71f-11e4-8731-1681e6b88ec1"));
+	g_assert(BluetoothUuidSet(result) != set);
+
+	set.clear();
+	g_assert(set.empty());
+	g_assert(set.size() == 0);
+}
+
 static void test_uuid_hash(void)
 {
 	std::unordered_map<BluetoothUuid, int> map;
 	map.insert({ BluetoothUuid("abc3fff0-c71f-11e4-8731-1681e6b88ec1"), 10 });
 	g_assert(map.find(BluetoothUuid("abc3fff0-c71f-11e4-8731-1681e6b88ec1")) != map.end());
+
+	// The nil UUID shares its binary value with an invalid UUID but must not
+	// be mixed up with it
+	BluetoothUuid nil("00000000-0000-0000-0000-000000000000");
+	BluetoothUuid invalid;
+	g_assert(nil.isValid() && !invalid.isValid());
+	g_assert(nil != invalid);
+	g_assert((invalid < nil) != (nil < invalid));
+
+	std::hash<BluetoothUuid> hasher;
+	for (auto &uuid : { nil, invalid, BluetoothUuid("0"), BluetoothUuid("180f") })
+	{
+		map[uuid] = 1;
+		g_assert(hasher(uuid) == hasher(BluetoothUuid(uuid)));
+	}
+	g_assert(map.size() == 5);
+
+	std::map<BluetoothUuid, int> ordered;
+	ordered[nil] = 1;
+	ordered[invalid] = 2;
+	g_assert(ordered.size() == 2);
 }
 
 int main(int argc, char **argv)
@@ -125,6 +427,14 @@ int main(int argc, char **argv)
 	g_test_add_func("/uuid/input-validation", test_uuid_correct_validation);
 	g_test_add_func("/uuid/conversion-to-value", test_uuid_conversion_to_value);
 	g_test_add_func("/uuid/comparision", test_uuid_comparison);
+	g_test_add_func("/uuid/to-string", test_uuid_to_string);
+	g_test_add_func("/uuid/base-uuid", test_uuid_base_uuid);
+	g_test_add_func("/uuid/strict-hex", test_uuid_strict_hex);
+	g_test_add_func("/uuid/decode-128", test_uuid_decode_128);
+	g_test_add_func("/uuid/parse-throughput", test_uuid_parse_throughput);
+	g_test_add_func("/uuid/constexpr", test_uuid_constexpr);
+	g_test_add_func("/uuid/pool", test_uuid_pool);
+	g_test_add_func("/uuid/set", test_uuid_set);
 	g_test_add_func("/uuid/hash", test_uuid_hash);
 
 	return g_test_run();
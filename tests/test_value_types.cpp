@@ -0,0 +1,195 @@
+// Copyright (c) 2026 LG Electronics, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include <glib.h>
+
+#include "bluetooth-sil-api.h"
+#include "allocation_counter.h"
+
+static BluetoothGattService create_service(int characteristicCount)
+{
+	BluetoothGattService service(BluetoothGattService::PRIMARY, BluetoothUuid::fromUInt16(0x180d));
+
+	for (int n = 0; n < characteristicCount; n++)
+	{
+		BluetoothGattDescriptor descriptor;
+		descriptor.setUuid(BluetoothUuid::fromUInt16(0x2902));
+		descriptor.setValue(BluetoothGattValue({ 0x01, 0x00 }));
+
+		BluetoothGattCharacteristic characteristic;
+		characteristic.setUuid(BluetoothUuid::fromUInt16(0x2a37 + n));
+		characteristic.setValue(BluetoothGattValue(20, (uint8_t) n));
+		characteristic.addDescriptor(std::move(descriptor));
+
+		service.addCharacteristic(std::move(characteristic));
+	}
+
+	return service;
+}
+
+static BluetoothPropertiesList create_device_properties(int n)
+{
+	BluetoothPropertiesList properties;
+	properties.reserve(5);
+	properties.push_back(BluetoothProperty(BluetoothProperty::Type::NAME, std::string("Heart rate sensor with a long name")));
+	properties.push_back(BluetoothProperty(BluetoothProperty::Type::BDADDR, std::string("00:11:22:33:44:55")));
+	properties.push_back(BluetoothProperty(BluetoothProperty::Type::RSSI, -40 - (n & 31)));
+	properties.push_back(BluetoothProperty(BluetoothProperty::Type::UUIDS,
+		std::vector<std::string>({ "0000180d-0000-1000-8000-00805f9b34fb" })));
+	properties.push_back(BluetoothProperty(BluetoothProperty::Type::SCAN_RECORD,
+		std::vector<uint8_t>({ 0x02, 0x01, 0x06, 0x03, 0x03, 0x0d, 0x18 })));
+
+	return properties;
+}
+
+static void test_value_types_getters(void)
+{
+	BluetoothGattService service = create_service(4);
+	size_t total = 0;
+
+	size_t before = allocations;
+
+	for (auto &characteristic : service.getCharacteristics())
+	{
+		total += characteristic.getValue().size();
+
+		const BluetoothGattDescriptor *descriptor = characteristic.findDescriptor(BluetoothUuid::fromUInt16(0x2902));
+		g_assert(descriptor != nullptr);
+		total += descriptor->getValue().size();
+	}
+
+	const BluetoothGattCharacteristic *characteristic = service.findCharacteristic(BluetoothUuid::fromUInt16(0x2a38));
+	g_assert(characteristic != nullptr);
+	g_assert(characteristic->getValue()[0] == 1);
+	g_assert(service.findCharacteristic(BluetoothUuid::fromUInt16(0x2a00)) == nullptr);
+
+	BluetoothLeDiscoveryFilter filter;
+	g_assert(filter.getServiceData().getUuid().empty());
+	g_assert(filter.getManufacturerData().getData().empty());
+
+	// Reading through the accessors must not copy anything
+	g_assert(allocations == before);
+	g_assert(total == 4 * 22);
+}
+
+static void test_value_types_move(void)
+{
+	BluetoothGattService service = create_service(4);
+	const BluetoothGattCharacteristic *first = &service.getCharacteristics()[0];
+
+	size_t before = allocations;
+	BluetoothGattService moved(std::move(service));
+	g_assert(allocations == before);
+	g_assert(&moved.getCharacteristics()[0] == first);
+
+	BluetoothGattValue value(512, 0xaa);
+	const uint8_t *buffer = value.data();
+
+	BluetoothGattCharacteristic characteristic;
+	before = allocations;
+	characteristic.setValue(std::move(value));
+	g_assert(allocations == before);
+	g_assert(characteristic.getValue().data() == buffer);
+
+	// Values can be taken over from temporaries as well
+	BluetoothGattValue taken = std::move(characteristic).getValue();
+	g_assert(taken.data() == buffer);
+
+	BluetoothMediaMetaData metaData;
+	metaData.setTitle(std::string(64, 't'));
+	const char *title = metaData.getTitle().data();
+	BluetoothFolderItem item;
+	item.setMetadata(std::move(metaData));
+	g_assert(item.getMetadata().getTitle().data() == title);
+
+	BluetoothPropertiesList properties = create_device_properties(0);
+	before = allocations;
+	BluetoothProperty name(std::move(properties[0]));
+	g_assert(allocations == before);
+	g_assert(name.getValue<std::string>() == "Heart rate sensor with a long name");
+}
+
+static void test_value_types_allocations(void)
+{
+	if (!g_test_perf())
+		return;
+
+	const int iterations = 20000;
+	size_t copyingTotal = 0;
+	size_t movingTotal = 0;
+
+	// Both loops do the same work, the first one copies what the accessors
+	// used to return by value, the second one only takes references
+	size_t before = allocations;
+	for (int n = 0; n < iterations; n++)
+	{
+		BluetoothPropertiesList properties = create_device_properties(n);
+		for (auto property : properties)
+		{
+			if (property.getType() == BluetoothProperty::Type::BDADDR)
+				copyingTotal += property.getValue<std::string>().size();
+		}
+
+		BluetoothGattService discovered = create_service(4);
+		BluetoothGattCharacteristicList characteristics = discovered.getCharacteristics();
+		for (auto characteristic : characteristics)
+		{
+			BluetoothGattValue value = characteristic.getValue();
+			BluetoothGattDescriptorList descriptors = characteristic.getDescriptors();
+			copyingTotal += value.size() + descriptors.size();
+		}
+	}
+	size_t copying = allocations - before;
+
+	before = allocations;
+	for (int n = 0; n < iterations; n++)
+	{
+		BluetoothPropertiesList properties = create_device_properties(n);
+		for (auto &property : properties)
+		{
+			if (property.getType() == BluetoothProperty::Type::BDADDR)
+				movingTotal += property.getValue<std::string>().size();
+		}
+
+		BluetoothGattService discovered = create_service(4);
+		const BluetoothGattCharacteristicList &characteristics = discovered.getCharacteristics();
+		for (auto &characteristic : characteristics)
+		{
+			const BluetoothGattValue &value = characteristic.getValue();
+			const BluetoothGattDescriptorList &descriptors = characteristic.getDescriptors();
+			movingTotal += value.size() + descriptors.size();
+		}
+	}
+	size_t moving = allocations - before;
+
+	g_assert(copyingTotal != 0 && copyingTotal == movingTotal);
+	g_assert(moving < copying);
+
+	g_test_message("copying accessors: %.1f allocations per device", (double) copying / iterations);
+	g_test_minimized_result((double) moving / iterations, "move-aware accessors: %.1f allocations per device",
+	                        (double) moving / iterations);
+}
+
+int main(int argc, char **argv)
+{
+	g_test_init(&argc, &argv, nullptr);
+
+	g_test_add_func("/value-types/getters", test_value_types_getters);
+	g_test_add_func("/value-types/move", test_value_types_move);
+	g_test_add_func("/value-types/allocations", test_value_types_allocations);
+
+	return g_test_run();
+}